@@ -18,6 +18,7 @@
 #include <dali-test-suite-utils.h>
 #include <dali/public-api/dali-core.h>
 #include <stdlib.h>
+#include <test-actor-utils.h>
 
 #include <iostream>
 
@@ -60,6 +61,46 @@ public:
   bool             mSignalCalled;
 };
 
+/**
+ * Renders a scene with several layers of renderable actors and returns the trace of the colors set
+ * while rendering it, i.e. the order in which the actors are drawn.
+ */
+std::string RenderLayers(uint32_t workerThreadCount)
+{
+  TestApplication application;
+  application.GetCore().SetUpdateWorkerThreadCount(workerThreadCount);
+
+  const uint32_t LAYER_COUNT = 4u;
+  const uint32_t ACTOR_COUNT = 100u;
+  for(uint32_t i = 0u; i < LAYER_COUNT; ++i)
+  {
+    // Opaque items of 3D layers are sorted by the addresses of their resources, which differ
+    // between applications, so 3D layers only use transparent actors at distinct depths
+    const bool is3d  = i % 2u;
+    Layer      layer = Layer::New();
+    layer.SetProperty(Layer::Property::BEHAVIOR, is3d ? Layer::LAYER_3D : Layer::LAYER_UI);
+    application.GetScene().Add(layer);
+
+    for(uint32_t j = 0u; j < ACTOR_COUNT; ++j)
+    {
+      Actor actor = CreateRenderableActor();
+      actor.SetProperty(Actor::Property::SIZE, Vector2(10.0f, 10.0f));
+      actor.SetProperty(Actor::Property::POSITION, Vector3(float(j % 10u) * 10.0f, float(j / 10u) * 10.0f, is3d ? float(j) : float(j % 3u)));
+      actor.SetProperty(Actor::Property::COLOR, Vector4(float(i) / LAYER_COUNT, float(j) / ACTOR_COUNT, 0.5f, (is3d || !(j % 4u)) ? 0.5f : 1.0f));
+      actor.SetProperty(Actor::Property::DRAW_MODE, j % 25u ? DrawMode::NORMAL : DrawMode::OVERLAY_2D);
+      actor.GetRendererAt(0).SetProperty(Renderer::Property::DEPTH_INDEX, int(j % 7u));
+      layer.Add(actor);
+    }
+  }
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.EnableSetUniformCallTrace(true);
+  application.SendNotification();
+  application.Render();
+
+  return glAbstraction.GetSetUniformTrace().GetTraceString();
+}
+
 } // anonymous namespace
 
 int UtcDaliCoreProcessEvents(void)
@@ -88,3 +129,16 @@ int UtcDaliCoreProcessEvents(void)
 
   END_TEST;
 }
+
+int UtcDaliCoreUpdateWorkerThreadsRenderOrderP(void)
+{
+  tet_infoline("Testing that render lists built by worker threads are drawn in the same order as without worker threads");
+
+  const std::string serialTrace   = RenderLayers(0u);
+  const std::string parallelTrace = RenderLayers(3u);
+
+  DALI_TEST_CHECK(!serialTrace.empty());
+  DALI_TEST_EQUALS(parallelTrace, serialTrace, TEST_LOCATION);
+
+  END_TEST;
+}
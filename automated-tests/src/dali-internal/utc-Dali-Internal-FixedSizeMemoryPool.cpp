@@ -18,6 +18,10 @@
 #include <dali-test-suite-utils.h>
 #include <dali/public-api/dali-core.h>
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 // Internal headers are allowed here
 
 #include <dali/internal/common/fixed-size-memory-pool.h>
@@ -139,3 +143,257 @@ int UtcDaliFixedSizeMemoryPoolStressTest(void)
 
   END_TEST;
 }
+
+int UtcDaliFixedSizeMemoryPoolStatistics(void)
+{
+  Internal::FixedSizeMemoryPool memoryPool(Internal::TypeSizeWithAlignment<TestObject>::size, 32, 1024);
+
+  Internal::FixedSizeMemoryPool::Statistics statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.peakLiveObjects, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.blockCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.capacity, 32u, TEST_LOCATION);
+
+  std::vector<void*> objects;
+  for(unsigned int i = 0; i < 100; ++i)
+  {
+    objects.push_back(memoryPool.Allocate());
+  }
+
+  // The blocks double in size: 32 + 64 + 128
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, 100u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.peakLiveObjects, 100u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.blockCount, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.capacity, 224u, TEST_LOCATION);
+
+  for(unsigned int i = 0; i < 50; ++i)
+  {
+    memoryPool.Free(objects.back());
+    objects.pop_back();
+  }
+
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, 50u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.peakLiveObjects, 100u, TEST_LOCATION);
+
+  // The freed memory is reused before the pool grows
+  for(unsigned int i = 0; i < 50; ++i)
+  {
+    objects.push_back(memoryPool.Allocate());
+  }
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, 100u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.blockCount, 3u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFixedSizeMemoryPoolThreadSafe(void)
+{
+  Internal::FixedSizeMemoryPool memoryPool(Internal::TypeSizeWithAlignment<TestObject>::size);
+
+  const unsigned int numObjects = 1000;
+
+  std::vector<void*> objects;
+  for(unsigned int i = 0; i < numObjects; ++i)
+  {
+    objects.push_back(memoryPool.AllocateThreadSafe());
+  }
+
+  // Every allocation is distinct
+  std::vector<void*> sorted(objects);
+  std::sort(sorted.begin(), sorted.end());
+  DALI_TEST_CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+  Internal::FixedSizeMemoryPool::Statistics statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, numObjects, TEST_LOCATION);
+  const unsigned int capacity = statistics.capacity;
+
+  for(void* object : objects)
+  {
+    memoryPool.FreeThreadSafe(object);
+  }
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.peakLiveObjects, numObjects, TEST_LOCATION);
+
+  // Allocating the same number again does not need more memory
+  for(unsigned int i = 0; i < numObjects; ++i)
+  {
+    objects[i] = memoryPool.AllocateThreadSafe();
+  }
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, numObjects, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.capacity, capacity, TEST_LOCATION);
+
+  for(void* object : objects)
+  {
+    memoryPool.FreeThreadSafe(object);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliFixedSizeMemoryPoolCrossThreadFree(void)
+{
+  Internal::FixedSizeMemoryPool memoryPool(Internal::TypeSizeWithAlignment<TestObject>::size);
+
+  const unsigned int numObjects = 1000;
+
+  std::vector<void*> objects;
+  for(unsigned int i = 0; i < numObjects; ++i)
+  {
+    objects.push_back(memoryPool.AllocateThreadSafe());
+  }
+  const unsigned int capacity = memoryPool.GetStatistics().capacity;
+
+  // Free everything on another thread; what it keeps cached is given back when it exits
+  std::thread freeThread([&]() {
+    for(void* object : objects)
+    {
+      memoryPool.FreeThreadSafe(object);
+    }
+  });
+  freeThread.join();
+
+  Internal::FixedSizeMemoryPool::Statistics statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, 0u, TEST_LOCATION);
+
+  for(unsigned int i = 0; i < numObjects; ++i)
+  {
+    objects[i] = memoryPool.AllocateThreadSafe();
+  }
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.liveObjects, numObjects, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.capacity, capacity, TEST_LOCATION);
+
+  for(void* object : objects)
+  {
+    memoryPool.FreeThreadSafe(object);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliFixedSizeMemoryPoolDestroyedBeforeThreadExit(void)
+{
+  // A thread holding cached allocations of a pool which has gone must exit cleanly
+  std::thread thread([]() {
+    {
+      Internal::FixedSizeMemoryPool memoryPool(Internal::TypeSizeWithAlignment<TestObject>::size);
+      memoryPool.FreeThreadSafe(memoryPool.AllocateThreadSafe());
+    }
+
+    // A new pool, possibly at the same address, must not use the old cache
+    Internal::FixedSizeMemoryPool memoryPool(Internal::TypeSizeWithAlignment<TestObject>::size);
+    void* object = memoryPool.AllocateThreadSafe();
+    DALI_TEST_CHECK(object);
+    DALI_TEST_EQUALS(memoryPool.GetStatistics().liveObjects, 1u, TEST_LOCATION);
+    memoryPool.FreeThreadSafe(object);
+  });
+  thread.join();
+
+  DALI_TEST_CHECK(true);
+
+  END_TEST;
+}
+
+int UtcDaliFixedSizeMemoryPoolTrim(void)
+{
+  const unsigned int fixedSize = Internal::TypeSizeWithAlignment<TestObject>::size;
+  Internal::FixedSizeMemoryPool memoryPool(fixedSize, 32, 1024);
+
+  // Nothing to release in a new pool
+  DALI_TEST_EQUALS(memoryPool.Trim(), 0u, TEST_LOCATION);
+
+  // Fill blocks of 32, 64, 128, 256 and 512 allocations
+  std::vector<void*> objects;
+  for(unsigned int i = 0; i < 992; ++i)
+  {
+    objects.push_back(memoryPool.Allocate());
+  }
+  DALI_TEST_EQUALS(memoryPool.GetStatistics().blockCount, 5u, TEST_LOCATION);
+
+  // Every block is in use
+  DALI_TEST_EQUALS(memoryPool.Trim(), 0u, TEST_LOCATION);
+
+  // Free everything in the second and third blocks, and all but one allocation of the fourth
+  for(unsigned int i = 32; i < 480; ++i)
+  {
+    if(i != 300)
+    {
+      memoryPool.Free(objects[i]);
+      objects[i] = nullptr;
+    }
+  }
+
+  DALI_TEST_EQUALS(memoryPool.Trim(), (64u + 128u) * fixedSize, TEST_LOCATION);
+
+  Internal::FixedSizeMemoryPool::Statistics statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.blockCount, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.capacity, 32u + 256u + 512u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.liveObjects, 992u - 447u, TEST_LOCATION);
+
+  // The remaining free allocations of the fourth block are still used before the pool grows
+  for(unsigned int i = 0; i < 255; ++i)
+  {
+    void* object = memoryPool.Allocate();
+    DALI_TEST_CHECK(object != objects[0]);
+    objects.push_back(object);
+  }
+  DALI_TEST_EQUALS(memoryPool.GetStatistics().blockCount, 3u, TEST_LOCATION);
+
+  for(void* object : objects)
+  {
+    if(object)
+    {
+      memoryPool.Free(object);
+    }
+  }
+
+  // The first and the current block are kept
+  DALI_TEST_EQUALS(memoryPool.Trim(), 256u * fixedSize, TEST_LOCATION);
+  DALI_TEST_EQUALS(memoryPool.GetStatistics().blockCount, 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFixedSizeMemoryPoolTrimThreadSafe(void)
+{
+  const unsigned int fixedSize = Internal::TypeSizeWithAlignment<TestObject>::size;
+  Internal::FixedSizeMemoryPool memoryPool(fixedSize, 32, 1024);
+
+  std::vector<void*> objects;
+  for(unsigned int i = 0; i < 992; ++i)
+  {
+    objects.push_back(memoryPool.AllocateThreadSafe());
+  }
+
+  // Free on another thread: its cached allocations go back to the pool when it exits
+  std::thread freeThread([&]() {
+    for(void* object : objects)
+    {
+      memoryPool.FreeThreadSafe(object);
+    }
+  });
+  freeThread.join();
+
+  // The calling thread keeps the returned allocations which don't fit in its cache, Trim gives them back as well
+  memoryPool.FreeThreadSafe(memoryPool.AllocateThreadSafe());
+
+  // All the filled blocks but the first are released
+  DALI_TEST_EQUALS(memoryPool.Trim(), (64u + 128u + 256u) * fixedSize, TEST_LOCATION);
+  DALI_TEST_EQUALS(memoryPool.GetStatistics().liveObjects, 0u, TEST_LOCATION);
+
+  for(unsigned int i = 0; i < 992; ++i)
+  {
+    objects[i] = memoryPool.AllocateThreadSafe();
+  }
+  for(void* object : objects)
+  {
+    memoryPool.FreeThreadSafe(object);
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/public-api/dali-core.h>
+
+#include <cmath>
+#include <cstdlib>
+
+// Internal headers are allowed here
+
+#include <dali/internal/event/animation/key-frame-channel.h>
+#include <dali/internal/event/animation/key-frames-impl.h>
+
+using namespace Dali;
+using Dali::Internal::KeyFrameChannel;
+
+void utc_dali_internal_keyframechannel_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_keyframechannel_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+/**
+ * Evaluates the channel by scanning all the key frames, as KeyFrameChannel used to.
+ */
+template<typename V>
+V GetValueByScanning(const KeyFrameChannel<V>& channel, float progress, Dali::Animation::Interpolation interpolation)
+{
+  const auto& values = channel.mValues;
+  V           result{};
+  if(progress >= values.back().GetProgress())
+  {
+    return values.back().GetValue();
+  }
+
+  auto end = std::find_if(values.begin(), values.end(), [=](const auto& element) { return element.GetProgress() > progress; });
+  if(end == values.begin() || end == values.end())
+  {
+    return result;
+  }
+  auto  start         = end - 1;
+  float frameProgress = (progress - start->GetProgress()) / (end->GetProgress() - start->GetProgress());
+  if(interpolation == Dali::Animation::LINEAR)
+  {
+    Internal::Interpolate(result, start->GetValue(), end->GetValue(), frameProgress);
+  }
+  else
+  {
+    V prev = (start != values.begin()) ? (start - 1)->GetValue() : start->GetValue() + (start->GetValue() - (start + 1)->GetValue());
+    V next = (end != values.end() - 1) ? (end + 1)->GetValue() : end->GetValue() + (end->GetValue() - (end - 1)->GetValue());
+    Internal::CubicInterpolate(result, prev, start->GetValue(), end->GetValue(), next, frameProgress);
+  }
+  return result;
+}
+
+KeyFrameChannel<Vector3> CreateChannel(unsigned int count)
+{
+  KeyFrameChannel<Vector3> channel;
+  for(unsigned int i = 0; i < count; ++i)
+  {
+    const float progress = static_cast<float>(i) / static_cast<float>(count - 1);
+    channel.mValues.push_back({progress, Vector3(std::sin(progress * 20.0f), std::cos(progress * 7.0f), progress)});
+  }
+  return channel;
+}
+
+} // namespace
+
+int UtcDaliKeyFrameChannelGetValueMatchesScan(void)
+{
+  KeyFrameChannel<Vector3> channel = CreateChannel(100);
+
+  // Forwards, backwards and jumping about
+  std::vector<float> progresses;
+  for(int i = 0; i <= 1000; ++i)
+  {
+    progresses.push_back(static_cast<float>(i) / 1000.0f);
+  }
+  for(int i = 1000; i >= 0; --i)
+  {
+    progresses.push_back(static_cast<float>(i) / 1000.0f);
+  }
+  srand(42);
+  for(int i = 0; i < 1000; ++i)
+  {
+    progresses.push_back(static_cast<float>(rand() % 1001) / 1000.0f);
+  }
+
+  for(float progress : progresses)
+  {
+    DALI_TEST_EQUALS(channel.GetValue(progress, Dali::Animation::LINEAR), GetValueByScanning(channel, progress, Dali::Animation::LINEAR), TEST_LOCATION);
+    DALI_TEST_EQUALS(channel.GetValue(progress, Dali::Animation::CUBIC), GetValueByScanning(channel, progress, Dali::Animation::CUBIC), TEST_LOCATION);
+  }
+
+  // The precalculated coefficients give the same values
+  channel.PrepareCubicInterpolation();
+  DALI_TEST_EQUALS(channel.mCubicCoefficients.size(), 99u, TEST_LOCATION);
+  for(float progress : progresses)
+  {
+    DALI_TEST_EQUALS(channel.GetValue(progress, Dali::Animation::CUBIC), GetValueByScanning(channel, progress, Dali::Animation::CUBIC), TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliKeyFrameChannelGetValueIntegerCubic(void)
+{
+  KeyFrameChannel<int32_t> channel;
+  channel.mValues.push_back({0.0f, 0});
+  channel.mValues.push_back({0.25f, 10});
+  channel.mValues.push_back({0.5f, -20});
+  channel.mValues.push_back({1.0f, 100});
+
+  std::vector<int32_t> unprepared;
+  for(int i = 0; i <= 100; ++i)
+  {
+    unprepared.push_back(channel.GetValue(static_cast<float>(i) / 100.0f, Dali::Animation::CUBIC));
+  }
+
+  channel.PrepareCubicInterpolation();
+  for(int i = 0; i <= 100; ++i)
+  {
+    DALI_TEST_EQUALS(channel.GetValue(static_cast<float>(i) / 100.0f, Dali::Animation::CUBIC), unprepared[i], TEST_LOCATION);
+  }
+
+  // Adding a key frame leaves the coefficients out of date, so they are not used
+  channel.mValues.push_back({2.0f, 0});
+  DALI_TEST_EQUALS(channel.GetValue(1.5f, Dali::Animation::CUBIC), GetValueByScanning(channel, 1.5f, Dali::Animation::CUBIC), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliKeyFrameChannelGetValueEdgeCases(void)
+{
+  KeyFrameChannel<float> channel;
+  channel.mValues.push_back({0.2f, 1.0f});
+  channel.mValues.push_back({0.5f, 2.0f});
+  channel.mValues.push_back({0.5f, 5.0f});
+  channel.mValues.push_back({0.8f, 3.0f});
+
+  // Not active before the first key frame
+  DALI_TEST_CHECK(!channel.IsActive(0.1f));
+  DALI_TEST_EQUALS(channel.GetValue(0.1f, Dali::Animation::LINEAR), 0.0f, TEST_LOCATION);
+
+  // Key frames at the same progress jump to the later one
+  DALI_TEST_EQUALS(channel.GetValue(0.5f, Dali::Animation::LINEAR), 5.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(channel.GetValue(0.35f, Dali::Animation::LINEAR), 1.5f, TEST_LOCATION);
+
+  // The last value is kept after the last key frame
+  DALI_TEST_EQUALS(channel.GetValue(0.9f, Dali::Animation::LINEAR), 3.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(channel.GetValue(0.2f, Dali::Animation::LINEAR), 1.0f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliKeyFrameChannelAddKeyFrameOutOfOrder(void)
+{
+  Internal::KeyFrameNumber keyFrames;
+  keyFrames.AddKeyFrame(0.8f, 3.0f, AlphaFunction::DEFAULT);
+  keyFrames.AddKeyFrame(0.2f, 1.0f, AlphaFunction::DEFAULT);
+  keyFrames.AddKeyFrame(0.5f, 2.0f, AlphaFunction::DEFAULT);
+  keyFrames.AddKeyFrame(0.5f, 5.0f, AlphaFunction::DEFAULT);
+  DALI_TEST_EQUALS(keyFrames.GetNumberOfKeyFrames(), 4u, TEST_LOCATION);
+
+  // The key frames are kept in progress order, equal progress in the order they were added
+  const float expectedTimes[]  = {0.2f, 0.5f, 0.5f, 0.8f};
+  const float expectedValues[] = {1.0f, 2.0f, 5.0f, 3.0f};
+  for(unsigned int index = 0u; index < 4u; ++index)
+  {
+    float time  = 0.0f;
+    float value = 0.0f;
+    keyFrames.GetKeyFrame(index, time, value);
+    DALI_TEST_EQUALS(time, expectedTimes[index], TEST_LOCATION);
+    DALI_TEST_EQUALS(value, expectedValues[index], TEST_LOCATION);
+  }
+
+  DALI_TEST_EQUALS(keyFrames.GetValue(0.35f, Dali::Animation::LINEAR), 1.5f, TEST_LOCATION);
+  DALI_TEST_EQUALS(keyFrames.GetValue(0.65f, Dali::Animation::LINEAR), 4.0f, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/public-api/dali-core.h>
+
+#include <vector>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/math.h>
+
+using namespace Dali;
+
+void utc_dali_internal_math_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_math_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+/**
+ * Reference scalar implementation of Matrix::Multiply
+ */
+Matrix ReferenceMultiply(const Matrix& lhs, const Matrix& rhs)
+{
+  Matrix       result(false);
+  float*       out = result.AsFloat();
+  const float* l   = lhs.AsFloat();
+  const float* r   = rhs.AsFloat();
+  for(uint32_t i = 0u; i < 4u; ++i)
+  {
+    for(uint32_t j = 0u; j < 4u; ++j)
+    {
+      out[i * 4u + j] = l[i * 4u] * r[j] + l[i * 4u + 1u] * r[4u + j] + l[i * 4u + 2u] * r[8u + j] + l[i * 4u + 3u] * r[12u + j];
+    }
+  }
+  return result;
+}
+
+Matrix MakeTransform(uint32_t seed)
+{
+  Matrix matrix(false);
+  matrix.SetTransformComponents(Vector3(1.0f + 0.1f * float(seed % 3), 2.0f - 0.2f * float(seed % 5), 1.5f),
+                                Quaternion(Radian(0.3f * float(seed)), Vector3(1.0f, float(seed % 4), 2.0f)),
+                                Vector3(float(seed), -2.0f * float(seed), 0.5f));
+  return matrix;
+}
+
+} // namespace
+
+int UtcDaliInternalMathMultiplyMatricesP(void)
+{
+  const uint32_t      COUNT = 17u;
+  const Matrix        parent(MakeTransform(100u));
+  std::vector<Matrix> local;
+  for(uint32_t i = 0u; i < COUNT; ++i)
+  {
+    local.push_back(MakeTransform(i));
+  }
+
+  std::vector<Matrix> world(COUNT, Matrix(false));
+  Internal::MultiplyMatrices(world.data(), local.data(), parent, COUNT);
+
+  for(uint32_t i = 0u; i < COUNT; ++i)
+  {
+    DALI_TEST_EQUALS(world[i], ReferenceMultiply(local[i], parent), 0.0001f, TEST_LOCATION);
+  }
+
+  // The result can be stored in place of the matrices being multiplied
+  Internal::MultiplyMatrices(local.data(), local.data(), parent, COUNT);
+  for(uint32_t i = 0u; i < COUNT; ++i)
+  {
+    DALI_TEST_EQUALS(local[i], world[i], 0.0001f, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliInternalMathMatrixMultiplyAliasedP(void)
+{
+  const Matrix lhs(MakeTransform(3u));
+  const Matrix rhs(MakeTransform(7u));
+  const Matrix expected(ReferenceMultiply(lhs, rhs));
+
+  Matrix result(lhs);
+  Matrix::Multiply(result, result, rhs);
+  DALI_TEST_EQUALS(result, expected, 0.0001f, TEST_LOCATION);
+
+  result = rhs;
+  Matrix::Multiply(result, lhs, result);
+  DALI_TEST_EQUALS(result, expected, 0.0001f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalMathMatrixTransformComponentsP(void)
+{
+  for(uint32_t i = 0u; i < 10u; ++i)
+  {
+    const Vector3    scale(1.0f + float(i), 2.0f, 0.5f * float(i + 1u));
+    const Quaternion orientation(Radian(0.7f * float(i)), Vector3(float(i % 3), 1.0f, -1.0f));
+    const Vector3    translation(float(i), 3.0f, -float(i));
+
+    Matrix matrix(false);
+    matrix.SetTransformComponents(scale, orientation, translation);
+
+    // Compare with scale * rotation * translation built from separate matrices
+    Matrix scaleMatrix;
+    scaleMatrix.SetIdentityAndScale(scale);
+    Matrix rotationMatrix(orientation);
+    Matrix expected(false);
+    Matrix::Multiply(expected, scaleMatrix, rotationMatrix);
+    expected.SetTranslation(translation);
+    DALI_TEST_EQUALS(matrix, expected, 0.0001f, TEST_LOCATION);
+
+    // The inverse transform is the general inverse of the matrix
+    Matrix inverse(false);
+    matrix.InvertTransform(inverse);
+    Matrix generalInverse(matrix);
+    generalInverse.Invert();
+    if(Equals(scale.x, scale.y) && Equals(scale.y, scale.z))
+    {
+      DALI_TEST_EQUALS(inverse, generalInverse, 0.0001f, TEST_LOCATION);
+    }
+
+    // InvertTransform transposes the rotation, so compare against a matrix without scale
+    Matrix rotationAndTranslation(false);
+    rotationAndTranslation.SetTransformComponents(Vector3::ONE, orientation, translation);
+    rotationAndTranslation.InvertTransform(inverse);
+    Matrix identity(false);
+    Matrix::Multiply(identity, rotationAndTranslation, inverse);
+    DALI_TEST_EQUALS(identity, Matrix::IDENTITY, 0.0001f, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliInternalMathQuaternionMultiplyP(void)
+{
+  for(uint32_t i = 0u; i < 10u; ++i)
+  {
+    const Quaternion q1(Radian(0.4f * float(i)), Vector3(1.0f, float(i % 3), 0.5f));
+    const Quaternion q2(Radian(-0.3f * float(i)), Vector3(float(i % 2), 1.0f, 2.0f));
+
+    // Multiplying quaternions is the same as multiplying their rotation matrices
+    Matrix expected(false);
+    Matrix::Multiply(expected, Matrix(q2), Matrix(q1));
+    DALI_TEST_EQUALS(Matrix(q1 * q2), expected, 0.0001f, TEST_LOCATION);
+
+    Quaternion product(q1);
+    product *= q2;
+    DALI_TEST_EQUALS(product, q1 * q2, 0.0001f, TEST_LOCATION);
+
+    product = q1;
+    product *= product;
+    DALI_TEST_EQUALS(product, q1 * q1, 0.0001f, TEST_LOCATION);
+
+    // Slerping half way gives the same rotation from both ends
+    const Quaternion half = Quaternion::Slerp(q1, q2, 0.5f);
+    DALI_TEST_EQUALS(Quaternion::AngleBetween(q1, half), Quaternion::AngleBetween(half, q2), 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(Quaternion::Slerp(q1, q2, 0.0f), q1, 0.0001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(Quaternion::SlerpNoInvert(q1, q2, 1.0f), q2, 0.0001f, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/public-api/dali-core.h>
+#include <test-render-controller.h>
+
+#include <atomic>
+#include <new>
+#include <thread>
+#include <vector>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/lock-free-ring.h>
+#include <dali/internal/common/message.h>
+#include <dali/internal/update/common/scene-graph-buffers.h>
+#include <dali/internal/update/queue/update-message-queue.h>
+
+using namespace Dali;
+using Dali::Internal::LockFreeRing;
+using Dali::Internal::MessageBase;
+using Dali::Internal::SceneGraph::SceneGraphBuffers;
+using Dali::Internal::Update::MessageQueue;
+
+void utc_dali_internal_message_queue_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_message_queue_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+/**
+ * A message that counts how often it is processed
+ */
+class CountingMessage : public MessageBase
+{
+public:
+  explicit CountingMessage(uint32_t& counter)
+  : mCounter(counter)
+  {
+  }
+
+  void Process(Internal::BufferIndex /*bufferIndex*/) override
+  {
+    ++mCounter;
+  }
+
+private:
+  uint32_t& mCounter;
+};
+
+void QueueCountingMessage(MessageQueue& queue, uint32_t& counter, bool updateScene)
+{
+  uint32_t* slot = queue.ReserveMessageSlot(sizeof(CountingMessage), updateScene);
+  new(slot) CountingMessage(counter);
+}
+
+/**
+ * A message that appends a value to a log when processed
+ */
+class LogMessage : public MessageBase
+{
+public:
+  LogMessage(std::vector<int>& log, int value)
+  : mLog(log),
+    mValue(value)
+  {
+  }
+
+  void Process(Internal::BufferIndex /*bufferIndex*/) override
+  {
+    mLog.push_back(mValue);
+  }
+
+private:
+  std::vector<int>& mLog;
+  int               mValue;
+};
+
+void QueuePropertyMessage(MessageQueue& queue, std::vector<int>& log, const void* property, int value)
+{
+  uint32_t* slot = queue.ReservePropertyMessageSlot(sizeof(LogMessage), property);
+  new(slot) LogMessage(log, value);
+}
+
+void QueueOtherMessage(MessageQueue& queue, std::vector<int>& log, int value)
+{
+  uint32_t* slot = queue.ReserveMessageSlot(sizeof(LogMessage), true);
+  new(slot) LogMessage(log, value);
+}
+
+} // namespace
+
+int UtcDaliInternalLockFreeRingPushPop(void)
+{
+  LockFreeRing<uint32_t> ring(4u);
+  DALI_TEST_EQUALS(ring.GetCapacity(), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(ring.GetCount(), 0u, TEST_LOCATION);
+
+  uint32_t value = 0u;
+  DALI_TEST_CHECK(!ring.Pop(value));
+
+  for(uint32_t i = 0u; i < 4u; ++i)
+  {
+    DALI_TEST_CHECK(ring.Push(i));
+  }
+  DALI_TEST_CHECK(!ring.Push(4u));
+  DALI_TEST_EQUALS(ring.GetCount(), 4u, TEST_LOCATION);
+
+  // Items come out in order and the indices wrap around
+  for(uint32_t i = 0u; i < 10u; ++i)
+  {
+    DALI_TEST_CHECK(ring.Pop(value));
+    DALI_TEST_EQUALS(value, i, TEST_LOCATION);
+    DALI_TEST_CHECK(ring.Push(i + 4u));
+  }
+  DALI_TEST_EQUALS(ring.GetCount(), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(ring.GetHighWaterMark(), 4u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalLockFreeRingHighWaterMark(void)
+{
+  LockFreeRing<uint32_t> ring(8u);
+  uint32_t               value = 0u;
+
+  ring.Push(1u);
+  ring.Push(2u);
+  ring.Push(3u);
+  ring.Pop(value);
+  ring.Pop(value);
+  ring.Push(4u);
+  DALI_TEST_EQUALS(ring.GetCount(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(ring.GetHighWaterMark(), 3u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalMessageQueueProcessMessages(void)
+{
+  TestRenderController controller;
+  SceneGraphBuffers    buffers;
+  MessageQueue         queue(controller, buffers);
+
+  uint32_t processed = 0u;
+  DALI_TEST_CHECK(!queue.FlushQueue());
+
+  queue.EventProcessingStarted();
+  QueueCountingMessage(queue, processed, false);
+  QueueCountingMessage(queue, processed, false);
+  DALI_TEST_CHECK(queue.FlushQueue());
+  DALI_TEST_CHECK(!queue.IsSceneUpdateRequired());
+
+  DALI_TEST_CHECK(!queue.ProcessMessages(0u));
+  DALI_TEST_EQUALS(processed, 2u, TEST_LOCATION);
+  DALI_TEST_CHECK(!queue.WasEmpty());
+
+  queue.ProcessMessages(1u);
+  DALI_TEST_CHECK(queue.WasEmpty());
+  DALI_TEST_EQUALS(queue.GetHighWaterMark(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalMessageQueueSceneUpdate(void)
+{
+  TestRenderController controller;
+  SceneGraphBuffers    buffers;
+  MessageQueue         queue(controller, buffers);
+
+  uint32_t processed = 0u;
+  queue.EventProcessingStarted();
+  QueueCountingMessage(queue, processed, true);
+  queue.FlushQueue();
+
+  // Required as soon as the message is flushed, before it is processed
+  DALI_TEST_CHECK(queue.IsSceneUpdateRequired());
+  DALI_TEST_CHECK(queue.ProcessMessages(0u));
+  DALI_TEST_EQUALS(processed, 1u, TEST_LOCATION);
+
+  // Still reported for the frame after processing, as before
+  DALI_TEST_CHECK(queue.IsSceneUpdateRequired());
+  DALI_TEST_CHECK(!queue.ProcessMessages(1u));
+  DALI_TEST_CHECK(!queue.IsSceneUpdateRequired());
+
+  END_TEST;
+}
+
+int UtcDaliInternalMessageQueueBackPressure(void)
+{
+  TestRenderController controller;
+  SceneGraphBuffers    buffers;
+  MessageQueue         queue(controller, buffers);
+
+  // Flush many more buffers than the queue holds without processing any of them
+  const uint32_t FLUSH_COUNT = 1000u;
+  uint32_t       processed   = 0u;
+  for(uint32_t i = 0u; i < FLUSH_COUNT; ++i)
+  {
+    queue.EventProcessingStarted();
+    QueueCountingMessage(queue, processed, false);
+    DALI_TEST_CHECK(queue.FlushQueue());
+  }
+
+  const uint32_t highWaterMark = queue.GetHighWaterMark();
+  DALI_TEST_CHECK(highWaterMark < FLUSH_COUNT);
+
+  // The messages kept back are flushed once the update thread has caught up
+  queue.ProcessMessages(0u);
+  queue.EventProcessingStarted();
+  queue.FlushQueue();
+  queue.ProcessMessages(1u);
+
+  DALI_TEST_EQUALS(processed, FLUSH_COUNT, TEST_LOCATION);
+  DALI_TEST_EQUALS(queue.GetHighWaterMark(), highWaterMark, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalMessageQueueCoalescingDisabled(void)
+{
+  TestRenderController controller;
+  SceneGraphBuffers    buffers;
+  MessageQueue         queue(controller, buffers);
+  DALI_TEST_CHECK(!queue.IsPropertyMessageCoalescingEnabled());
+
+  int              property = 0;
+  std::vector<int> log;
+  queue.EventProcessingStarted();
+  QueuePropertyMessage(queue, log, &property, 1);
+  QueuePropertyMessage(queue, log, &property, 2);
+  queue.FlushQueue();
+  queue.ProcessMessages(0u);
+
+  DALI_TEST_EQUALS(log.size(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(queue.GetCoalescedMessageCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalMessageQueueCoalescing(void)
+{
+  TestRenderController controller;
+  SceneGraphBuffers    buffers;
+  MessageQueue         queue(controller, buffers);
+  queue.SetPropertyMessageCoalescing(true);
+  DALI_TEST_CHECK(queue.IsPropertyMessageCoalescingEnabled());
+
+  int              propertyA = 0;
+  int              propertyB = 0;
+  std::vector<int> log;
+  queue.EventProcessingStarted();
+
+  // Superseded values of a property are dropped; the first message of each property keeps its place
+  for(int i = 0; i < 50; ++i)
+  {
+    QueuePropertyMessage(queue, log, &propertyA, 100 + i);
+    QueuePropertyMessage(queue, log, &propertyB, 200 + i);
+  }
+  queue.FlushQueue();
+  DALI_TEST_CHECK(queue.IsSceneUpdateRequired());
+  queue.ProcessMessages(0u);
+
+  DALI_TEST_EQUALS(log.size(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(log[0], 149, TEST_LOCATION);
+  DALI_TEST_EQUALS(log[1], 249, TEST_LOCATION);
+  DALI_TEST_EQUALS(queue.GetCoalescedMessageCount(), 98u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalMessageQueueCoalescingOrder(void)
+{
+  TestRenderController controller;
+  SceneGraphBuffers    buffers;
+  MessageQueue         queue(controller, buffers);
+  queue.SetPropertyMessageCoalescing(true);
+
+  int              property = 0;
+  std::vector<int> log;
+  queue.EventProcessingStarted();
+
+  // A message which is not a property message (e.g. connecting a node) ends the coalescing window
+  QueuePropertyMessage(queue, log, &property, 1);
+  QueuePropertyMessage(queue, log, &property, 2);
+  QueueOtherMessage(queue, log, 3);
+  QueuePropertyMessage(queue, log, &property, 4);
+  QueuePropertyMessage(queue, log, &property, 5);
+  queue.FlushQueue();
+
+  // So does flushing the queue
+  QueuePropertyMessage(queue, log, &property, 6);
+  queue.FlushQueue();
+  queue.ProcessMessages(0u);
+
+  DALI_TEST_EQUALS(log.size(), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(log[0], 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(log[1], 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(log[2], 5, TEST_LOCATION);
+  DALI_TEST_EQUALS(log[3], 6, TEST_LOCATION);
+  DALI_TEST_EQUALS(queue.GetCoalescedMessageCount(), 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalMessageQueueCoalescingBufferGrowth(void)
+{
+  TestRenderController controller;
+  SceneGraphBuffers    buffers;
+  MessageQueue         queue(controller, buffers);
+  queue.SetPropertyMessageCoalescing(true);
+
+  // Enough properties for the buffer to be reallocated several times
+  const int        PROPERTY_COUNT = 5000;
+  std::vector<int> properties(PROPERTY_COUNT);
+  std::vector<int> log;
+  queue.EventProcessingStarted();
+  for(int i = 0; i < PROPERTY_COUNT; ++i)
+  {
+    QueuePropertyMessage(queue, log, &properties[i], -1);
+  }
+  for(int i = 0; i < PROPERTY_COUNT; ++i)
+  {
+    QueuePropertyMessage(queue, log, &properties[i], i);
+  }
+  queue.FlushQueue();
+  queue.ProcessMessages(0u);
+
+  bool inOrder = (log.size() == static_cast<std::size_t>(PROPERTY_COUNT));
+  for(int i = 0; inOrder && i < PROPERTY_COUNT; ++i)
+  {
+    inOrder = (log[i] == i);
+  }
+  DALI_TEST_CHECK(inOrder);
+  DALI_TEST_EQUALS(queue.GetCoalescedMessageCount(), static_cast<uint32_t>(PROPERTY_COUNT), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalMessageQueueConcurrentP(void)
+{
+  tet_infoline("Test that every message is delivered when the queue is driven from an event thread and an update thread at the same time");
+
+  const uint32_t FLUSH_COUNT        = 2000u;
+  const uint32_t MESSAGES_PER_FLUSH = 50u;
+
+  TestRenderController controller;
+  SceneGraphBuffers    buffers;
+  MessageQueue         queue(controller, buffers);
+
+  uint32_t          processed = 0u; // Only touched by the update thread
+  std::atomic<bool> finished{false};
+
+  std::thread updateThread([&]() {
+    Internal::BufferIndex bufferIndex = 0u;
+    while(!finished.load())
+    {
+      queue.ProcessMessages(bufferIndex);
+      bufferIndex = 1u - bufferIndex;
+    }
+    queue.ProcessMessages(bufferIndex);
+  });
+
+  for(uint32_t i = 0u; i < FLUSH_COUNT; ++i)
+  {
+    queue.EventProcessingStarted();
+    for(uint32_t j = 0u; j < MESSAGES_PER_FLUSH; ++j)
+    {
+      QueueCountingMessage(queue, processed, (j == 0u));
+    }
+    queue.FlushQueue();
+  }
+
+  // Flush any messages kept back while the update thread was behind
+  while(queue.FlushQueue())
+  {
+    std::this_thread::yield();
+  }
+  finished = true;
+  updateThread.join();
+
+  DALI_TEST_EQUALS(processed, FLUSH_COUNT * MESSAGES_PER_FLUSH, TEST_LOCATION);
+
+  // The flushed buffers waiting for the update thread never exceed the buffers the queue can hold
+  DALI_TEST_CHECK(queue.GetHighWaterMark() >= 1u);
+  DALI_TEST_CHECK(queue.GetHighWaterMark() <= 64u);
+
+  END_TEST;
+}
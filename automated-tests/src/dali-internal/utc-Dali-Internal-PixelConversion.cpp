@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/public-api/dali-core.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/pixel-conversion.h>
+
+using namespace Dali;
+using namespace Dali::Internal::PixelConversion;
+
+void utc_dali_internal_pixel_conversion_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_pixel_conversion_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+/**
+ * Pixel counts covering empty input, the scalar tails only and the vector loops followed by every tail length
+ */
+const uint32_t PIXEL_COUNTS[] = {0u, 1u, 3u, 4u, 7u, 8u, 15u, 16u, 17u, 31u, 33u, 100u, 1027u};
+
+/**
+ * The buffers start one byte after an allocation so the kernels are tested with unaligned data
+ */
+const uint32_t BUFFER_OFFSET = 1u;
+
+std::vector<uint8_t> CreateSource(uint32_t size)
+{
+  std::vector<uint8_t> source(size + BUFFER_OFFSET);
+  uint32_t             seed = 12345u;
+  for(auto& value : source)
+  {
+    seed  = seed * 1664525u + 1013904223u;
+    value = static_cast<uint8_t>(seed >> 24u);
+  }
+  return source;
+}
+
+/**
+ * Converts pixels to RGBA8888, expecting the given kernel to give the same result as the per pixel function
+ */
+template<typename Kernel, typename Reference>
+bool CheckConversion(uint32_t bytesPerPixel, Kernel kernel, Reference reference)
+{
+  for(uint32_t pixelCount : PIXEL_COUNTS)
+  {
+    std::vector<uint8_t> source = CreateSource(pixelCount * bytesPerPixel);
+
+    // A guard byte after the pixels checks the kernel does not write past the end
+    std::vector<uint8_t> destination(pixelCount * 4u + BUFFER_OFFSET + 1u, 0xA5);
+    kernel(&destination[BUFFER_OFFSET], &source[BUFFER_OFFSET], pixelCount);
+
+    for(uint32_t i = 0u; i < pixelCount; ++i)
+    {
+      uint8_t expected[4];
+      reference(expected, &source[BUFFER_OFFSET + i * bytesPerPixel]);
+      for(uint32_t channel = 0u; channel < 4u; ++channel)
+      {
+        if(destination[BUFFER_OFFSET + i * 4u + channel] != expected[channel])
+        {
+          tet_printf("Pixel %u of %u, channel %u: %u != %u\n", i, pixelCount, channel, destination[BUFFER_OFFSET + i * 4u + channel], expected[channel]);
+          return false;
+        }
+      }
+    }
+    if(destination.back() != 0xA5)
+    {
+      tet_printf("Wrote past %u pixels\n", pixelCount);
+      return false;
+    }
+  }
+  return true;
+}
+
+void ReferenceRgbToRgba(uint8_t* rgba, const uint8_t* rgb)
+{
+  rgba[0] = rgb[0];
+  rgba[1] = rgb[1];
+  rgba[2] = rgb[2];
+  rgba[3] = 0xFF;
+}
+
+void ReferenceSwapRedAndBlue(uint8_t* destination, const uint8_t* source)
+{
+  destination[0] = source[2];
+  destination[1] = source[1];
+  destination[2] = source[0];
+  destination[3] = source[3];
+}
+
+void ReferencePremultiplyAlpha(uint8_t* destination, const uint8_t* source)
+{
+  for(uint32_t channel = 0u; channel < 3u; ++channel)
+  {
+    destination[channel] = static_cast<uint8_t>(std::lround(source[channel] * source[3] / 255.0));
+  }
+  destination[3] = source[3];
+}
+
+void ReferenceLuminanceToRgba(uint8_t* rgba, const uint8_t* luminance)
+{
+  rgba[0] = rgba[1] = rgba[2] = luminance[0];
+  rgba[3]                     = 0xFF;
+}
+
+void ReferenceLuminanceAlphaToRgba(uint8_t* rgba, const uint8_t* luminanceAlpha)
+{
+  rgba[0] = rgba[1] = rgba[2] = luminanceAlpha[0];
+  rgba[3]                     = luminanceAlpha[1];
+}
+
+} // namespace
+
+int UtcDaliInternalPixelConversionRgbToRgbaP(void)
+{
+  DALI_TEST_CHECK(CheckConversion(3u, ConvertRgbToRgba, ReferenceRgbToRgba));
+  END_TEST;
+}
+
+int UtcDaliInternalPixelConversionSwapRedAndBlueP(void)
+{
+  DALI_TEST_CHECK(CheckConversion(4u, SwapRedAndBlue, ReferenceSwapRedAndBlue));
+
+  // Swapping in place, twice, gives back the original pixels
+  std::vector<uint8_t> source = CreateSource(1027u * 4u);
+  std::vector<uint8_t> pixels(source);
+  SwapRedAndBlue(&pixels[BUFFER_OFFSET], &pixels[BUFFER_OFFSET], 1027u);
+  DALI_TEST_CHECK(pixels != source);
+  SwapRedAndBlue(&pixels[BUFFER_OFFSET], &pixels[BUFFER_OFFSET], 1027u);
+  DALI_TEST_CHECK(pixels == source);
+
+  END_TEST;
+}
+
+int UtcDaliInternalPixelConversionPremultiplyAlphaP(void)
+{
+  DALI_TEST_CHECK(CheckConversion(4u, PremultiplyAlpha, ReferencePremultiplyAlpha));
+
+  // Every combination of colour and alpha is rounded to the nearest value, in place too
+  std::vector<uint8_t> pixels;
+  for(uint32_t alpha = 0u; alpha < 256u; ++alpha)
+  {
+    for(uint32_t colour = 0u; colour < 256u; ++colour)
+    {
+      pixels.insert(pixels.end(), {uint8_t(colour), uint8_t(255u - colour), uint8_t(colour), uint8_t(alpha)});
+    }
+  }
+  std::vector<uint8_t> expected(pixels.size());
+  for(uint32_t i = 0u; i < pixels.size(); i += 4u)
+  {
+    ReferencePremultiplyAlpha(&expected[i], &pixels[i]);
+  }
+  PremultiplyAlpha(pixels.data(), pixels.data(), static_cast<uint32_t>(pixels.size() / 4u));
+  DALI_TEST_CHECK(pixels == expected);
+
+  END_TEST;
+}
+
+int UtcDaliInternalPixelConversionLuminanceToRgbaP(void)
+{
+  DALI_TEST_CHECK(CheckConversion(1u, ConvertLuminanceToRgba, ReferenceLuminanceToRgba));
+  END_TEST;
+}
+
+int UtcDaliInternalPixelConversionLuminanceAlphaToRgbaP(void)
+{
+  DALI_TEST_CHECK(CheckConversion(2u, ConvertLuminanceAlphaToRgba, ReferenceLuminanceAlphaToRgba));
+  END_TEST;
+}
+
+namespace
+{
+Internal::PixelDataPtr CreateRgbPixelData(uint32_t width, uint32_t height)
+{
+  const uint32_t size   = width * height * 3u;
+  uint8_t*       buffer = new uint8_t[size];
+  for(uint32_t i = 0u; i < size; ++i)
+  {
+    buffer[i] = static_cast<uint8_t>(i * 7u);
+  }
+  return Internal::PixelData::New(buffer, size, width, height, Pixel::RGB888, Dali::PixelData::DELETE_ARRAY);
+}
+
+bool CheckUpload(Internal::PixelData& source, Internal::PixelData& converted)
+{
+  const uint32_t pixelCount = source.GetWidth() * source.GetHeight();
+  if(converted.GetPixelFormat() != Pixel::RGBA8888 || converted.GetBufferSize() != pixelCount * 4u)
+  {
+    return false;
+  }
+
+  std::vector<uint8_t> expected(pixelCount * 4u);
+  for(uint32_t i = 0u; i < pixelCount; ++i)
+  {
+    ReferenceRgbToRgba(expected.data() + i * 4u, source.GetBuffer() + i * 3u);
+  }
+  return std::equal(expected.begin(), expected.end(), converted.GetBuffer());
+}
+
+} // namespace
+
+int UtcDaliInternalPixelConversionUploadConverterRecycleP(void)
+{
+  tet_infoline("Test that a staging buffer is reused once the converted pixel data has been released");
+
+  UploadConverter converter;
+
+  Internal::PixelDataPtr source    = CreateRgbPixelData(16u, 8u);
+  Internal::PixelDataPtr converted = converter.Convert(source);
+  converter.Wait();
+  DALI_TEST_CHECK(CheckUpload(*source, *converted));
+
+  // The buffer is still referenced, as if the render thread had not uploaded it yet
+  const uint8_t*         buffer = converted->GetBuffer();
+  Internal::PixelDataPtr second = converter.Convert(source);
+  converter.Wait();
+  DALI_TEST_CHECK(second->GetBuffer() != buffer);
+
+  converted.Reset();
+  converter.Wait();
+
+  // A different size needs a new buffer
+  Internal::PixelDataPtr otherSource = CreateRgbPixelData(8u, 8u);
+  Internal::PixelDataPtr other       = converter.Convert(otherSource);
+  converter.Wait();
+  DALI_TEST_CHECK(other->GetBuffer() != buffer);
+  DALI_TEST_CHECK(CheckUpload(*otherSource, *other));
+
+  Internal::PixelDataPtr third = converter.Convert(source);
+  converter.Wait();
+  DALI_TEST_CHECK(third->GetBuffer() == buffer);
+  DALI_TEST_CHECK(CheckUpload(*source, *third));
+
+  END_TEST;
+}
+
+int UtcDaliInternalPixelConversionUploadConverterThreadPoolP(void)
+{
+  tet_infoline("Test that images converted in the worker threads, split between them or not, are complete after Wait()");
+
+  Dali::ThreadPool threadPool;
+  threadPool.Initialize(2u);
+
+  UploadConverter converter;
+  converter.SetThreadPool(&threadPool);
+
+  Internal::PixelDataPtr largeSource = CreateRgbPixelData(512u, 512u);
+  Internal::PixelDataPtr smallSource = CreateRgbPixelData(33u, 17u);
+  Internal::PixelDataPtr large       = converter.Convert(largeSource);
+  Internal::PixelDataPtr small       = converter.Convert(smallSource);
+  largeSource.Reset();
+  smallSource.Reset();
+  converter.Wait();
+
+  Internal::PixelDataPtr expectedLarge = CreateRgbPixelData(512u, 512u);
+  Internal::PixelDataPtr expectedSmall = CreateRgbPixelData(33u, 17u);
+  DALI_TEST_CHECK(CheckUpload(*expectedLarge, *large));
+  DALI_TEST_CHECK(CheckUpload(*expectedSmall, *small));
+
+  converter.SetThreadPool(nullptr);
+
+  END_TEST;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/public-api/dali-core.h>
+
+#include <algorithm>
+#include <vector>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/radix-sort.h>
+
+using namespace Dali;
+using Dali::Internal::RadixSort;
+using Dali::Internal::RadixSortItem;
+
+void utc_dali_internal_radix_sort_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_radix_sort_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+/**
+ * Simple deterministic random number generator
+ */
+struct TestRandom
+{
+  uint32_t Next()
+  {
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8u;
+  }
+
+  uint32_t seed{12345u};
+};
+
+bool CompareKeys(const RadixSortItem& lhs, const RadixSortItem& rhs)
+{
+  if(lhs.primaryKey == rhs.primaryKey)
+  {
+    return lhs.secondaryKey < rhs.secondaryKey;
+  }
+  return lhs.primaryKey < rhs.primaryKey;
+}
+
+std::vector<uint32_t> GetIndices(const std::vector<RadixSortItem>& items)
+{
+  std::vector<uint32_t> indices;
+  for(const auto& item : items)
+  {
+    indices.push_back(item.index);
+  }
+  return indices;
+}
+
+} // namespace
+
+int UtcDaliInternalRadixSortP(void)
+{
+  TestRandom random;
+
+  // Keys with many duplicates, so the stability is checked too, and with values in every byte
+  std::vector<RadixSortItem> items;
+  for(uint32_t i = 0u; i < 5000u; ++i)
+  {
+    const uint64_t primaryKey   = (uint64_t(random.Next() % 4u) << 56u) | (random.Next() % 16u);
+    const uint64_t secondaryKey = (uint64_t(random.Next() % 8u) << 40u) | (uint64_t(random.Next() % 3u) << 8u);
+    items.push_back({primaryKey, secondaryKey, i});
+  }
+
+  std::vector<RadixSortItem> expected(items);
+  std::stable_sort(expected.begin(), expected.end(), CompareKeys);
+
+  std::vector<RadixSortItem> buffer;
+  RadixSort(items, buffer);
+  DALI_TEST_CHECK(GetIndices(items) == GetIndices(expected));
+
+  // Sorting again does not change anything
+  RadixSort(items, buffer);
+  DALI_TEST_CHECK(GetIndices(items) == GetIndices(expected));
+
+  END_TEST;
+}
+
+int UtcDaliInternalRadixSortSameKeysP(void)
+{
+  std::vector<RadixSortItem> buffer;
+  std::vector<RadixSortItem> items;
+  RadixSort(items, buffer);
+  DALI_TEST_CHECK(items.empty());
+
+  items.push_back({1u, 2u, 0u});
+  RadixSort(items, buffer);
+  DALI_TEST_EQUALS(items[0].index, 0u, TEST_LOCATION);
+
+  // Items with the same keys keep their order
+  for(uint32_t i = 1u; i < 100u; ++i)
+  {
+    items.push_back({1u, 2u, i});
+  }
+  RadixSort(items, buffer);
+  for(uint32_t i = 0u; i < 100u; ++i)
+  {
+    DALI_TEST_EQUALS(items[i].index, i, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
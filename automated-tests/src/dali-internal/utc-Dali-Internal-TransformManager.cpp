@@ -0,0 +1,537 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/public-api/dali-core.h>
+
+// Internal headers are allowed here
+
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/internal/update/manager/transform-manager.h>
+
+using namespace Dali;
+using namespace Dali::Internal::SceneGraph;
+
+void utc_dali_internal_transform_manager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_transform_manager_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+/**
+ * Builds a hierarchy of transforms with a few roots and several levels of children.
+ * The same hierarchy is built when called with the same count.
+ */
+void BuildHierarchy(TransformManager& manager, std::vector<TransformId>& ids, uint32_t count)
+{
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    TransformId id = manager.CreateTransform();
+    ids.push_back(id);
+
+    manager.BakeVector3PropertyValue(id, TRANSFORM_PROPERTY_SIZE, Vector3(10.0f + i % 7, 20.0f, 0.0f));
+    manager.BakeVector3PropertyValue(id, TRANSFORM_PROPERTY_POSITION, Vector3(float(i % 13), float(i % 5), 0.0f));
+    manager.BakeQuaternionPropertyValue(id, Quaternion(Radian(0.01f * float(i % 17)), Vector3::ZAXIS));
+
+    if(i >= 4u)
+    {
+      // Parent to an earlier transform, giving a hierarchy several levels deep
+      manager.SetParent(id, ids[(i - 1u) / 4u]);
+    }
+  }
+
+  // Some transforms don't inherit everything
+  manager.SetInheritScale(ids[count / 2u], false);
+  manager.SetInheritOrientation(ids[count / 3u], false);
+  manager.SetInheritPosition(ids[count / 5u], false);
+}
+
+/**
+ * Builds a scene made of a root, containers which are children of the root, and items which are
+ * children of the containers. Each item has a child of its own.
+ */
+void BuildListScene(TransformManager& manager, std::vector<TransformId>& containers, std::vector<TransformId>& items, uint32_t count)
+{
+  const uint32_t CONTAINER_COUNT = 10u;
+
+  TransformId root = manager.CreateTransform();
+  for(uint32_t i = 0u; i < CONTAINER_COUNT; ++i)
+  {
+    TransformId container = manager.CreateTransform();
+    manager.BakeVector3PropertyValue(container, TRANSFORM_PROPERTY_POSITION, Vector3(0.0f, 100.0f * float(i), 0.0f));
+    manager.SetParent(container, root);
+    containers.push_back(container);
+  }
+
+  for(uint32_t i = 0u; i < count / 2u; ++i)
+  {
+    TransformId item = manager.CreateTransform();
+    manager.BakeVector3PropertyValue(item, TRANSFORM_PROPERTY_POSITION, Vector3(float(i), 0.0f, 0.0f));
+    manager.SetParent(item, containers[i % CONTAINER_COUNT]);
+    items.push_back(item);
+
+    TransformId child = manager.CreateTransform();
+    manager.BakeVector3PropertyValue(child, TRANSFORM_PROPERTY_POSITION, Vector3(0.0f, 1.0f, 0.0f));
+    manager.SetParent(child, item);
+  }
+
+  manager.Update();
+}
+
+} // namespace
+
+int UtcTransformManagerUpdateInParallelP(void)
+{
+  TestApplication application;
+
+  const uint32_t COMPONENT_COUNT = 20000u;
+
+  TransformManager         serialManager;
+  std::vector<TransformId> serialIds;
+  BuildHierarchy(serialManager, serialIds, COMPONENT_COUNT);
+
+  Dali::ThreadPool threadPool;
+  threadPool.Initialize(3u);
+
+  TransformManager         parallelManager;
+  std::vector<TransformId> parallelIds;
+  BuildHierarchy(parallelManager, parallelIds, COMPONENT_COUNT);
+  parallelManager.SetThreadPool(&threadPool);
+
+  DALI_TEST_EQUALS(serialManager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(parallelManager.Update(), true, TEST_LOCATION);
+
+  for(uint32_t i = 0u; i < COMPONENT_COUNT; ++i)
+  {
+    DALI_TEST_EQUALS(parallelManager.GetWorldMatrix(parallelIds[i]), serialManager.GetWorldMatrix(serialIds[i]), 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(parallelManager.GetBoundingSphere(parallelIds[i]), serialManager.GetBoundingSphere(serialIds[i]), 0.001f, TEST_LOCATION);
+  }
+
+  // Change a transform near the root and remove a few transforms, then update again
+  serialManager.SetVector3PropertyValue(serialIds[1], TRANSFORM_PROPERTY_POSITION, Vector3(100.0f, 50.0f, 0.0f));
+  parallelManager.SetVector3PropertyValue(parallelIds[1], TRANSFORM_PROPERTY_POSITION, Vector3(100.0f, 50.0f, 0.0f));
+  for(uint32_t i = COMPONENT_COUNT - 1u; i > COMPONENT_COUNT - 100u; --i)
+  {
+    serialManager.RemoveTransform(serialIds[i]);
+    parallelManager.RemoveTransform(parallelIds[i]);
+  }
+
+  DALI_TEST_EQUALS(serialManager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(parallelManager.Update(), true, TEST_LOCATION);
+
+  for(uint32_t i = 0u; i <= COMPONENT_COUNT - 100u; ++i)
+  {
+    DALI_TEST_EQUALS(parallelManager.GetWorldMatrix(parallelIds[i]), serialManager.GetWorldMatrix(serialIds[i]), 0.001f, TEST_LOCATION);
+  }
+
+  parallelManager.SetThreadPool(nullptr);
+
+  END_TEST;
+}
+
+int UtcTransformManagerUpdateWorkerThreadCountP(void)
+{
+  TestApplication application;
+
+  application.GetCore().SetUpdateWorkerThreadCount(2u);
+
+  // Create enough actors for the transforms to be updated in parallel
+  Actor parent = Actor::New();
+  parent.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  parent.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  parent.SetProperty(Actor::Property::POSITION, Vector3(10.0f, 20.0f, 0.0f));
+  application.GetScene().Add(parent);
+
+  const uint32_t   ACTOR_COUNT = 5000u;
+  std::vector<Actor> actors;
+  for(uint32_t i = 0u; i < ACTOR_COUNT; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    actor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    actor.SetProperty(Actor::Property::POSITION, Vector3(float(i), 1.0f, 0.0f));
+    parent.Add(actor);
+    actors.push_back(actor);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // The world origin is the centre of the scene
+  const Vector3 parentWorldPosition = parent.GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION);
+  const Vector2 sceneSize           = application.GetScene().GetSize();
+  DALI_TEST_EQUALS(parentWorldPosition, Vector3(10.0f - sceneSize.width * 0.5f, 20.0f - sceneSize.height * 0.5f, 0.0f), TEST_LOCATION);
+  for(uint32_t i = 0u; i < ACTOR_COUNT; ++i)
+  {
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION), parentWorldPosition + Vector3(float(i), 1.0f, 0.0f), TEST_LOCATION);
+  }
+
+  // Back to serial updates
+  application.GetCore().SetUpdateWorkerThreadCount(0u);
+  parent.SetProperty(Actor::Property::POSITION, Vector3(0.0f, 0.0f, 0.0f));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actors[ACTOR_COUNT - 1u].GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION), parentWorldPosition - Vector3(10.0f, 20.0f, 0.0f) + Vector3(float(ACTOR_COUNT - 1u), 1.0f, 0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTransformManagerUpdateSkipsUnchangedComponentsP(void)
+{
+  TestApplication application;
+
+  const uint32_t COMPONENT_COUNT = 1000u;
+
+  TransformManager         manager;
+  std::vector<TransformId> ids;
+  BuildHierarchy(manager, ids, COMPONENT_COUNT);
+
+  manager.ResetToBaseValue();
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetSkippedComponentCount(), 0u, TEST_LOCATION);
+
+  // Nothing has changed, so every world matrix is kept
+  manager.ResetToBaseValue();
+  DALI_TEST_EQUALS(manager.Update(), false, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetSkippedComponentCount(), COMPONENT_COUNT, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.IsWorldMatrixDirty(ids[0]), false, TEST_LOCATION);
+
+  // Only the changed leaf is recomputed
+  manager.ResetToBaseValue();
+  manager.BakeVector3PropertyValue(ids[COMPONENT_COUNT - 1u], TRANSFORM_PROPERTY_POSITION, Vector3(5.0f, 5.0f, 0.0f));
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetSkippedComponentCount(), COMPONENT_COUNT - 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.IsWorldMatrixDirty(ids[COMPONENT_COUNT - 1u]), true, TEST_LOCATION);
+
+  // Changing a root recomputes its whole subtree
+  manager.ResetToBaseValue();
+  manager.BakeVector3PropertyValue(ids[0], TRANSFORM_PROPERTY_POSITION, Vector3(20.0f, 10.0f, 0.0f));
+  manager.BakeVector3PropertyValue(ids[0], TRANSFORM_PROPERTY_SIZE, Vector3(30.0f, 30.0f, 0.0f));
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+  DALI_TEST_CHECK(manager.GetSkippedComponentCount() > 0u);
+  DALI_TEST_CHECK(manager.GetSkippedComponentCount() < COMPONENT_COUNT - 1u);
+
+  // The cached and recomputed world matrices match the ones of a manager updated from scratch
+  TransformManager         referenceManager;
+  std::vector<TransformId> referenceIds;
+  BuildHierarchy(referenceManager, referenceIds, COMPONENT_COUNT);
+  referenceManager.SetVector3PropertyValue(referenceIds[COMPONENT_COUNT - 1u], TRANSFORM_PROPERTY_POSITION, Vector3(5.0f, 5.0f, 0.0f));
+  referenceManager.SetVector3PropertyValue(referenceIds[0], TRANSFORM_PROPERTY_POSITION, Vector3(20.0f, 10.0f, 0.0f));
+  referenceManager.SetVector3PropertyValue(referenceIds[0], TRANSFORM_PROPERTY_SIZE, Vector3(30.0f, 30.0f, 0.0f));
+  referenceManager.Update();
+
+  for(uint32_t i = 0u; i < COMPONENT_COUNT; ++i)
+  {
+    DALI_TEST_EQUALS(manager.GetWorldMatrix(ids[i]), referenceManager.GetWorldMatrix(referenceIds[i]), 0.001f, TEST_LOCATION);
+    DALI_TEST_EQUALS(manager.GetBoundingSphere(ids[i]), referenceManager.GetBoundingSphere(referenceIds[i]), 0.001f, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcTransformManagerUpdateDiscardedAnimationP(void)
+{
+  TestApplication application;
+
+  Actor parent = Actor::New();
+  application.GetScene().Add(parent);
+  Actor child = Actor::New();
+  child.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  child.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  parent.Add(child);
+
+  application.SendNotification();
+  application.Render();
+
+  Vector3 worldPosition = child.GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION);
+
+  Animation animation = Animation::New(1.0f);
+  animation.AnimateTo(Property(child, Actor::Property::POSITION), Vector3(100.0f, 100.0f, 0.0f));
+  animation.SetEndAction(Animation::DISCARD);
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(500);
+  DALI_TEST_EQUALS(child.GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION), worldPosition + Vector3(50.0f, 50.0f, 0.0f), TEST_LOCATION);
+
+  // The world position goes back to the base value once the animated value is discarded
+  animation.Stop();
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(child.GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION), worldPosition, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTransformManagerReorderComponentsP(void)
+{
+  TestApplication application;
+
+  const uint32_t COMPONENT_COUNT = 100u;
+
+  // Create the children before their parents, so every component has to move when the manager reorders them
+  TransformManager         manager;
+  std::vector<TransformId> ids;
+  for(uint32_t i = 0u; i < COMPONENT_COUNT; ++i)
+  {
+    TransformId id = manager.CreateTransform();
+    ids.push_back(id);
+    manager.BakeVector3PropertyValue(id, TRANSFORM_PROPERTY_POSITION, Vector3(1.0f, float(i), 0.0f));
+  }
+  for(uint32_t i = 0u; i + 1u < COMPONENT_COUNT; ++i)
+  {
+    manager.SetParent(ids[i], ids[i + 1u]);
+  }
+
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+
+  // The world position is the sum of the positions of the component and its ancestors
+  float y = 0.0f;
+  for(uint32_t i = COMPONENT_COUNT; i > 0u; --i)
+  {
+    y += float(i - 1u);
+    DALI_TEST_EQUALS(manager.GetWorldMatrix(ids[i - 1u]).GetTranslation3(), Vector3(float(COMPONENT_COUNT - i + 1u), y, 0.0f), 0.001f, TEST_LOCATION);
+  }
+
+  // Detach half of the chain, and move the detached root into the other half
+  manager.SetParent(ids[COMPONENT_COUNT / 2u], INVALID_TRANSFORM_ID);
+  manager.SetParent(ids[COMPONENT_COUNT / 2u], ids[COMPONENT_COUNT - 1u]);
+  manager.RemoveTransform(ids[0]);
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+
+  // Component at COMPONENT_COUNT / 2 is now a direct child of the root
+  const Vector3 rootPosition(1.0f, float(COMPONENT_COUNT - 1u), 0.0f);
+  DALI_TEST_EQUALS(manager.GetWorldMatrix(ids[COMPONENT_COUNT / 2u]).GetTranslation3(), rootPosition + Vector3(1.0f, float(COMPONENT_COUNT / 2u), 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetWorldMatrix(ids[COMPONENT_COUNT / 2u - 1u]).GetTranslation3(), rootPosition + Vector3(2.0f, float(COMPONENT_COUNT - 1u), 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetWorldMatrix(ids[COMPONENT_COUNT - 2u]).GetTranslation3(), rootPosition + Vector3(1.0f, float(COMPONENT_COUNT - 2u), 0.0f), 0.001f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTransformManagerReparentSameLevelP(void)
+{
+  TestApplication application;
+
+  TransformManager         manager;
+  std::vector<TransformId> containers;
+  std::vector<TransformId> items;
+  BuildListScene(manager, containers, items, 100u);
+
+  // Move an item to another container at the same depth
+  manager.SetParent(items[3], containers[7]);
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetWorldMatrix(items[3]).GetTranslation3(), Vector3(3.0f, 700.0f, 0.0f), 0.001f, TEST_LOCATION);
+
+  // Move an item under a component created after it, so it has to be moved after its new parent
+  TransformId newContainer = manager.CreateTransform();
+  manager.BakeVector3PropertyValue(newContainer, TRANSFORM_PROPERTY_POSITION, Vector3(0.0f, 2000.0f, 0.0f));
+  manager.SetParent(newContainer, containers[0]);
+  manager.SetParent(items[4], newContainer);
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetWorldMatrix(items[4]).GetTranslation3(), Vector3(4.0f, 2000.0f, 0.0f), 0.001f, TEST_LOCATION);
+
+  // Move an item to the root, so it and its child change level
+  manager.SetParent(items[5], INVALID_TRANSFORM_ID);
+  manager.SetParent(items[6], items[5]);
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetWorldMatrix(items[5]).GetTranslation3(), Vector3(5.0f, 0.0f, 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetWorldMatrix(items[6]).GetTranslation3(), Vector3(11.0f, 0.0f, 0.0f), 0.001f, TEST_LOCATION);
+
+  // The other items are where they were
+  for(uint32_t i = 7u; i < items.size(); ++i)
+  {
+    DALI_TEST_EQUALS(manager.GetWorldMatrix(items[i]).GetTranslation3(), Vector3(float(i), 100.0f * float(i % containers.size()), 0.0f), 0.001f, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcTransformManagerReparentNewLevelP(void)
+{
+  TestApplication application;
+
+  // Large enough for the levels to be updated in parallel
+  const uint32_t ITEM_COUNT = 10000u;
+
+  Dali::ThreadPool threadPool;
+  threadPool.Initialize(3u);
+
+  TransformManager         serialManager;
+  TransformManager         parallelManager;
+  TransformManager*        managers[] = {&serialManager, &parallelManager};
+  std::vector<TransformId> containers;
+  std::vector<TransformId> items;
+  for(TransformManager* manager : managers)
+  {
+    containers.clear();
+    items.clear();
+    BuildListScene(*manager, containers, items, ITEM_COUNT);
+
+    // Move items and their children one level down, and an item to the root
+    for(uint32_t i = 0u; i < 20u; ++i)
+    {
+      manager->SetParent(items[i], items[i + 50u]);
+    }
+    manager->SetParent(items[30], INVALID_TRANSFORM_ID);
+
+    // Move a container and its items two levels down
+    manager->SetParent(containers[1], items[40]);
+
+    // The children of a removed item become roots
+    manager->RemoveTransform(items[60]);
+  }
+  parallelManager.SetThreadPool(&threadPool);
+
+  DALI_TEST_EQUALS(serialManager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(parallelManager.Update(), true, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(serialManager.GetWorldMatrix(items[0]).GetTranslation3(), Vector3(50.0f, 0.0f, 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(serialManager.GetWorldMatrix(items[0] + 1u).GetTranslation3(), Vector3(50.0f, 1.0f, 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(serialManager.GetWorldMatrix(items[10]).GetTranslation3(), Vector3(10.0f, 0.0f, 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(serialManager.GetWorldMatrix(items[30]).GetTranslation3(), Vector3(30.0f, 0.0f, 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(serialManager.GetWorldMatrix(items[71]).GetTranslation3(), Vector3(111.0f, 100.0f, 0.0f), 0.001f, TEST_LOCATION);
+
+  for(uint32_t i = 0u; i < items.size(); ++i)
+  {
+    if(i != 60u)
+    {
+      DALI_TEST_EQUALS(parallelManager.GetWorldMatrix(items[i]), serialManager.GetWorldMatrix(items[i]), 0.001f, TEST_LOCATION);
+    }
+  }
+
+  // Move a container three levels down, which moves too many components to relocate them one by one
+  for(TransformManager* manager : managers)
+  {
+    const TransformId childOfItem44 = items[44] + 1u;
+    manager->SetParent(containers[3], childOfItem44);
+    manager->SetParent(containers[1], containers[0]);
+    manager->SetParent(items[0], containers[2]);
+  }
+  serialManager.Update();
+  parallelManager.Update();
+
+  DALI_TEST_EQUALS(serialManager.GetWorldMatrix(items[0]).GetTranslation3(), Vector3(0.0f, 200.0f, 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(serialManager.GetWorldMatrix(items[71]).GetTranslation3(), Vector3(71.0f, 100.0f, 0.0f), 0.001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(serialManager.GetWorldMatrix(items[73]).GetTranslation3(), Vector3(117.0f, 701.0f, 0.0f), 0.001f, TEST_LOCATION);
+  for(uint32_t i = 0u; i < items.size(); ++i)
+  {
+    if(i != 60u)
+    {
+      DALI_TEST_EQUALS(parallelManager.GetWorldMatrix(items[i]), serialManager.GetWorldMatrix(items[i]), 0.001f, TEST_LOCATION);
+    }
+  }
+
+  parallelManager.SetThreadPool(nullptr);
+
+  END_TEST;
+}
+
+int UtcTransformManagerPublishSubtreeBoundsP(void)
+{
+  TestApplication application;
+
+  TransformManager manager;
+  TransformId      parent = manager.CreateTransform();
+  TransformId      child  = manager.CreateTransform();
+  manager.SetParent(child, parent);
+  manager.BakeVector3PropertyValue(parent, TRANSFORM_PROPERTY_SIZE, Vector3(10.0f, 10.0f, 0.0f));
+  manager.BakeVector3PropertyValue(child, TRANSFORM_PROPERTY_SIZE, Vector3(10.0f, 10.0f, 0.0f));
+  manager.BakeVector3PropertyValue(child, TRANSFORM_PROPERTY_POSITION, Vector3(100.0f, 0.0f, 0.0f));
+  manager.SetSubtreeBoundsEnabled(true);
+  manager.Update();
+
+  // The bounds can only be read once they are published to a buffer
+  Vector3 boundsMin;
+  Vector3 boundsMax;
+  DALI_TEST_CHECK(!manager.GetSubtreeBounds(0u, parent, boundsMin, boundsMax));
+  manager.PublishSubtreeBounds(0u);
+  DALI_TEST_CHECK(!manager.GetSubtreeBounds(1u, parent, boundsMin, boundsMax));
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(0u, parent, boundsMin, boundsMax));
+  const float parentMaxX = boundsMax.x;
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(0u, child, boundsMin, boundsMax));
+  DALI_TEST_EQUALS(parentMaxX, boundsMax.x, 0.001f, TEST_LOCATION);
+
+  // Moving the child only changes the bounds in the buffer they are published to next
+  manager.BakeVector3PropertyValue(child, TRANSFORM_PROPERTY_POSITION, Vector3(200.0f, 0.0f, 0.0f));
+  manager.Update();
+  manager.PublishSubtreeBounds(1u);
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(1u, parent, boundsMin, boundsMax));
+  DALI_TEST_EQUALS(boundsMax.x, parentMaxX + 100.0f, 0.001f, TEST_LOCATION);
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(0u, parent, boundsMin, boundsMax));
+  DALI_TEST_EQUALS(boundsMax.x, parentMaxX, 0.001f, TEST_LOCATION);
+
+  // Disabling the bounds removes them from each buffer as it is published
+  manager.SetSubtreeBoundsEnabled(false);
+  manager.Update();
+  manager.PublishSubtreeBounds(0u);
+  DALI_TEST_CHECK(!manager.GetSubtreeBounds(0u, parent, boundsMin, boundsMax));
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(1u, parent, boundsMin, boundsMax));
+  manager.PublishSubtreeBounds(1u);
+  DALI_TEST_CHECK(!manager.GetSubtreeBounds(1u, parent, boundsMin, boundsMax));
+
+  END_TEST;
+}
+
+int UtcTransformManagerPublishSubtreeBoundsRemovedP(void)
+{
+  TestApplication application;
+
+  TransformManager manager;
+  TransformId      first  = manager.CreateTransform();
+  TransformId      second = manager.CreateTransform();
+  manager.BakeVector3PropertyValue(first, TRANSFORM_PROPERTY_SIZE, Vector3(10.0f, 10.0f, 0.0f));
+  manager.BakeVector3PropertyValue(second, TRANSFORM_PROPERTY_SIZE, Vector3(10.0f, 10.0f, 0.0f));
+  manager.BakeVector3PropertyValue(second, TRANSFORM_PROPERTY_POSITION, Vector3(100.0f, 0.0f, 0.0f));
+  manager.SetSubtreeBoundsEnabled(true);
+  manager.Update();
+  manager.PublishSubtreeBounds(0u);
+
+  Vector3 boundsMin;
+  Vector3 boundsMax;
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(0u, second, boundsMin, boundsMax));
+
+  // The published bounds of a removed component are cleared, so they are not reported for a component reusing its id
+  manager.RemoveTransform(second);
+  manager.Update();
+  manager.PublishSubtreeBounds(1u);
+  TransformId reused = manager.CreateTransform();
+  DALI_TEST_EQUALS(reused, second, TEST_LOCATION);
+  DALI_TEST_CHECK(!manager.GetSubtreeBounds(1u, reused, boundsMin, boundsMax));
+
+  manager.BakeVector3PropertyValue(reused, TRANSFORM_PROPERTY_SIZE, Vector3(10.0f, 10.0f, 0.0f));
+  manager.BakeVector3PropertyValue(reused, TRANSFORM_PROPERTY_POSITION, Vector3(-100.0f, 0.0f, 0.0f));
+  TransformId added = manager.CreateTransform();
+  manager.BakeVector3PropertyValue(added, TRANSFORM_PROPERTY_SIZE, Vector3(10.0f, 10.0f, 0.0f));
+  manager.Update();
+  manager.PublishSubtreeBounds(0u);
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(0u, reused, boundsMin, boundsMax));
+  DALI_TEST_CHECK(boundsMax.x < 0.0f);
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(0u, added, boundsMin, boundsMax));
+  DALI_TEST_CHECK(manager.GetSubtreeBounds(0u, first, boundsMin, boundsMax));
+
+  END_TEST;
+}
@@ -246,6 +246,11 @@ bool TestApplication::GetRenderNeedsPostRender()
   return mRenderStatus.NeedsPostRender();
 }
 
+uint32_t TestApplication::GetRenderQueueSize()
+{
+  return mRenderStatus.GetRenderQueueSize();
+}
+
 bool TestApplication::RenderOnly()
 {
   // Update Time values
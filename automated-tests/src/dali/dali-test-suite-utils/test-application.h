@@ -77,6 +77,7 @@ public:
   void                            ResetContext();
   bool                            GetRenderNeedsUpdate();
   bool                            GetRenderNeedsPostRender();
+  uint32_t                        GetRenderQueueSize();
   uint32_t                        Wait(uint32_t durationToWait);
   static void                     EnableLogging(bool enabled)
   {
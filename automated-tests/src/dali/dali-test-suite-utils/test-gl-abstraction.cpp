@@ -20,6 +20,8 @@
 namespace Dali
 {
 TestGlAbstraction::TestGlAbstraction()
+: mGlesMajorVersion(3),
+  mSubImagesRequireConverting(true)
 {
   Initialize();
 }
@@ -73,6 +75,7 @@ void TestGlAbstraction::Initialize()
   mNumGeneratedTextures   = 0;
   mLastShaderIdUsed       = 0;
   mLastProgramIdUsed      = 0;
+  mLastVertexArrayIdUsed  = 0;
   mLastUniformIdUsed      = 0;
   mLastDepthMask          = false;
 
@@ -92,6 +95,7 @@ void TestGlAbstraction::Initialize()
   mTextureTrace.Reset();
   mTexParamaterTrace.Reset();
   mDrawTrace.Reset();
+  mVertexArrayTrace.Reset();
 
   for(unsigned int i = 0; i < MAX_ATTRIBUTE_CACHE_SIZE; ++i)
   {
@@ -139,7 +143,7 @@ std::string TestGlAbstraction::GetFragmentShaderPrefix()
 
 bool TestGlAbstraction::TextureRequiresConverting(const GLenum imageGlFormat, const GLenum textureGlFormat, const bool isSubImage) const
 {
-  return ((imageGlFormat == GL_RGB) && (textureGlFormat == GL_RGBA));
+  return ((imageGlFormat == GL_RGB) && (textureGlFormat == GL_RGBA) && (mSubImagesRequireConverting || !isSubImage));
 }
 
 } // namespace Dali
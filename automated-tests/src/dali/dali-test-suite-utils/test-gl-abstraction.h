@@ -39,6 +39,7 @@
 namespace Dali
 {
 static const unsigned int MAX_ATTRIBUTE_CACHE_SIZE = 64;
+static const unsigned int UNIFORM_BLOCK_MEMBER_INDEX_BASE = 1000; ///< Active uniform indices of uniform block members start here
 static const char*        mStdAttribs[MAX_ATTRIBUTE_CACHE_SIZE] =
   {
     "aPosition",    // ATTRIB_POSITION
@@ -248,6 +249,15 @@ public:
   inline void BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) override
   {
     mBufferSubDataCalls.push_back(size);
+
+    if(target == GL_UNIFORM_BUFFER)
+    {
+      if(mUniformBufferData.size() < static_cast<size_t>(offset + size))
+      {
+        mUniformBufferData.resize(offset + size);
+      }
+      memcpy(&mUniformBufferData[offset], data, size);
+    }
   }
 
   inline GLenum CheckFramebufferStatus(GLenum target) override
@@ -727,6 +737,16 @@ public:
         *size   = 1;
         break;
       default:
+        if(index >= UNIFORM_BLOCK_MEMBER_INDEX_BASE)
+        {
+          const UniformBlockMember* member = GetUniformBlockMember(index);
+          if(member)
+          {
+            *length = snprintf(name, bufsize, "%s", member->name.c_str());
+            *type   = GL_FLOAT_VEC4;
+            *size   = 1;
+          }
+        }
         break;
     }
   }
@@ -788,6 +808,12 @@ public:
       case GL_PROGRAM_BINARY_FORMATS_OES:
         *params = mBinaryFormats;
         break;
+      case GL_MAJOR_VERSION:
+        *params = mGlesMajorVersion;
+        break;
+      case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+        *params = 256;
+        break;
     }
   }
 
@@ -807,6 +833,9 @@ public:
       case GL_ACTIVE_UNIFORM_MAX_LENGTH:
         *params = 100;
         break;
+      case GL_ACTIVE_UNIFORM_BLOCKS:
+        *params = static_cast<GLint>(mUniformBlocks.size());
+        break;
     }
   }
 
@@ -1182,6 +1211,7 @@ public:
     namedParams["yoffset"] = ToString(yoffset);
     namedParams["width"]   = ToString(width);
     namedParams["height"]  = ToString(height);
+    namedParams["format"]  = ToString(format);
     mTextureTrace.PushCall("TexSubImage2D", out.str(), namedParams);
   }
 
@@ -1458,6 +1488,12 @@ public:
 
   inline void VertexAttribPointer(GLuint indx, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* ptr) override
   {
+    std::stringstream out;
+    out << indx << ", " << size << ", " << type << ", " << stride;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["index"] = ToString(indx);
+    namedParams["size"]  = ToString(size);
+    mVertexArrayTrace.PushCall("VertexAttribPointer", out.str(), namedParams);
   }
 
   inline void Viewport(GLint x, GLint y, GLsizei width, GLsizei height) override
@@ -1587,14 +1623,36 @@ public:
 
   inline void BindVertexArray(GLuint array) override
   {
+    std::stringstream out;
+    out << array;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["array"] = ToString(array);
+    mVertexArrayTrace.PushCall("BindVertexArray", out.str(), namedParams);
   }
 
   inline void DeleteVertexArrays(GLsizei n, const GLuint* arrays) override
   {
+    for(int i = 0; i < n; i++)
+    {
+      std::stringstream out;
+      out << arrays[i];
+      TraceCallStack::NamedParams namedParams;
+      namedParams["array"] = ToString(arrays[i]);
+      mVertexArrayTrace.PushCall("DeleteVertexArrays", out.str(), namedParams);
+    }
   }
 
   inline void GenVertexArrays(GLsizei n, GLuint* arrays) override
   {
+    for(int i = 0; i < n; i++)
+    {
+      arrays[i] = ++mLastVertexArrayIdUsed;
+      std::stringstream out;
+      out << arrays[i];
+      TraceCallStack::NamedParams namedParams;
+      namedParams["array"] = ToString(arrays[i]);
+      mVertexArrayTrace.PushCall("GenVertexArrays", out.str(), namedParams);
+    }
   }
 
   inline GLboolean IsVertexArray(GLuint array) override
@@ -1616,6 +1674,10 @@ public:
 
   inline void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) override
   {
+    if(target == GL_UNIFORM_BUFFER)
+    {
+      mUniformBufferBindings[index] = offset;
+    }
   }
 
   inline void BindBufferBase(GLenum target, GLuint index, GLuint buffer) override
@@ -1730,19 +1792,65 @@ public:
 
   inline void GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params) override
   {
+    for(GLsizei i = 0; i < uniformCount; ++i)
+    {
+      const UniformBlockMember* member = GetUniformBlockMember(uniformIndices[i]);
+      if(member)
+      {
+        switch(pname)
+        {
+          case GL_UNIFORM_OFFSET:
+            params[i] = member->offset;
+            break;
+          case GL_UNIFORM_MATRIX_STRIDE:
+            params[i] = member->matrixStride;
+            break;
+        }
+      }
+    }
   }
 
   inline GLuint GetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName) override
   {
+    for(size_t i = 0; i < mUniformBlocks.size(); ++i)
+    {
+      if(mUniformBlocks[i].name == uniformBlockName)
+      {
+        return static_cast<GLuint>(i);
+      }
+    }
     return GL_INVALID_INDEX;
   }
 
   inline void GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params) override
   {
+    if(uniformBlockIndex < mUniformBlocks.size())
+    {
+      const UniformBlock& block = mUniformBlocks[uniformBlockIndex];
+      switch(pname)
+      {
+        case GL_UNIFORM_BLOCK_DATA_SIZE:
+          *params = block.size;
+          break;
+        case GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS:
+          *params = static_cast<GLint>(block.members.size());
+          break;
+        case GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES:
+          for(size_t i = 0; i < block.members.size(); ++i)
+          {
+            params[i] = static_cast<GLint>(UNIFORM_BLOCK_MEMBER_INDEX_BASE + uniformBlockIndex * UNIFORM_BLOCK_MEMBER_INDEX_BASE + i);
+          }
+          break;
+      }
+    }
   }
 
   inline void GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName) override
   {
+    if(uniformBlockIndex < mUniformBlocks.size())
+    {
+      *length = snprintf(uniformBlockName, bufSize, "%s", mUniformBlocks[uniformBlockIndex].name.c_str());
+    }
   }
 
   inline void UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) override
@@ -1751,10 +1859,26 @@ public:
 
   inline void DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount) override
   {
+    std::stringstream out;
+    out << mode << ", " << first << ", " << count << ", " << instanceCount;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["mode"]          = ToString(mode);
+    namedParams["first"]         = ToString(first);
+    namedParams["count"]         = ToString(count);
+    namedParams["instanceCount"] = ToString(instanceCount);
+    mDrawTrace.PushCall("DrawArraysInstanced", out.str(), namedParams);
   }
 
   inline void DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instanceCount) override
   {
+    std::stringstream out;
+    out << mode << ", " << count << ", " << type << ", indices, " << instanceCount;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["mode"]          = ToString(mode);
+    namedParams["count"]         = ToString(count);
+    namedParams["type"]          = ToString(type);
+    namedParams["instanceCount"] = ToString(instanceCount);
+    mDrawTrace.PushCall("DrawElementsInstanced", out.str(), namedParams);
   }
 
   inline GLsync FenceSync(GLenum condition, GLbitfield flags) override
@@ -1991,6 +2115,70 @@ public: // TEST FUNCTIONS
   {
     mProgramBinaryLength = length;
   }
+  inline void SetGlesMajorVersion(GLint version)
+  {
+    // Not reset by Initialize(), so the version can be changed before ResetContext()
+    mGlesMajorVersion = version;
+  }
+  inline void SetSubImagesRequireConverting(bool required)
+  {
+    // As with GLES 3 drivers, which convert RGB sub-images to RGBA textures themselves
+    mSubImagesRequireConverting = required;
+  }
+
+  struct UniformBlockMember
+  {
+    std::string name;
+    GLint       offset;
+    GLint       matrixStride;
+  };
+
+  struct UniformBlock
+  {
+    std::string                     name;
+    GLint                           size;
+    std::vector<UniformBlockMember> members;
+  };
+
+  inline void SetActiveUniformBlocks(const std::vector<UniformBlock>& uniformBlocks)
+  {
+    // Reported for every program linked afterwards
+    mUniformBlocks = uniformBlocks;
+  }
+
+  inline const std::vector<uint8_t>& GetUniformBufferData() const
+  {
+    return mUniformBufferData;
+  }
+
+  inline GLintptr GetUniformBufferBinding(GLuint index) const
+  {
+    auto iter = mUniformBufferBindings.find(index);
+    return iter != mUniformBufferBindings.end() ? iter->second : -1;
+  }
+
+  inline const UniformBlockMember* GetUniformBlockMember(GLuint uniformIndex) const
+  {
+    const size_t blockIndex  = uniformIndex / UNIFORM_BLOCK_MEMBER_INDEX_BASE - 1;
+    const size_t memberIndex = uniformIndex % UNIFORM_BLOCK_MEMBER_INDEX_BASE;
+    if(uniformIndex < UNIFORM_BLOCK_MEMBER_INDEX_BASE || blockIndex >= mUniformBlocks.size() || memberIndex >= mUniformBlocks[blockIndex].members.size())
+    {
+      return nullptr;
+    }
+    return &mUniformBlocks[blockIndex].members[memberIndex];
+  }
+
+  template<typename T>
+  inline bool GetUniformBlockValue(GLuint binding, GLint offset, T& value) const
+  {
+    const GLintptr blockOffset = GetUniformBufferBinding(binding);
+    if(blockOffset < 0 || mUniformBufferData.size() < static_cast<size_t>(blockOffset + offset) + sizeof(T))
+    {
+      return false;
+    }
+    memcpy(static_cast<void*>(&value), &mUniformBufferData[blockOffset + offset], sizeof(T));
+    return true;
+  }
 
   inline bool GetVertexAttribArrayState(GLuint index)
   {
@@ -2164,6 +2352,20 @@ public: // TEST FUNCTIONS
     return mViewportTrace;
   }
 
+  //Methods for vertex array and vertex attribute pointer verification
+  inline void EnableVertexArrayCallTrace(bool enable)
+  {
+    mVertexArrayTrace.Enable(enable);
+  }
+  inline void ResetVertexArrayCallStack()
+  {
+    mVertexArrayTrace.Reset();
+  }
+  inline TraceCallStack& GetVertexArrayTrace()
+  {
+    return mVertexArrayTrace;
+  }
+
   template<typename T>
   inline bool GetUniformValue(const char* name, T& value) const
   {
@@ -2392,6 +2594,11 @@ private:
   GLint                                 mNumBinaryFormats;
   GLint                                 mBinaryFormats;
   GLint                                 mProgramBinaryLength;
+  GLint                                 mGlesMajorVersion;
+  bool                                  mSubImagesRequireConverting;
+  std::vector<UniformBlock>             mUniformBlocks;
+  std::vector<uint8_t>                  mUniformBufferData;
+  std::map<GLuint, GLintptr>            mUniformBufferBindings;
   bool                                  mVertexAttribArrayState[MAX_ATTRIBUTE_CACHE_SIZE];
   bool                                  mVertexAttribArrayChanged; // whether the vertex attrib array has been changed
   bool                                  mGetProgramBinaryCalled;
@@ -2437,10 +2644,12 @@ private:
   TraceCallStack mScissorTrace;
   TraceCallStack mSetUniformTrace;
   TraceCallStack mViewportTrace;
+  TraceCallStack mVertexArrayTrace;
 
   // Shaders & Uniforms
   GLuint                                 mLastShaderIdUsed;
   GLuint                                 mLastProgramIdUsed;
+  GLuint                                 mLastVertexArrayIdUsed;
   GLuint                                 mLastUniformIdUsed;
   typedef std::map<std::string, GLint>   UniformIDMap;
   typedef std::map<GLuint, UniformIDMap> ProgramUniformMap;
@@ -76,7 +76,12 @@ Integration::BitmapPtr TestPlatformAbstraction::DecodeBuffer(const Integration::
 
 bool TestPlatformAbstraction::LoadShaderBinaryFile(const std::string& filename, Dali::Vector<unsigned char>& buffer) const
 {
-  mTrace.PushCall("LoadShaderBinaryFile", "");
+  mTrace.PushCall("LoadShaderBinaryFile", filename);
+  if(GetSavedFile(filename, buffer))
+  {
+    return true;
+  }
+
   if(mLoadFileResult.loadResult)
   {
     buffer = mLoadFileResult.buffer;
@@ -85,6 +90,31 @@ bool TestPlatformAbstraction::LoadShaderBinaryFile(const std::string& filename,
   return mLoadFileResult.loadResult;
 }
 
+bool TestPlatformAbstraction::SaveShaderBinaryFile(const std::string& filename, const unsigned char* buffer, unsigned int numBytes) const
+{
+  mTrace.PushCall("SaveShaderBinaryFile", filename);
+
+  Dali::Vector<unsigned char>& file = mSavedFiles[filename];
+  file.Resize(numBytes);
+  if(numBytes > 0u)
+  {
+    memcpy(file.Begin(), buffer, numBytes);
+  }
+  return true;
+}
+
+bool TestPlatformAbstraction::GetSavedFile(const std::string& filename, Dali::Vector<unsigned char>& buffer) const
+{
+  auto iter = mSavedFiles.find(filename);
+  if(iter == mSavedFiles.end())
+  {
+    return false;
+  }
+
+  buffer = iter->second;
+  return true;
+}
+
 /** Call this every test */
 void TestPlatformAbstraction::Initialize()
 {
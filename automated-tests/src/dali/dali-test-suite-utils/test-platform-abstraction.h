@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #include <cstring>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -85,10 +86,7 @@ public:
   /**
    * @copydoc PlatformAbstraction::SaveShaderBinaryFile()
    */
-  virtual bool SaveShaderBinaryFile(const std::string& filename, const unsigned char* buffer, unsigned int numBytes) const override
-  {
-    return true;
-  }
+  bool SaveShaderBinaryFile(const std::string& filename, const unsigned char* buffer, unsigned int numBytes) const override;
 
   /**
    * @copydoc PlatformAbstraction::StartTimer()
@@ -162,6 +160,14 @@ public: // TEST FUNCTIONS
    */
   void SetSaveFileResult(bool result);
 
+  /**
+   * @brief Retrieves a file saved by SaveShaderBinaryFile; LoadShaderBinaryFile returns the saved files too.
+   * @param[in] filename The name of the file
+   * @param[out] buffer The contents of the file
+   * @return true if the file has been saved
+   */
+  bool GetSavedFile(const std::string& filename, Dali::Vector<unsigned char>& buffer) const;
+
   /**
    * @brief Sets the resource loaded by LoadResourceSynchronously
    * @param[in] resource The loaded resource
@@ -202,6 +208,8 @@ private:
   LoadFileResult mLoadFileResult;
   bool           mSaveFileResult;
 
+  mutable std::map<std::string, Dali::Vector<unsigned char>> mSavedFiles;
+
   Integration::ResourcePointer mSynchronouslyLoadedResource;
   Integration::BitmapPtr       mDecodedBitmap;
 
@@ -8310,6 +8310,73 @@ int UtcDaliActorTouchAreaPropertyN(void)
   END_TEST;
 }
 
+int UtcDaliActorDestroyManyP(void)
+{
+  TestApplication application;
+  const uint32_t  childCount = application.GetScene().GetRootLayer().GetChildCount();
+
+  const uint32_t     actorCount = 100u;
+  std::vector<Actor> actors;
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    Actor actor = Actor::New();
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  // Destroy every third actor, the remaining ones must still be updated when they change
+  for(uint32_t i = 0u; i < actorCount; i += 3u)
+  {
+    actors[i].Unparent();
+    actors[i].Reset();
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    if(actors[i])
+    {
+      actors[i].SetProperty(Actor::Property::COLOR, Vector4(float(i) / float(actorCount), 0.0f, 0.0f, 1.0f));
+    }
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    if(actors[i])
+    {
+      DALI_TEST_EQUALS(actors[i].GetCurrentProperty<Vector4>(Actor::Property::WORLD_COLOR), Vector4(float(i) / float(actorCount), 0.0f, 0.0f, 1.0f), TEST_LOCATION);
+    }
+  }
+
+  // The remaining actors can be destroyed while they are dirty
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    if(actors[i])
+    {
+      actors[i].SetProperty(Actor::Property::COLOR, Color::BLUE);
+      actors[i].Unparent();
+      actors[i].Reset();
+    }
+  }
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(application.GetScene().GetRootLayer().GetChildCount(), childCount, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliActorLowerBelowNegative(void)
 {
   TestApplication application;
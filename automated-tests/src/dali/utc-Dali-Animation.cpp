@@ -13825,6 +13825,152 @@ int UtcDaliAnimationCountAndGetAnimationAt(void)
   END_TEST;
 }
 
+int UtcDaliAnimationAnimateManyActorsP(void)
+{
+  TestApplication application;
+
+  // Animators of the whole position, scale and size are updated together, others one by one
+  const uint32_t     actorCount = 50u;
+  std::vector<Actor> actors;
+  Animation          animation = Animation::New(1.0f);
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector3(10.0f, 10.0f, 10.0f));
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+
+    animation.AnimateTo(Property(actor, Actor::Property::POSITION), Vector3(100.0f, 200.0f, float(i)), AlphaFunction::EASE_IN);
+    animation.AnimateBy(Property(actor, Actor::Property::SCALE), Vector3(1.0f, 2.0f, 3.0f), AlphaFunction::EASE_OUT);
+    animation.AnimateTo(Property(actor, Actor::Property::SIZE), Vector3(20.0f, 30.0f, 40.0f), AlphaFunction::LINEAR, TimePeriod(0.5f, 0.5f));
+  }
+
+  // The first actor also has an animator of one component, which must still be applied after the whole position
+  animation.AnimateTo(Property(actors[0], Actor::Property::POSITION_X), 50.0f, AlphaFunction::LINEAR);
+
+  // The second actor has an animator of another property
+  animation.AnimateTo(Property(actors[1], Actor::Property::COLOR_ALPHA), 0.0f, AlphaFunction::LINEAR);
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(0);
+  application.SendNotification();
+  application.Render(500);
+
+  const float easeIn  = 0.125f;
+  const float easeOut = 0.875f;
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    const Vector3 position = actors[i].GetCurrentProperty<Vector3>(Actor::Property::POSITION);
+    const float   x        = (i == 0u) ? 100.0f * easeIn + (50.0f - 100.0f * easeIn) * 0.5f : 100.0f * easeIn;
+    DALI_TEST_EQUALS(position, Vector3(x, 200.0f * easeIn, float(i) * easeIn), TEST_LOCATION);
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty<Vector3>(Actor::Property::SCALE), Vector3(1.0f + easeOut, 1.0f + 2.0f * easeOut, 1.0f + 3.0f * easeOut), TEST_LOCATION);
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty<Vector3>(Actor::Property::SIZE), Vector3(10.0f, 10.0f, 10.0f), TEST_LOCATION);
+  }
+  DALI_TEST_EQUALS(actors[1].GetCurrentProperty<float>(Actor::Property::COLOR_ALPHA), 0.5f, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render(250);
+
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty<Vector3>(Actor::Property::SIZE), Vector3(15.0f, 20.0f, 25.0f), TEST_LOCATION);
+  }
+
+  application.SendNotification();
+  application.Render(250 + 1);
+  application.SendNotification();
+  application.Render(0);
+
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    const float x = (i == 0u) ? 50.0f : 100.0f;
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(x, 200.0f, float(i)), TEST_LOCATION);
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty<Vector3>(Actor::Property::SCALE), Vector3(2.0f, 3.0f, 4.0f), TEST_LOCATION);
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty<Vector3>(Actor::Property::SIZE), Vector3(20.0f, 30.0f, 40.0f), TEST_LOCATION);
+  }
+
+  // Removing an actor while the animation is playing leaves the others animating
+  animation.Play();
+  application.GetScene().Remove(actors[2]);
+  actors[2].Reset();
+
+  application.SendNotification();
+  application.Render(0);
+  application.SendNotification();
+  application.Render(500);
+
+  DALI_TEST_EQUALS(actors[3].GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(100.0f, 200.0f, 3.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliAnimationAnimateStaggeredP(void)
+{
+  TestApplication application;
+
+  // Each animator starts when the previous one ends
+  const uint32_t     actorCount = 10u;
+  std::vector<Actor> actors;
+  Animation          animation = Animation::New(float(actorCount));
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    Actor actor = Actor::New();
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+
+    // Added in reverse order of their start times
+    const uint32_t start = actorCount - 1u - i;
+    animation.AnimateTo(Property(actor, Actor::Property::POSITION_X), 100.0f, AlphaFunction::LINEAR, TimePeriod(float(start), 1.0f));
+  }
+  animation.SetLooping(true);
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(0);
+
+  for(uint32_t frame = 0u; frame < 3u * actorCount; ++frame)
+  {
+    application.SendNotification();
+    application.Render(500);
+
+    // The animation only loops once the time has passed its end
+    const uint32_t halfSeconds = (frame + 1u) % (2u * actorCount);
+    const float    elapsed     = (halfSeconds == 0u) ? float(actorCount) : float(halfSeconds) * 0.5f;
+    for(uint32_t i = 0u; i < actorCount; ++i)
+    {
+      const float start = float(actorCount - 1u - i);
+      const float x     = 100.0f * Clamp(elapsed - start, 0.0f, 1.0f);
+      DALI_TEST_EQUALS(actors[i].GetCurrentProperty<float>(Actor::Property::POSITION_X), x, TEST_LOCATION);
+    }
+  }
+
+  // Played backwards, the animators stop again in turn
+  animation.SetLooping(false);
+  animation.SetSpeedFactor(-1.0f);
+  animation.SetCurrentProgress(0.95f);
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(0);
+
+  for(uint32_t frame = 0u; frame < actorCount - 1u; ++frame)
+  {
+    application.SendNotification();
+    application.Render(1000);
+
+    const float elapsed = float(actorCount) * 0.95f - float(frame + 1u);
+    for(uint32_t i = 0u; i < actorCount; ++i)
+    {
+      const float start = float(actorCount - 1u - i);
+      const float x     = 100.0f * Clamp(elapsed - start, 0.0f, 1.0f);
+      DALI_TEST_EQUALS(actors[i].GetCurrentProperty<float>(Actor::Property::POSITION_X), x, TEST_LOCATION);
+    }
+  }
+
+  END_TEST;
+}
+
 int UtcDaliAnimationSetLoopingNegative(void)
 {
   TestApplication application;
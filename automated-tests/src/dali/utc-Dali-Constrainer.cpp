@@ -17,6 +17,7 @@
 
 #include <dali-test-suite-utils.h>
 #include <dali/devel-api/animation/path-constrainer.h>
+#include <dali/devel-api/animation/path-devel.h>
 #include <dali/public-api/dali-core.h>
 #include <stdlib.h>
 
@@ -171,6 +172,79 @@ int UtcPathConstrainerApply(void)
   END_TEST;
 }
 
+int UtcPathConstrainerArcLengthSamples(void)
+{
+  TestApplication application;
+
+  Dali::Actor     actor = Dali::Actor::New();
+  Property::Index index = actor.RegisterProperty("t", 0.0f);
+  application.GetScene().Add(actor);
+
+  Dali::Path path = Dali::Path::New();
+  SetupPath(path);
+  path.SetProperty(DevelPath::Property::ARC_LENGTH_SAMPLES, 64);
+
+  Dali::PathConstrainer pathConstrainer = Dali::PathConstrainer::New();
+  SetupPathConstrainer(pathConstrainer);
+  pathConstrainer.SetProperty(Dali::PathConstrainer::Property::ARC_LENGTH_SAMPLES, 64);
+  DALI_TEST_EQUALS(pathConstrainer.GetProperty<int>(Dali::PathConstrainer::Property::ARC_LENGTH_SAMPLES), 64, TEST_LOCATION);
+
+  pathConstrainer.Apply(Property(actor, Dali::Actor::Property::POSITION), Property(actor, index), Vector2(0.0f, 1.0f));
+
+  for(float t = 0.0f; t <= 1.0f; t += 0.25f)
+  {
+    actor.SetProperty(index, t);
+    application.SendNotification();
+    application.Render(16);
+
+    Vector3 position, tangent;
+    path.Sample(t, position, tangent);
+    DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), position, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcPathConstrainerChangePointsAfterApply(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that constraints without arc length sampling follow changes of the path after they are applied");
+
+  Dali::Actor     actor = Dali::Actor::New();
+  Property::Index index = actor.RegisterProperty("t", 0.0f);
+  application.GetScene().Add(actor);
+
+  Dali::PathConstrainer pathConstrainer = Dali::PathConstrainer::New();
+  SetupPathConstrainer(pathConstrainer);
+  pathConstrainer.Apply(Property(actor, Dali::Actor::Property::POSITION), Property(actor, index), Vector2(0.0f, 1.0f));
+
+  application.SendNotification();
+  application.Render(16);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(30.0f, 80.0f, 0.0f), TEST_LOCATION);
+
+  Dali::Property::Array points;
+  points.Resize(3);
+  points[0] = Vector3(10.0, 20.0, 0.0);
+  points[1] = Vector3(70.0, 120.0, 0.0);
+  points[2] = Vector3(100.0, 100.0, 0.0);
+  pathConstrainer.SetProperty(Dali::PathConstrainer::Property::POINTS, points);
+
+  application.SendNotification();
+  application.Render(16);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(10.0f, 20.0f, 0.0f), TEST_LOCATION);
+
+  // The table is not built for the constraint applied without it, which keeps sampling per segment
+  pathConstrainer.SetProperty(Dali::PathConstrainer::Property::ARC_LENGTH_SAMPLES, 64);
+  actor.SetProperty(index, 1.0f);
+
+  application.SendNotification();
+  application.Render(16);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(100.0f, 100.0f, 0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcPathConstrainerApplyRange(void)
 {
   TestApplication application;
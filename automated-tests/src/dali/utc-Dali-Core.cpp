@@ -22,6 +22,7 @@
 #include <cmath> // isfinite
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 using namespace Dali;
 
@@ -50,3 +51,49 @@ int UtcDaliCoreGetObjectRegistry(void)
   DALI_TEST_CHECK(application.GetCore().GetObjectRegistry());
   END_TEST;
 }
+
+int UtcDaliCoreTrimMemoryPools(void)
+{
+  TestApplication application;
+  tet_infoline("Testing Dali::Integration::Core::TrimMemoryPools");
+
+  // Grow the node pool well beyond its first blocks
+  std::vector<Actor> actors;
+  for(int i = 0; i < 5000; ++i)
+  {
+    Actor actor = Actor::New();
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+  }
+  application.SendNotification();
+  application.Render();
+
+  for(auto& actor : actors)
+  {
+    actor.Unparent();
+  }
+  actors.clear();
+
+  // The nodes are discarded once the update thread can no longer be using them
+  for(int i = 0; i < 3; ++i)
+  {
+    application.SendNotification();
+    application.Render();
+  }
+
+  uint32_t released = application.GetCore().TrimMemoryPools();
+  tet_printf("%u bytes released\n", released);
+  DALI_TEST_GREATER(released, 0u, TEST_LOCATION);
+
+  // Nothing is left to release
+  DALI_TEST_EQUALS(application.GetCore().TrimMemoryPools(), 0u, TEST_LOCATION);
+
+  // The pools still work after trimming
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK(actor.GetProperty<bool>(Actor::Property::CONNECTED_TO_SCENE));
+
+  END_TEST;
+}
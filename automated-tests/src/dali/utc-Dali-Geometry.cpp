@@ -598,6 +598,204 @@ int UtcDaliGeometrySetGetGeometryType02(void)
   END_TEST;
 }
 
+int UtcDaliGeometryVertexArrayObjectP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the vertex attributes of a geometry are set up once in a vertex array object");
+
+  VertexBuffer vertexBuffer = CreateVertexBuffer("aPosition", "aTexCoord");
+
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+
+  Shader   shader   = CreateShader();
+  Renderer renderer = Renderer::New(geometry, shader);
+  Actor    actor    = Actor::New();
+  actor.SetProperty(Actor::Property::SIZE, Vector3::ONE * 100.f);
+  actor.AddRenderer(renderer);
+  application.GetScene().Add(actor);
+
+  TestGlAbstraction& glAbstraction    = application.GetGlAbstraction();
+  TraceCallStack&    vertexArrayTrace = glAbstraction.GetVertexArrayTrace();
+  TraceCallStack&    drawTrace        = glAbstraction.GetDrawTrace();
+  vertexArrayTrace.Enable(true);
+  drawTrace.Enable(true);
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawArrays"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("GenVertexArrays"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("VertexAttribPointer"), 2, TEST_LOCATION);
+
+  // Draw again, the vertex array object is bound instead of setting up the attributes
+  vertexArrayTrace.Reset();
+  drawTrace.Reset();
+  actor.SetProperty(Actor::Property::POSITION, Vector2(10.0f, 10.0f));
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawArrays"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("GenVertexArrays"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("VertexAttribPointer"), 0, TEST_LOCATION);
+  DALI_TEST_CHECK(vertexArrayTrace.FindMethodAndParams("BindVertexArray", "1"));
+  DALI_TEST_CHECK(vertexArrayTrace.FindMethodAndParams("BindVertexArray", "0"));
+
+  // Setting the indices replaces the vertex array object, which holds the index buffer binding
+  vertexArrayTrace.Reset();
+  drawTrace.Reset();
+  const unsigned short indexData[6] = {0, 3, 1, 0, 2, 3};
+  geometry.SetIndexBuffer(indexData, sizeof(indexData) / sizeof(indexData[0]));
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 1, TEST_LOCATION);
+  DALI_TEST_CHECK(vertexArrayTrace.FindMethodAndParams("DeleteVertexArrays", "1"));
+  DALI_TEST_CHECK(vertexArrayTrace.FindMethodAndParams("GenVertexArrays", "2"));
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("VertexAttribPointer"), 2, TEST_LOCATION);
+
+  // Adding a vertex buffer replaces it as well
+  vertexArrayTrace.Reset();
+  Property::Map colorFormat;
+  colorFormat["aColor"] = Property::VECTOR4;
+  VertexBuffer colorBuffer = VertexBuffer::New(colorFormat);
+  Vector4      colors[4]   = {Color::RED, Color::GREEN, Color::BLUE, Color::WHITE};
+  colorBuffer.SetData(colors, 4);
+  geometry.AddVertexBuffer(colorBuffer);
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_CHECK(vertexArrayTrace.FindMethodAndParams("DeleteVertexArrays", "2"));
+  DALI_TEST_CHECK(vertexArrayTrace.FindMethodAndParams("GenVertexArrays", "3"));
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("VertexAttribPointer"), 3, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGeometryVertexArrayObjectDeletedWithGeometryP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the vertex array object of a geometry is deleted with the geometry");
+
+  VertexBuffer vertexBuffer = CreateVertexBuffer("aPosition", "aTexCoord");
+
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+
+  Shader   shader   = CreateShader();
+  Renderer renderer = Renderer::New(geometry, shader);
+  Actor    actor    = Actor::New();
+  actor.SetProperty(Actor::Property::SIZE, Vector3::ONE * 100.f);
+  actor.AddRenderer(renderer);
+  application.GetScene().Add(actor);
+
+  TraceCallStack& vertexArrayTrace = application.GetGlAbstraction().GetVertexArrayTrace();
+  vertexArrayTrace.Enable(true);
+
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("GenVertexArrays"), 1, TEST_LOCATION);
+
+  vertexArrayTrace.Reset();
+  application.GetScene().Remove(actor);
+  actor.Reset();
+  renderer.Reset();
+  geometry.Reset();
+  vertexBuffer.Reset();
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("DeleteVertexArrays"), 1, TEST_LOCATION);
+  DALI_TEST_CHECK(vertexArrayTrace.FindMethodAndParams("DeleteVertexArrays", "1"));
+
+  END_TEST;
+}
+
+int UtcDaliGeometryVertexArrayObjectSharedLayoutP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that shaders with the same attribute locations share the vertex array object of a geometry");
+
+  VertexBuffer vertexBuffer = CreateVertexBuffer("aPosition", "aTexCoord");
+  Geometry     geometry     = Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.EnableVertexArrayCallTrace(true);
+  TraceCallStack& vertexArrayTrace = glAbstraction.GetVertexArrayTrace();
+
+  Shader shader1 = CreateShader();
+  Shader shader2 = Shader::New("vertexSrc2", "fragmentSrc2");
+  for(Shader shader : {shader1, shader2})
+  {
+    Renderer renderer = Renderer::New(geometry, shader);
+    Actor    actor    = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector3::ONE * 100.f);
+    actor.AddRenderer(renderer);
+    application.GetScene().Add(actor);
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("GenVertexArrays"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("VertexAttribPointer"), 2, TEST_LOCATION);
+
+  vertexArrayTrace.Reset();
+  application.GetScene().GetRootLayer().SetProperty(Actor::Property::POSITION, Vector2(1.0f, 1.0f));
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("GenVertexArrays"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("VertexAttribPointer"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("BindVertexArray"), 4, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGeometryVertexArrayObjectNotSupportedP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the vertex attributes are set up for every draw call when vertex array objects are not supported");
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.SetGlesMajorVersion(2);
+  application.ResetContext();
+
+  VertexBuffer vertexBuffer = CreateVertexBuffer("aPosition", "aTexCoord");
+  Geometry     geometry     = Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+
+  Shader   shader   = CreateShader();
+  Renderer renderer = Renderer::New(geometry, shader);
+  Actor    actor    = Actor::New();
+  actor.SetProperty(Actor::Property::SIZE, Vector3::ONE * 100.f);
+  actor.AddRenderer(renderer);
+  application.GetScene().Add(actor);
+
+  TraceCallStack& vertexArrayTrace = glAbstraction.GetVertexArrayTrace();
+  vertexArrayTrace.Enable(true);
+  application.SendNotification();
+  application.Render(0);
+  actor.SetProperty(Actor::Property::POSITION, Vector2(10.0f, 10.0f));
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("GenVertexArrays"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("BindVertexArray"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(vertexArrayTrace.CountMethod("VertexAttribPointer"), 4, TEST_LOCATION);
+
+  glAbstraction.SetGlesMajorVersion(3);
+
+  END_TEST;
+}
+
 int UtcDaliGeometrySetIndexBufferNegative(void)
 {
   TestApplication application;
@@ -16,6 +16,7 @@
  */
 
 #include <dali-test-suite-utils.h>
+#include <dali/devel-api/actors/layer-devel.h>
 #include <dali/devel-api/events/hit-test-algorithm.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 #include <dali/public-api/dali-core.h>
@@ -100,6 +101,36 @@ bool DefaultIsActorTouchableFunction(Dali::Actor actor, Dali::HitTestAlgorithm::
   return hittable;
 };
 
+uint32_t gCheckedActorCount = 0u;
+
+bool CountingIsActorTouchableFunction(Dali::Actor actor, Dali::HitTestAlgorithm::TraverseType type)
+{
+  if(type == Dali::HitTestAlgorithm::CHECK_ACTOR)
+  {
+    ++gCheckedActorCount;
+  }
+  return DefaultIsActorTouchableFunction(actor, type);
+}
+
+/**
+ * Hit tests points all over the stage and returns the ids of the actors hit, 0 when nothing is hit.
+ */
+std::vector<uint32_t> HitTestStage(TestApplication& application)
+{
+  Stage                 stage = Stage::GetCurrent();
+  std::vector<uint32_t> hitActors;
+  for(float y = 3.0f; y < stage.GetSize().height; y += 7.0f)
+  {
+    for(float x = 3.0f; x < stage.GetSize().width; x += 7.0f)
+    {
+      HitTestAlgorithm::Results results;
+      HitTest(stage, Vector2(x, y), results, &CountingIsActorTouchableFunction);
+      hitActors.push_back(results.actor ? results.actor.GetProperty<int>(Actor::Property::ID) : 0u);
+    }
+  }
+  return hitActors;
+}
+
 } // anonymous namespace
 
 // Positive test case for a method
@@ -372,3 +403,78 @@ int UtcDaliHitTestAlgorithmOverlay(void)
   DALI_TEST_EQUALS(results.actorCoordinates, actorSize * 0.5f, TEST_LOCATION);
   END_TEST;
 }
+
+int UtcDaliHitTestAlgorithmHitTestIndex(void)
+{
+  TestApplication application;
+  tet_infoline("Testing Dali::HitTestAlgorithm gives the same results with the hit test index of the layer");
+
+  Stage stage = Stage::GetCurrent();
+
+  Layer layer = Layer::New();
+  layer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  layer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  stage.Add(layer);
+  DALI_TEST_EQUALS(layer.GetProperty<bool>(DevelLayer::Property::HIT_TEST_INDEX), false, TEST_LOCATION);
+
+  // A grid of cells, each with a child outside of the cell, so the bounds of a cell must contain its child
+  std::vector<Actor> cells;
+  for(uint32_t i = 0u; i < 100u; ++i)
+  {
+    Actor cell = Actor::New();
+    cell.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    cell.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    cell.SetProperty(Actor::Property::SIZE, Vector2(20.0f, 20.0f));
+    cell.SetProperty(Actor::Property::POSITION, Vector2(float(i % 10u) * 25.0f, float(i / 10u) * 25.0f));
+    cell.SetProperty(Actor::Property::CLIPPING_MODE, i % 7u ? ClippingMode::DISABLED : ClippingMode::CLIP_CHILDREN);
+    layer.Add(cell);
+    cells.push_back(cell);
+
+    Actor child = Actor::New();
+    child.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    child.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    child.SetProperty(Actor::Property::SIZE, Vector2(15.0f, 15.0f));
+    child.SetProperty(Actor::Property::POSITION, Vector2(200.0f, 300.0f + float(i % 3u)));
+    child.SetProperty(Actor::Property::SCALE, Vector3(1.0f + float(i % 4u), 1.0f, 1.0f));
+    child.SetProperty(Actor::Property::DRAW_MODE, i % 11u ? DrawMode::NORMAL : DrawMode::OVERLAY_2D);
+    cell.Add(child);
+  }
+
+  application.SendNotification();
+  application.Render();
+  gCheckedActorCount                   = 0u;
+  const std::vector<uint32_t> expected = HitTestStage(application);
+  const uint32_t              checkedActorCount = gCheckedActorCount;
+
+  layer.SetProperty(DevelLayer::Property::HIT_TEST_INDEX, true);
+  DALI_TEST_EQUALS(layer.GetProperty<bool>(DevelLayer::Property::HIT_TEST_INDEX), true, TEST_LOCATION);
+  application.SendNotification();
+  application.Render();
+  gCheckedActorCount = 0u;
+  DALI_TEST_CHECK(HitTestStage(application) == expected);
+
+  // The actors the touch cannot hit are not checked
+  tet_printf("Checked actors: %u without the index, %u with the index\n", checkedActorCount, gCheckedActorCount);
+  DALI_TEST_CHECK(gCheckedActorCount < checkedActorCount / 2u);
+
+  // Move and remove some cells
+  for(uint32_t i = 0u; i < cells.size(); i += 9u)
+  {
+    cells[i].SetProperty(Actor::Property::POSITION_X, 260.0f);
+  }
+  for(uint32_t i = 5u; i < cells.size(); i += 13u)
+  {
+    layer.Remove(cells[i]);
+  }
+  application.SendNotification();
+  application.Render();
+  const std::vector<uint32_t> changed = HitTestStage(application);
+  DALI_TEST_CHECK(changed != expected);
+
+  layer.SetProperty(DevelLayer::Property::HIT_TEST_INDEX, false);
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK(HitTestStage(application) == changed);
+
+  END_TEST;
+}
@@ -16,6 +16,7 @@
  */
 
 #include <dali-test-suite-utils.h>
+#include <dali/devel-api/actors/layer-devel.h>
 #include <dali/public-api/dali-core.h>
 #include <stdlib.h>
 
@@ -587,6 +588,7 @@ int UtcDaliLayerDefaultProperties(void)
   indices.push_back(Layer::Property::DEPTH_TEST);
   indices.push_back(Layer::Property::CONSUMES_TOUCH);
   indices.push_back(Layer::Property::CONSUMES_HOVER);
+  indices.push_back(DevelLayer::Property::HIT_TEST_INDEX);
 
   DALI_TEST_CHECK(actor.GetPropertyCount() == (Actor::New().GetPropertyCount() + indices.size()));
 
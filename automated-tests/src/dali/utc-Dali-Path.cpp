@@ -16,6 +16,7 @@
  */
 
 #include <dali-test-suite-utils.h>
+#include <dali/devel-api/animation/path-devel.h>
 #include <dali/public-api/dali-core.h>
 #include <stdlib.h>
 
@@ -539,6 +540,70 @@ int UtcDaliPathMoveAssignment(void)
   END_TEST;
 }
 
+int UtcDaliPathArcLengthSamples(void)
+{
+  TestApplication application;
+  Dali::Path      path = Dali::Path::New();
+  SetupPath(path);
+
+  DALI_TEST_EQUALS(path.GetProperty<int>(DevelPath::Property::ARC_LENGTH_SAMPLES), 0, TEST_LOCATION);
+  path.SetProperty(DevelPath::Property::ARC_LENGTH_SAMPLES, 128);
+  DALI_TEST_EQUALS(path.GetProperty<int>(DevelPath::Property::ARC_LENGTH_SAMPLES), 128, TEST_LOCATION);
+
+  // The end points are unchanged
+  Vector3 position, tangent;
+  path.Sample(0.0f, position, tangent);
+  DALI_TEST_EQUALS(position, Vector3(30.0f, 80.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(tangent.x, 0.6f, 0.1f, TEST_LOCATION);
+  DALI_TEST_EQUALS(tangent.y, 0.7f, 0.1f, TEST_LOCATION);
+
+  path.Sample(1.0f, position, tangent);
+  DALI_TEST_EQUALS(position, Vector3(100.0f, 100.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(tangent.x, 0.8f, 0.1f, TEST_LOCATION);
+  DALI_TEST_EQUALS(tangent.y, -0.4f, 0.1f, TEST_LOCATION);
+
+  // Even steps of progress move the same distance, although the segments have different lengths
+  const unsigned int stepCount = 20u;
+  Vector3            previous(30.0f, 80.0f, 0.0f);
+  float              distances[stepCount];
+  float              length = 0.0f;
+  for(unsigned int i = 1u; i <= stepCount; ++i)
+  {
+    path.Sample(float(i) / float(stepCount), position, tangent);
+    distances[i - 1u] = (position - previous).Length();
+    length += distances[i - 1u];
+    previous = position;
+  }
+  for(unsigned int i = 0u; i < stepCount; ++i)
+  {
+    DALI_TEST_EQUALS(distances[i], length / float(stepCount), length * 0.001f, TEST_LOCATION);
+  }
+
+  // The samples are on the path
+  Dali::Path curve = Dali::Path::New();
+  SetupPath(curve);
+  Vector3 middle;
+  path.Sample(0.5f, middle, tangent);
+  float closest = length;
+  for(unsigned int i = 0u; i <= 1000u; ++i)
+  {
+    curve.Sample(float(i) / 1000.0f, position, tangent);
+    closest = std::min(closest, (position - middle).Length());
+  }
+  DALI_TEST_EQUALS(closest, 0.0f, 0.1f, TEST_LOCATION);
+
+  // Changing the path updates the table
+  path.GetPoint(2) = Vector3(200.0f, 100.0f, 0.0f);
+  path.Sample(1.0f, position, tangent);
+  DALI_TEST_EQUALS(position, Vector3(200.0f, 100.0f, 0.0f), TEST_LOCATION);
+
+  path.SetProperty(DevelPath::Property::ARC_LENGTH_SAMPLES, 0);
+  path.Sample(0.5f, position, tangent);
+  DALI_TEST_EQUALS(position, Vector3(70.0f, 120.0f, 0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliPathAddControlPointNegative(void)
 {
   TestApplication application;
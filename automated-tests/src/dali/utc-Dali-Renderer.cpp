@@ -3489,3 +3489,347 @@ int UtcDaliRendererGetShaderNegative(void)
   }
   END_TEST;
 }
+
+namespace
+{
+/**
+ * Adds a row of actors, each with its own renderer but sharing the geometry, shader and texture set
+ */
+std::vector<Renderer> AddInstancedActors(TestApplication& application, Shader shader, uint32_t count)
+{
+  Geometry   geometry   = CreateQuadGeometry();
+  TextureSet textureSet = CreateTextureSet(Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16, 16));
+
+  std::vector<Renderer> renderers;
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    Renderer renderer = Renderer::New(geometry, shader);
+    renderer.SetTextures(textureSet);
+    renderers.push_back(renderer);
+
+    Actor actor = Actor::New();
+    actor.AddRenderer(renderer);
+    actor.SetProperty(Actor::Property::SIZE, Vector2(10.0f + i, 10.0f));
+    actor.SetProperty(Actor::Property::POSITION, Vector2(20.0f * i, 0.0f));
+    actor.SetProperty(Actor::Property::COLOR, Vector4(1.0f, 0.1f * i, 0.0f, 1.0f));
+    application.GetScene().Add(actor);
+  }
+  return renderers;
+}
+
+} // namespace
+
+int UtcDaliRendererInstancedShaderP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test renderers sharing geometry, shader and textures are drawn with a single instanced draw call");
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  Shader             shader        = Shader::New("vertexSrc", "fragmentSrc", Shader::Hint::INSTANCED);
+
+  std::vector<Renderer> renderers = AddInstancedActors(application, shader, 10u);
+
+  auto& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Reset();
+  drawTrace.Enable(true);
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElementsInstanced"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 0, TEST_LOCATION);
+
+  TraceCallStack::NamedParams params;
+  params["instanceCount"] = "10";
+  DALI_TEST_CHECK(drawTrace.FindMethodAndParams("DrawElementsInstanced", params));
+
+  // A renderer with different textures can't be drawn in the same call
+  TextureSet otherTextureSet = CreateTextureSet(Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16, 16));
+  renderers[9].SetTextures(otherTextureSet);
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElementsInstanced"), 2, TEST_LOCATION);
+  params["instanceCount"] = "9";
+  DALI_TEST_CHECK(drawTrace.FindMethodAndParams("DrawElementsInstanced", params));
+
+  // Nor can renderers with different uniforms, which splits the other run in three
+  renderers[5].RegisterProperty("uFade", 0.5f);
+  renderers[6].RegisterProperty("uFade", 0.5f);
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElementsInstanced"), 4, TEST_LOCATION);
+  params["instanceCount"] = "2";
+  DALI_TEST_CHECK(drawTrace.FindMethodAndParams("DrawElementsInstanced", params));
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedShaderWithoutHintP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test renderers sharing geometry, shader and textures are drawn one by one without the INSTANCED hint");
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  Shader             shader        = Shader::New("vertexSrc", "fragmentSrc");
+
+  AddInstancedActors(application, shader, 10u);
+
+  auto& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Reset();
+  drawTrace.Enable(true);
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElementsInstanced"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 10, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRendererInstancedShaderGles2P(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test renderers with an instanced shader are drawn one by one when instancing is not supported");
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.SetGlesMajorVersion(2);
+  application.ResetContext();
+
+  Shader shader = Shader::New("vertexSrc", "fragmentSrc", Shader::Hint::INSTANCED);
+  AddInstancedActors(application, shader, 10u);
+
+  auto& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Reset();
+  drawTrace.Enable(true);
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElementsInstanced"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 10, TEST_LOCATION);
+
+  glAbstraction.SetGlesMajorVersion(3);
+
+  END_TEST;
+}
+
+namespace
+{
+/**
+ * A std140 uniform block with the standard uniforms and a custom one
+ */
+std::vector<TestGlAbstraction::UniformBlock> CreateUniformBlocks()
+{
+  TestGlAbstraction::UniformBlock block;
+  block.name    = "VertexBlock";
+  block.size    = 416;
+  block.members = {
+    {"uModelMatrix", 0, 16},
+    {"uViewMatrix", 64, 16},
+    {"uProjection", 128, 16},
+    {"uModelView", 192, 16},
+    {"uMvpMatrix", 256, 16},
+    {"uNormalMatrix", 320, 16},
+    {"uColor", 368, 0},
+    {"uSize", 384, 0},
+    {"uCustom", 400, 0}};
+  return {block};
+}
+
+} // namespace
+
+int UtcDaliRendererUniformBlocksP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the uniforms declared in a uniform block are written to the uniform buffer");
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.SetActiveUniformBlocks(CreateUniformBlocks());
+
+  Shader shader = Shader::New("vertexSrc", "fragmentSrc");
+  AddInstancedActors(application, shader, 1u);
+  Layer rootLayer = application.GetScene().GetRootLayer();
+  Actor actor     = rootLayer.GetChildAt(rootLayer.GetChildCount() - 1u);
+  actor.RegisterProperty("uCustom", Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+  actor.RegisterProperty("uOutside", 0.5f);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(glAbstraction.GetUniformBufferBinding(0), GLintptr(0), TEST_LOCATION);
+
+  Vector4 color;
+  DALI_TEST_CHECK(glAbstraction.GetUniformBlockValue(0, 368, color));
+  DALI_TEST_EQUALS(color, Vector4(1.0f, 0.0f, 0.0f, 1.0f), TEST_LOCATION);
+
+  Vector3 size;
+  DALI_TEST_CHECK(glAbstraction.GetUniformBlockValue(0, 384, size));
+  DALI_TEST_EQUALS(size, Vector3(10.0f, 10.0f, 0.0f), TEST_LOCATION);
+
+  Vector4 custom;
+  DALI_TEST_CHECK(glAbstraction.GetUniformBlockValue(0, 400, custom));
+  DALI_TEST_EQUALS(custom, Vector4(1.0f, 2.0f, 3.0f, 4.0f), TEST_LOCATION);
+
+  Matrix model;
+  DALI_TEST_CHECK(glAbstraction.GetUniformBlockValue(0, 0, model));
+  DALI_TEST_EQUALS(model, actor.GetCurrentProperty<Matrix>(Actor::Property::WORLD_MATRIX), 0.001f, TEST_LOCATION);
+
+  // The uniforms in the block are not set one by one, the ones outside it still are
+  Vector4 uniformColor;
+  DALI_TEST_CHECK(!glAbstraction.GetUniformValue<Vector4>("uColor", uniformColor));
+  float outside = 0.0f;
+  DALI_TEST_CHECK(glAbstraction.GetUniformValue<float>("uOutside", outside));
+  DALI_TEST_EQUALS(outside, 0.5f, TEST_LOCATION);
+
+  // The next frame writes to another part of the ring
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK(glAbstraction.GetUniformBufferBinding(0) > 0);
+  DALI_TEST_CHECK(glAbstraction.GetUniformBlockValue(0, 400, custom));
+  DALI_TEST_EQUALS(custom, Vector4(1.0f, 2.0f, 3.0f, 4.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRendererUniformBlocksGlCallCountP(void)
+{
+  tet_infoline("Test that writing the uniforms to a uniform buffer makes fewer GL calls than setting them one by one");
+
+  const uint32_t actorCount = 100u;
+  size_t         glCallCount[2];
+  for(uint32_t useBlocks = 0u; useBlocks < 2u; ++useBlocks)
+  {
+    TestApplication    application;
+    TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+    if(useBlocks)
+    {
+      glAbstraction.SetActiveUniformBlocks(CreateUniformBlocks());
+    }
+
+    Shader shader = Shader::New("vertexSrc", "fragmentSrc");
+    AddInstancedActors(application, shader, actorCount);
+
+    TraceCallStack& uniformTrace = glAbstraction.GetSetUniformTrace();
+    uniformTrace.Enable(true);
+    glAbstraction.ResetBufferSubDataCalls();
+    application.SendNotification();
+    application.Render();
+
+    // The uniforms of the block are either set one by one, or copied to the uniform buffer
+    const auto uniformBlocks = CreateUniformBlocks();
+    glCallCount[useBlocks]   = glAbstraction.GetBufferSubDataCalls().size();
+    for(auto&& member : uniformBlocks[0].members)
+    {
+      glCallCount[useBlocks] += static_cast<size_t>(uniformTrace.CountMethod(member.name));
+    }
+  }
+
+  DALI_TEST_CHECK(glCallCount[0] > 0u);
+  DALI_TEST_CHECK(glCallCount[1] < glCallCount[0]);
+
+  END_TEST;
+}
+
+int UtcDaliRendererUniformBlocksGles2P(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that uniform blocks are not used when the context does not support them");
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.SetGlesMajorVersion(2);
+  application.ResetContext();
+  glAbstraction.SetActiveUniformBlocks(CreateUniformBlocks());
+
+  Shader shader = Shader::New("vertexSrc", "fragmentSrc");
+  AddInstancedActors(application, shader, 1u);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(glAbstraction.GetUniformBufferBinding(0), GLintptr(-1), TEST_LOCATION);
+
+  Vector4 color;
+  DALI_TEST_CHECK(glAbstraction.GetUniformValue<Vector4>("uColor", color));
+  DALI_TEST_EQUALS(color, Vector4(1.0f, 0.0f, 0.0f, 1.0f), TEST_LOCATION);
+
+  glAbstraction.SetGlesMajorVersion(3);
+
+  END_TEST;
+}
+
+int UtcDaliRendererStateMessageSizeBenchmark(void)
+{
+  tet_infoline("Measures the size of the render messages sent when renderers are created and changed");
+
+  TestApplication application;
+
+  const uint32_t        RENDERER_COUNT = 1000u;
+  Geometry              geometry       = CreateQuadGeometry();
+  Shader                shader         = Shader::New("vertexSrc", "fragmentSrc");
+  std::vector<Renderer> renderers;
+  for(uint32_t i = 0u; i < RENDERER_COUNT; ++i)
+  {
+    Renderer renderer = Renderer::New(geometry, shader);
+    Actor    actor    = Actor::New();
+    actor.AddRenderer(renderer);
+    actor.SetProperty(Actor::Property::SIZE, Vector2(10.0f, 10.0f));
+    application.GetScene().Add(actor);
+    renderers.push_back(renderer);
+  }
+
+  application.SendNotification();
+  application.Render();
+  const uint32_t createSize = application.GetRenderQueueSize();
+
+  // Change several properties of every renderer
+  for(auto&& renderer : renderers)
+  {
+    renderer.SetProperty(Renderer::Property::FACE_CULLING_MODE, FaceCullingMode::BACK);
+    renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_RGB, BlendFactor::ONE);
+    renderer.SetProperty(Renderer::Property::BLEND_COLOR, Color::RED);
+    renderer.SetProperty(Renderer::Property::DEPTH_WRITE_MODE, DepthWriteMode::ON);
+    renderer.SetProperty(Renderer::Property::DEPTH_TEST_MODE, DepthTestMode::ON);
+    renderer.SetProperty(Renderer::Property::DEPTH_FUNCTION, DepthFunction::LESS_EQUAL);
+    renderer.SetProperty(Renderer::Property::RENDER_MODE, RenderMode::COLOR_STENCIL);
+    renderer.SetProperty(Renderer::Property::STENCIL_FUNCTION, StencilFunction::EQUAL);
+    renderer.SetProperty(Renderer::Property::STENCIL_FUNCTION_REFERENCE, 1);
+    renderer.SetProperty(Renderer::Property::STENCIL_OPERATION_ON_Z_PASS, StencilOperation::REPLACE);
+  }
+
+  application.SendNotification();
+  application.Render();
+  const uint32_t changeSize = application.GetRenderQueueSize();
+
+  // Change a single property of every renderer
+  for(auto&& renderer : renderers)
+  {
+    renderer.SetProperty(Renderer::Property::FACE_CULLING_MODE, FaceCullingMode::FRONT);
+  }
+
+  application.SendNotification();
+  application.Render();
+  const uint32_t singleChangeSize = application.GetRenderQueueSize();
+
+  tet_printf("Render queue bytes for %u renderers: %u when created, %u when 11 properties change, %u when 1 property changes\n", RENDERER_COUNT, createSize, changeSize, singleChangeSize);
+
+  DALI_TEST_CHECK(createSize > 0u);
+  DALI_TEST_CHECK(changeSize > singleChangeSize);
+
+  // The changes have all been applied
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(renderers.back().GetCurrentProperty<int>(Renderer::Property::FACE_CULLING_MODE), static_cast<int>(FaceCullingMode::FRONT), TEST_LOCATION);
+  DALI_TEST_EQUALS(renderers.back().GetCurrentProperty<int>(Renderer::Property::STENCIL_FUNCTION_REFERENCE), 1, TEST_LOCATION);
+
+  END_TEST;
+}
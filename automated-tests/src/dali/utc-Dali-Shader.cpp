@@ -16,6 +16,7 @@
  */
 
 #include <dali-test-suite-utils.h>
+#include <dali/devel-api/rendering/shader-devel.h>
 #include <dali/public-api/dali-core.h>
 #include <mesh-builder.h>
 #include <stdlib.h>
@@ -49,6 +50,39 @@ void TestConstraintNoBlue(Vector4& current, const PropertyInputContainer& inputs
   current.b = 0.0f;
 }
 
+Actor CreateActorWithShader(Shader shader)
+{
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New(geometry, shader);
+  Actor    actor    = Actor::New();
+  actor.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  actor.AddRenderer(renderer);
+  return actor;
+}
+
+void EnableProgramBinaries(TestApplication& application, GLubyte* driver = nullptr)
+{
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.SetNumBinaryFormats(1);
+  glAbstraction.SetBinaryFormats(1);
+  glAbstraction.SetProgramBinaryLength(16);
+  glAbstraction.SetGetStringResult(driver);
+
+  // The support for binaries is queried when the context is created
+  application.GetCore().ContextDestroyed();
+  application.GetCore().ContextCreated();
+}
+
+void RenderAndSaveBinaries(TestApplication& application)
+{
+  // Compiled in the first frame, sent to the event thread by the next update and saved by the idle event processing
+  application.SendNotification();
+  application.Render(16);
+  application.Render(16);
+  application.SendNotification();
+  application.SendNotification();
+}
+
 } // namespace
 
 int UtcDaliShaderMethodNew01(void)
@@ -453,6 +487,13 @@ int UtcDaliShaderProgramProperty(void)
   hintGot = (*value.GetMap())["hints"].Get<std::string>();
   DALI_TEST_CHECK(hintGot == hintSet);
 
+  hintSet      = "MODIFIES_GEOMETRY,INSTANCED";
+  map["hints"] = hintSet;
+  shader.SetProperty(Shader::Property::PROGRAM, Property::Value(map));
+  value   = shader.GetProperty(Shader::Property::PROGRAM);
+  hintGot = (*value.GetMap())["hints"].Get<std::string>();
+  DALI_TEST_CHECK(hintGot == hintSet);
+
   hintSet      = "NONE";
   map["hints"] = hintSet;
   shader.SetProperty(Shader::Property::PROGRAM, Property::Value(map));
@@ -469,3 +510,397 @@ int UtcDaliShaderProgramProperty(void)
 
   END_TEST;
 }
+
+int UtcDaliShaderProgramCacheBudget(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the least recently used programs are unloaded when there are more than the budget");
+
+  application.GetCore().SetProgramCacheBudget(1u);
+
+  Actor actor1 = CreateActorWithShader(Shader::New("vertexSrc1", "fragmentSrc1"));
+  Actor actor2 = CreateActorWithShader(Shader::New("vertexSrc2", "fragmentSrc2"));
+  application.GetScene().Add(actor1);
+  application.GetScene().Add(actor2);
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack&    shaderTrace   = glAbstraction.GetShaderTrace();
+  TraceCallStack&    drawTrace     = glAbstraction.GetDrawTrace();
+  shaderTrace.Enable(true);
+  drawTrace.Enable(true);
+
+  application.SendNotification();
+  application.Render(16);
+  application.Render(16);
+
+  // Both programs are used in every frame, so they are kept
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CreateProgram"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("DeleteProgram"), 0, TEST_LOCATION);
+
+  // The program of an actor which is not drawn any more is unloaded
+  const GLuint program2 = glAbstraction.GetLastProgramCreated();
+  actor2.Unparent();
+  application.SendNotification();
+  application.Render(16);
+  application.Render(16);
+
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("DeleteProgram"), 1, TEST_LOCATION);
+  DALI_TEST_CHECK(shaderTrace.FindMethodAndParams("DeleteProgram", std::to_string(program2)));
+
+  // And loaded again when it is drawn again
+  shaderTrace.Reset();
+  drawTrace.Reset();
+  application.GetScene().Add(actor2);
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CreateProgram"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("LinkProgram"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 2, TEST_LOCATION);
+
+  // Without a budget nothing is unloaded
+  application.GetCore().SetProgramCacheBudget(0u);
+  shaderTrace.Reset();
+  actor1.Unparent();
+  application.SendNotification();
+  application.Render(16);
+  application.Render(16);
+
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("DeleteProgram"), 0, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderPrecompileP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that precompiled programs are compiled one per frame and their renderers are drawn once they are compiled");
+
+  Shader shader1 = Shader::New("vertexSrc1", "fragmentSrc1");
+  Shader shader2 = Shader::New("vertexSrc2", "fragmentSrc2");
+  Shader shader3 = Shader::New("vertexSrc3", "fragmentSrc3");
+  DevelShader::Precompile({shader2, shader3});
+
+  application.GetScene().Add(CreateActorWithShader(shader1));
+  application.GetScene().Add(CreateActorWithShader(shader2));
+  application.GetScene().Add(CreateActorWithShader(shader3));
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack&    shaderTrace   = glAbstraction.GetShaderTrace();
+  TraceCallStack&    drawTrace     = glAbstraction.GetDrawTrace();
+  shaderTrace.Enable(true);
+  drawTrace.Enable(true);
+
+  // The program which is not precompiled is compiled straight away, along with the first precompiled one
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CreateProgram"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetRenderNeedsUpdate(), true, TEST_LOCATION);
+
+  // The last one is compiled in the next frame, so every renderer is drawn
+  shaderTrace.Reset();
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CreateProgram"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetRenderNeedsUpdate(), false, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderPrecompileEvictedP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that precompiling a shader whose program was unloaded by the budget does not stop its renderers being drawn");
+
+  application.GetCore().SetProgramCacheBudget(1u);
+
+  Shader shader2 = Shader::New("vertexSrc2", "fragmentSrc2");
+  Actor  actor1  = CreateActorWithShader(Shader::New("vertexSrc1", "fragmentSrc1"));
+  Actor  actor2  = CreateActorWithShader(shader2);
+  application.GetScene().Add(actor1);
+  application.GetScene().Add(actor2);
+  application.SendNotification();
+  application.Render(16);
+  application.Render(16);
+
+  actor2.Unparent();
+  application.SendNotification();
+  application.Render(16);
+  application.Render(16);
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack&    drawTrace     = glAbstraction.GetDrawTrace();
+  drawTrace.Enable(true);
+
+  // The new shader is compiled first, the unloaded one is loaded again as soon as it is drawn
+  application.GetScene().Add(actor2);
+  DevelShader::Precompile({Shader::New("vertexSrc3", "fragmentSrc3"), shader2});
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 2, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderPrecompileCompiledN(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that precompiling shaders whose programs are already compiled does nothing");
+
+  Shader shader = Shader::New("vertexSrc1", "fragmentSrc1");
+  application.GetScene().Add(CreateActorWithShader(shader));
+
+  application.SendNotification();
+  application.Render(16);
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  TraceCallStack&    shaderTrace   = glAbstraction.GetShaderTrace();
+  TraceCallStack&    drawTrace     = glAbstraction.GetDrawTrace();
+  shaderTrace.Enable(true);
+  drawTrace.Enable(true);
+
+  // A new shader with the same source shares the compiled program
+  DevelShader::Precompile({shader, Shader::New("vertexSrc1", "fragmentSrc1")});
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CreateProgram"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetRenderNeedsUpdate(), false, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryArchiveP(void)
+{
+  tet_infoline("Test that the program binaries are saved to a single archive and loaded from it by the next run");
+
+  std::string                 archiveName;
+  Dali::Vector<unsigned char> archive;
+  {
+    TestApplication application;
+    EnableProgramBinaries(application);
+
+    application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc1", "fragmentSrc1")));
+    application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc2", "fragmentSrc2")));
+    RenderAndSaveBinaries(application);
+
+    TraceCallStack& platformTrace = application.GetPlatform().GetTrace();
+    DALI_TEST_EQUALS(platformTrace.CountMethod("LoadShaderBinaryFile"), 1, TEST_LOCATION);
+    DALI_TEST_EQUALS(platformTrace.CountMethod("SaveShaderBinaryFile"), 1, TEST_LOCATION);
+    DALI_TEST_CHECK(platformTrace.FindMethodAndGetParameters("SaveShaderBinaryFile", archiveName));
+    DALI_TEST_CHECK(application.GetPlatform().GetSavedFile(archiveName, archive));
+  }
+
+  TestApplication application;
+  EnableProgramBinaries(application);
+  application.GetPlatform().SetLoadFileResult(true, archive);
+
+  TraceCallStack& shaderTrace = application.GetGlAbstraction().GetShaderTrace();
+  shaderTrace.Enable(true);
+
+  application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc1", "fragmentSrc1")));
+  application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc2", "fragmentSrc2")));
+  RenderAndSaveBinaries(application);
+
+  // Both programs are loaded from the archive, so there is nothing new to save
+  TraceCallStack& platformTrace = application.GetPlatform().GetTrace();
+  DALI_TEST_EQUALS(platformTrace.CountMethod("LoadShaderBinaryFile"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(platformTrace.CountMethod("SaveShaderBinaryFile"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CreateProgram"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CompileShader"), 0, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryArchiveDriverChangedP(void)
+{
+  tet_infoline("Test that the archived binaries are not used and are discarded when the driver changes");
+
+  std::string                 archiveName;
+  Dali::Vector<unsigned char> archive;
+  {
+    TestApplication application;
+    EnableProgramBinaries(application);
+
+    application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc1", "fragmentSrc1")));
+    application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc2", "fragmentSrc2")));
+    RenderAndSaveBinaries(application);
+
+    DALI_TEST_CHECK(application.GetPlatform().GetTrace().FindMethodAndGetParameters("SaveShaderBinaryFile", archiveName));
+    DALI_TEST_CHECK(application.GetPlatform().GetSavedFile(archiveName, archive));
+  }
+
+  TestApplication application;
+  GLubyte         driver[] = "Updated driver";
+  EnableProgramBinaries(application, driver);
+  application.GetPlatform().SetLoadFileResult(true, archive);
+
+  TraceCallStack& shaderTrace = application.GetGlAbstraction().GetShaderTrace();
+  shaderTrace.Enable(true);
+
+  application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc1", "fragmentSrc1")));
+  RenderAndSaveBinaries(application);
+
+  // The program is compiled from source and the archive is written again with its binary only
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CompileShader"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetPlatform().GetTrace().CountMethod("SaveShaderBinaryFile"), 1, TEST_LOCATION);
+
+  Dali::Vector<unsigned char> updatedArchive;
+  DALI_TEST_CHECK(application.GetPlatform().GetSavedFile(archiveName, updatedArchive));
+  DALI_TEST_CHECK(updatedArchive.Count() < archive.Count());
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryArchiveSaveWhenIdleP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the archive is written by the first event processing which receives no new binaries");
+
+  EnableProgramBinaries(application);
+  TraceCallStack&       platformTrace    = application.GetPlatform().GetTrace();
+  TestRenderController& renderController = application.GetRenderController();
+
+  application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc1", "fragmentSrc1")));
+  application.SendNotification();
+  application.Render(16);
+  application.Render(16);
+
+  // The event processing receiving the binary asks for an idle one instead of writing the archive
+  renderController.Initialize();
+  application.SendNotification();
+  DALI_TEST_EQUALS(platformTrace.CountMethod("SaveShaderBinaryFile"), 0, TEST_LOCATION);
+  DALI_TEST_CHECK(renderController.WasCalled(TestRenderController::RequestProcessEventsOnIdleFunc));
+
+  application.SendNotification();
+  DALI_TEST_EQUALS(platformTrace.CountMethod("SaveShaderBinaryFile"), 1, TEST_LOCATION);
+
+  // Without new binaries, nothing is written again
+  renderController.Initialize();
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+  DALI_TEST_EQUALS(platformTrace.CountMethod("SaveShaderBinaryFile"), 1, TEST_LOCATION);
+  DALI_TEST_CHECK(!renderController.WasCalled(TestRenderController::RequestProcessEventsOnIdleFunc));
+
+  application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc2", "fragmentSrc2")));
+  RenderAndSaveBinaries(application);
+  DALI_TEST_EQUALS(platformTrace.CountMethod("SaveShaderBinaryFile"), 2, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryArchiveInvalidN(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that an archive which cannot be read is ignored");
+
+  EnableProgramBinaries(application);
+  Dali::Vector<unsigned char> archive;
+  archive.Resize(40u, 0xFF);
+  application.GetPlatform().SetLoadFileResult(true, archive);
+
+  TraceCallStack& shaderTrace = application.GetGlAbstraction().GetShaderTrace();
+  shaderTrace.Enable(true);
+
+  application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc1", "fragmentSrc1")));
+  RenderAndSaveBinaries(application);
+
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CompileShader"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetPlatform().GetTrace().CountMethod("SaveShaderBinaryFile"), 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryArchiveStartupP(void)
+{
+  tet_infoline("Test that a restart loads every program from the archive written by the previous run");
+
+  const uint32_t shaderCount = 10u;
+  const auto     createScene = [](TestApplication& application) {
+    for(uint32_t i = 0u; i < shaderCount; ++i)
+    {
+      application.GetScene().Add(CreateActorWithShader(Shader::New("vertexSrc" + std::to_string(i), "fragmentSrc")));
+    }
+    RenderAndSaveBinaries(application);
+  };
+
+  // The first run compiles every program and saves the binaries
+  std::string                 archiveName;
+  Dali::Vector<unsigned char> archive;
+  {
+    TestApplication application;
+    EnableProgramBinaries(application);
+
+    TraceCallStack& shaderTrace = application.GetGlAbstraction().GetShaderTrace();
+    shaderTrace.Enable(true);
+
+    createScene(application);
+
+    TraceCallStack& platformTrace = application.GetPlatform().GetTrace();
+    DALI_TEST_EQUALS(shaderTrace.CountMethod("CompileShader"), static_cast<int>(shaderCount * 2u), TEST_LOCATION);
+    DALI_TEST_EQUALS(platformTrace.CountMethod("SaveShaderBinaryFile"), 1, TEST_LOCATION);
+    DALI_TEST_CHECK(platformTrace.FindMethodAndGetParameters("SaveShaderBinaryFile", archiveName));
+    DALI_TEST_CHECK(application.GetPlatform().GetSavedFile(archiveName, archive));
+  }
+
+  // The next run loads every binary from the archive
+  TestApplication application;
+  EnableProgramBinaries(application);
+  application.GetPlatform().SetLoadFileResult(true, archive);
+
+  TraceCallStack& shaderTrace = application.GetGlAbstraction().GetShaderTrace();
+  shaderTrace.Enable(true);
+
+  createScene(application);
+
+  DALI_TEST_EQUALS(application.GetPlatform().GetTrace().CountMethod("LoadShaderBinaryFile"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(shaderTrace.CountMethod("CompileShader"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetPlatform().GetTrace().CountMethod("SaveShaderBinaryFile"), 0, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderManyProgramsP(void)
+{
+  TestApplication application;
+
+  const uint32_t      shaderCount = 10u;
+  std::vector<Shader> shaders;
+
+  // Visual variants share most of their source, but each one still needs its own program
+  const std::string prefix(4096u, ' ');
+  for(uint32_t i = 0u; i < shaderCount; ++i)
+  {
+    shaders.push_back(Shader::New(prefix + "vertexSrc" + std::to_string(i), prefix + "fragmentSrc"));
+  }
+
+  Geometry geometry = CreateQuadGeometry();
+  for(auto&& shader : shaders)
+  {
+    Renderer renderer = Renderer::New(geometry, shader);
+    Actor    actor    = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector2(1.0f, 1.0f));
+    actor.AddRenderer(renderer);
+    application.GetScene().Add(actor);
+  }
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(application.GetGlAbstraction().GetLastProgramCreated(), shaderCount, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -1635,3 +1635,88 @@ int UtcDaliStageRenderingBehavior(void)
 
   END_TEST;
 }
+
+int UtcDaliStagePropertyMessageCoalescing(void)
+{
+  TestApplication application;
+  Stage           stage = Stage::GetCurrent();
+
+  tet_infoline("Check property messages are not coalesced by default");
+  DALI_TEST_CHECK(!DevelStage::IsPropertyMessageCoalescingEnabled(stage));
+
+  Actor actor = Actor::New();
+  stage.Add(actor);
+  Property::Index customIndex = actor.RegisterProperty("custom", 0.0f);
+
+  application.SendNotification();
+  application.Render();
+
+  for(int i = 0; i < 10; ++i)
+  {
+    actor.SetProperty(Actor::Property::POSITION, Vector3(float(i), 0.0f, 0.0f));
+  }
+  DALI_TEST_EQUALS(DevelStage::GetCoalescedPropertyMessageCount(stage), 0u, TEST_LOCATION);
+
+  tet_infoline("Set several properties many times, only the last values should be sent");
+  DevelStage::SetPropertyMessageCoalescing(stage, true);
+  DALI_TEST_CHECK(DevelStage::IsPropertyMessageCoalescingEnabled(stage));
+
+  for(int i = 0; i < 50; ++i)
+  {
+    actor.SetProperty(Actor::Property::POSITION, Vector3(float(i), 1.0f, 2.0f));
+    actor.SetProperty(customIndex, float(i));
+  }
+  DALI_TEST_EQUALS(DevelStage::GetCoalescedPropertyMessageCount(stage), 98u, TEST_LOCATION);
+
+  for(int i = 0; i < 50; ++i)
+  {
+    actor.SetProperty(Actor::Property::COLOR, Vector4(1.0f, 1.0f, 1.0f, float(i) / 50.0f));
+  }
+  DALI_TEST_GREATER(DevelStage::GetCoalescedPropertyMessageCount(stage), 98u + 48u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(49.0f, 1.0f, 2.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector4>(Actor::Property::COLOR), Vector4(1.0f, 1.0f, 1.0f, 49.0f / 50.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<float>(customIndex), 49.0f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliStagePropertyMessageCoalescingOrder(void)
+{
+  TestApplication application;
+  Stage           stage = Stage::GetCurrent();
+  DevelStage::SetPropertyMessageCoalescing(stage, true);
+
+  Actor actor = Actor::New();
+  stage.Add(actor);
+  application.SendNotification();
+  application.Render();
+
+  tet_infoline("Values set before and after a component or relative change are all sent");
+  actor.SetProperty(Actor::Property::POSITION, Vector3(1.0f, 2.0f, 3.0f));
+  actor.SetProperty(Actor::Property::POSITION_X, 10.0f);
+  actor.SetProperty(Actor::Property::POSITION, Vector3(4.0f, 5.0f, 6.0f));
+  actor.TranslateBy(Vector3(1.0f, 1.0f, 1.0f));
+  DALI_TEST_EQUALS(DevelStage::GetCoalescedPropertyMessageCount(stage), 0u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(5.0f, 6.0f, 7.0f), TEST_LOCATION);
+
+  tet_infoline("Values set before and after the actor is removed and added again are all sent");
+  actor.SetProperty(Actor::Property::SCALE, Vector3(2.0f, 2.0f, 2.0f));
+  stage.Remove(actor);
+  actor.SetProperty(Actor::Property::SCALE, Vector3(3.0f, 3.0f, 3.0f));
+  stage.Add(actor);
+  actor.SetProperty(Actor::Property::SCALE, Vector3(4.0f, 4.0f, 4.0f));
+  DALI_TEST_EQUALS(DevelStage::GetCoalescedPropertyMessageCount(stage), 0u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Actor::Property::SCALE), Vector3(4.0f, 4.0f, 4.0f), TEST_LOCATION);
+
+  END_TEST;
+}
@@ -606,6 +606,85 @@ int UtcDaliTextureUpload06(void)
   END_TEST;
 }
 
+int UtcDaliTextureUploadRgbToRgbaP(void)
+{
+  // RGB data uploaded to an RGBA texture is expanded before it reaches the render thread, by the update worker threads if it is large
+  const uint32_t WORKER_THREAD_COUNTS[] = {0u, 3u};
+  for(uint32_t workerThreadCount : WORKER_THREAD_COUNTS)
+  {
+    TestApplication application;
+    application.GetCore().SetUpdateWorkerThreadCount(workerThreadCount);
+
+    unsigned int width(1024);
+    unsigned int height(512);
+    Texture      texture = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, width, height);
+
+    application.GetGlAbstraction().EnableTextureCallTrace(true);
+    application.SendNotification();
+    application.Render();
+
+    TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+    callStack.Reset();
+
+    unsigned int   bufferSize(width * height * 3);
+    unsigned char* buffer    = reinterpret_cast<unsigned char*>(malloc(bufferSize));
+    PixelData      pixelData = PixelData::New(buffer, bufferSize, width, height, Pixel::RGB888, PixelData::FREE);
+    DALI_TEST_CHECK(texture.Upload(pixelData));
+
+    unsigned int   subBufferSize(16u * 16u * 3u);
+    unsigned char* subBuffer    = reinterpret_cast<unsigned char*>(malloc(subBufferSize));
+    PixelData      subPixelData = PixelData::New(subBuffer, subBufferSize, 16u, 16u, Pixel::RGB888, PixelData::FREE);
+    DALI_TEST_CHECK(texture.Upload(subPixelData, 0u, 0u, 8u, 8u, 16u, 16u));
+
+    application.SendNotification();
+    application.Render();
+
+    TraceCallStack::NamedParams params;
+    params["width"]  = ToString(width);
+    params["height"] = ToString(height);
+    params["format"] = ToString(GL_RGBA);
+    DALI_TEST_CHECK(callStack.FindMethodAndParams("TexImage2D", params));
+
+    params["width"]  = ToString(16u);
+    params["height"] = ToString(16u);
+    DALI_TEST_CHECK(callStack.FindMethodAndParams("TexSubImage2D", params));
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadRgbSubImageWithoutConversionP(void)
+{
+  // RGB sub-images are passed on as they are when the GL abstraction does not require converting them
+  TestApplication application;
+  application.GetGlAbstraction().SetSubImagesRequireConverting(false);
+
+  Texture texture = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 64u, 64u);
+
+  application.GetGlAbstraction().EnableTextureCallTrace(true);
+  application.SendNotification();
+  application.Render();
+
+  TraceCallStack& callStack = application.GetGlAbstraction().GetTextureTrace();
+  callStack.Reset();
+
+  unsigned int   bufferSize(16u * 16u * 3u);
+  unsigned char* buffer    = reinterpret_cast<unsigned char*>(malloc(bufferSize));
+  PixelData      pixelData = PixelData::New(buffer, bufferSize, 16u, 16u, Pixel::RGB888, PixelData::FREE);
+  DALI_TEST_CHECK(texture.Upload(pixelData, 0u, 0u, 8u, 8u, 16u, 16u));
+
+  application.SendNotification();
+  application.Render();
+
+  TraceCallStack::NamedParams params;
+  params["width"]  = ToString(16u);
+  params["height"] = ToString(16u);
+  params["format"] = ToString(GL_RGB);
+  DALI_TEST_CHECK(callStack.FindMethodAndParams("TexSubImage2D", params));
+
+  END_TEST;
+}
+
 int UtcDaliTextureUpload07(void)
 {
   Pixel::Format FLOATING_POINT_PIXEL_FORMATS[] =
@@ -25,6 +25,31 @@ namespace Dali
 {
 namespace DevelLayer
 {
+namespace Property
+{
+enum Type
+{
+  CLIPPING_ENABLE = Dali::Layer::Property::CLIPPING_ENABLE,
+  CLIPPING_BOX    = Dali::Layer::Property::CLIPPING_BOX,
+  BEHAVIOR        = Dali::Layer::Property::BEHAVIOR,
+  DEPTH           = Dali::Layer::Property::DEPTH,
+  DEPTH_TEST      = Dali::Layer::Property::DEPTH_TEST,
+  CONSUMES_TOUCH  = Dali::Layer::Property::CONSUMES_TOUCH,
+  CONSUMES_HOVER  = Dali::Layer::Property::CONSUMES_HOVER,
+
+  /**
+   * @brief Whether hit tests use the bounds of the actors to skip the parts of the layer that cannot be hit.
+   * @details Name "hitTestIndex", type Property::BOOLEAN.
+   * @note Default is false.
+   * @note When enabled, the bounds of every actor and its children are computed on the update thread
+   * in the frames where some transform changes, so this is useful for layers with many actors, e.g. large grids.
+   * @note The hit actor is the same whether this is enabled or not.
+   */
+  HIT_TEST_INDEX = CONSUMES_HOVER + 1,
+};
+
+} // namespace Property
+
 /**
    * @brief ACTOR_DEPTH_MULTIPLIER is used by the rendering sorting algorithm to decide which actors to render first.
    * @SINCE_1_0.0
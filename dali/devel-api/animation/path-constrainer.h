@@ -52,7 +52,8 @@ public:
     {
       FORWARD = DEFAULT_OBJECT_PROPERTY_START_INDEX, ///< name "forward" type Vector3
       POINTS,                                        ///< name "points" type Array of Vector3
-      CONTROL_POINTS                                 ///< name "controlPoints" type Array of Vector3
+      CONTROL_POINTS,                                ///< name "controlPoints" type Array of Vector3
+      ARC_LENGTH_SAMPLES                             ///< name "arcLengthSamples" type integer, see DevelPath::Property::ARC_LENGTH_SAMPLES. When it is not zero, constraints applied afterwards keep the path they were applied with
     };
   };
 
@@ -0,0 +1,51 @@
+#ifndef DALI_PATH_DEVEL_H
+#define DALI_PATH_DEVEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/animation/path.h>
+
+namespace Dali
+{
+namespace DevelPath
+{
+namespace Property
+{
+enum Type
+{
+  POINTS         = Dali::Path::Property::POINTS,
+  CONTROL_POINTS = Dali::Path::Property::CONTROL_POINTS,
+
+  /**
+   * @brief The number of samples of a table used to sample the path by arc length.
+   * @details Name "arcLengthSamples", type Property::INTEGER.
+   * When it is not zero, progress along the path is proportional to the distance travelled, so
+   * an object animated along the path moves at constant speed, and samples are interpolated from
+   * a table built once when the path changes. More samples make the table more accurate.
+   * @note The default value is 0, where the progress is divided evenly between the segments of the path.
+   */
+  ARC_LENGTH_SAMPLES = CONTROL_POINTS + 1,
+};
+} // namespace Property
+
+} // namespace DevelPath
+
+} // namespace Dali
+
+#endif // DALI_PATH_DEVEL_H
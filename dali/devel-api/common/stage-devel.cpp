@@ -38,6 +38,21 @@ Rendering GetRenderingBehavior(Dali::Stage stage)
   return GetImplementation(stage).GetRenderingBehavior();
 }
 
+void SetPropertyMessageCoalescing(Dali::Stage stage, bool enabled)
+{
+  GetImplementation(stage).SetPropertyMessageCoalescing(enabled);
+}
+
+bool IsPropertyMessageCoalescingEnabled(Dali::Stage stage)
+{
+  return GetImplementation(stage).IsPropertyMessageCoalescingEnabled();
+}
+
+uint32_t GetCoalescedPropertyMessageCount(Dali::Stage stage)
+{
+  return GetImplementation(stage).GetCoalescedPropertyMessageCount();
+}
+
 void AddFrameCallback(Dali::Stage stage, FrameCallbackInterface& frameCallback, Actor rootActor)
 {
   GetImplementation(stage).AddFrameCallback(frameCallback, GetImplementation(rootActor));
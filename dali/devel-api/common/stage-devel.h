@@ -65,6 +65,36 @@ DALI_CORE_API void SetRenderingBehavior(Dali::Stage stage, Rendering renderingBe
  */
 DALI_CORE_API Rendering GetRenderingBehavior(Dali::Stage stage);
 
+/**
+ * @brief Enables or disables the coalescing of property messages.
+ *
+ * When enabled, setting the same property of an object several times before the messages are sent to the
+ * update thread only sends the last value. Messages which change the scene in other ways (e.g. adding or removing
+ * actors) are never reordered with respect to the property messages.
+ *
+ * @param[in] stage The stage
+ * @param[in] enabled Whether property messages are coalesced
+ *
+ * @note By default, property messages are not coalesced.
+ */
+DALI_CORE_API void SetPropertyMessageCoalescing(Dali::Stage stage, bool enabled);
+
+/**
+ * @brief Queries whether property messages are coalesced.
+ *
+ * @param[in] stage The stage
+ * @return True if property messages are coalesced
+ */
+DALI_CORE_API bool IsPropertyMessageCoalescingEnabled(Dali::Stage stage);
+
+/**
+ * @brief Retrieves the number of property messages that were superseded by a later message, and so never sent.
+ *
+ * @param[in] stage The stage
+ * @return The number of messages
+ */
+DALI_CORE_API uint32_t GetCoalescedPropertyMessageCount(Dali::Stage stage);
+
 /*
  * @brief The FrameCallbackInterface implementation added gets called on every frame from the update-thread.
  *
@@ -0,0 +1,46 @@
+#ifndef DALI_SHADER_DEVEL_H
+#define DALI_SHADER_DEVEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/rendering/shader.h>
+
+namespace Dali
+{
+namespace DevelShader
+{
+/**
+ * @brief Compiles the programs of the given shaders ahead of their use.
+ *
+ * The programs are compiled a few per frame by the render thread, from their stored binaries
+ * when available. Renderers using a shader whose program has not been compiled yet are not
+ * drawn until it has been, rather than stalling the frame to compile it.
+ * Shaders whose programs are already compiled are ignored.
+ *
+ * @param[in] shaders The shaders to compile, in order of priority
+ */
+DALI_CORE_API void Precompile(const std::vector<Dali::Shader>& shaders);
+
+} // namespace DevelShader
+} // namespace Dali
+
+#endif // DALI_SHADER_DEVEL_H
@@ -136,6 +136,21 @@ void Core::PostRender(bool uploadOnly)
   mImpl->PostRender(uploadOnly);
 }
 
+void Core::SetUpdateWorkerThreadCount(uint32_t threadCount)
+{
+  mImpl->SetUpdateWorkerThreadCount(threadCount);
+}
+
+void Core::SetProgramCacheBudget(uint32_t programCount)
+{
+  mImpl->SetProgramCacheBudget(programCount);
+}
+
+uint32_t Core::TrimMemoryPools()
+{
+  return mImpl->TrimMemoryPools();
+}
+
 void Core::RegisterProcessor(Processor& processor)
 {
   mImpl->RegisterProcessor(processor);
@@ -140,7 +140,8 @@ public:
    * Constructor
    */
   RenderStatus()
-  : needsUpdate(false),
+  : renderQueueSize(0u),
+    needsUpdate(false),
     needsPostRender(false)
   {
   }
@@ -182,7 +183,26 @@ public:
     return needsPostRender;
   }
 
+  /**
+   * Set the size of the messages sent by the update to the render thread for this frame.
+   * @param[in] size The size in bytes
+   */
+  void SetRenderQueueSize(uint32_t size)
+  {
+    renderQueueSize = size;
+  }
+
+  /**
+   * Query the size of the messages sent by the update to the render thread for this frame.
+   * @return The size in bytes
+   */
+  uint32_t GetRenderQueueSize() const
+  {
+    return renderQueueSize;
+  }
+
 private:
+  uint32_t renderQueueSize; ///< The size of the render messages processed at the start of the frame
   bool needsUpdate : 1;     ///< True if update is required to be run
   bool needsPostRender : 1; ///< True if post-render is required to be run.
 };
@@ -400,6 +420,36 @@ public:
    */
   void PostRender(bool uploadOnly);
 
+  /**
+   * @brief Sets the number of worker threads the update-thread may use to process large scenes in parallel.
+   *
+   * Worker threads are only used when there is enough work to share, smaller scenes are still updated
+   * on the update-thread alone.
+   * Multi-threading note: this method should be called from the main thread.
+   * @param[in] threadCount The number of worker threads, or 0 to update on the update-thread only (default).
+   */
+  void SetUpdateWorkerThreadCount(uint32_t threadCount);
+
+  /**
+   * @brief Sets the maximum number of shader programs to keep loaded in GL.
+   *
+   * When more programs are loaded, the least recently used ones which were not used in the last frame
+   * are unloaded at the end of the frame, and loaded again from their binary or source when used.
+   * Multi-threading note: this method should be called from the main thread.
+   * @param[in] programCount The number of programs, or 0 for no limit (default).
+   */
+  void SetProgramCacheBudget(uint32_t programCount);
+
+  /**
+   * @brief Releases the memory of the scene-graph object pools which no object is using.
+   *
+   * The pools grow as objects are created but never shrink by themselves; call this e.g. when the
+   * system is low on memory, or after a large part of the scene has been removed.
+   * Multi-threading note: this method should be called from the main thread.
+   * @return The number of bytes released
+   */
+  uint32_t TrimMemoryPools();
+
   /**
    * @brief Register a processor
    *
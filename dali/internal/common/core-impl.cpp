@@ -42,11 +42,17 @@
 #include <dali/internal/event/render-tasks/render-task-list-impl.h>
 #include <dali/internal/event/size-negotiation/relayout-controller-impl.h>
 
+#include <dali/internal/update/animation/scene-graph-animation.h>
 #include <dali/internal/update/common/discard-queue.h>
 #include <dali/internal/update/manager/update-manager.h>
 #include <dali/internal/update/manager/render-task-processor.h>
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/update/render-tasks/scene-graph-render-task-list.h>
+#include <dali/internal/update/rendering/scene-graph-renderer.h>
+#include <dali/internal/update/rendering/scene-graph-texture-set.h>
 
 #include <dali/internal/render/common/performance-monitor.h>
+#include <dali/internal/render/common/render-item.h>
 #include <dali/internal/render/common/render-manager.h>
 #include <dali/internal/render/gl-resources/context.h>
 
@@ -153,6 +159,9 @@ Core::~Core()
   ThreadLocalStorage* tls = ThreadLocalStorage::GetInternal();
   if( tls )
   {
+    // Write the shader binaries which have not been saved yet, while the platform abstraction can be reached
+    mShaderFactory->SaveArchive();
+
     tls->Remove();
     tls->Unreference();
   }
@@ -292,6 +301,12 @@ void Core::ProcessEvents()
 
   mNotificationManager->ProcessMessages();
 
+  // Write the shader binaries received from the render thread together, once they stop arriving
+  if( mShaderFactory->SaveArchiveWhenIdle() )
+  {
+    mRenderController.RequestProcessEventsOnIdle( false );
+  }
+
   // Emit signal here to inform listeners that event processing has finished.
   for( auto scene : scenes )
   {
@@ -335,6 +350,30 @@ uint32_t Core::GetMaximumUpdateCount() const
   return MAXIMUM_UPDATE_COUNT;
 }
 
+void Core::SetUpdateWorkerThreadCount( uint32_t threadCount )
+{
+  SetWorkerThreadCountMessage( *mUpdateManager, threadCount );
+}
+
+void Core::SetProgramCacheBudget( uint32_t programCount )
+{
+  SetProgramCacheBudgetMessage( *mUpdateManager, programCount );
+}
+
+uint32_t Core::TrimMemoryPools()
+{
+  // The pools are shared with the update and render threads, which only use their thread-safe calls
+  uint32_t released = SceneGraph::Node::TrimMemoryPool();
+  released += SceneGraph::Renderer::TrimMemoryPool();
+  released += SceneGraph::TextureSet::TrimMemoryPool();
+  released += SceneGraph::Animation::TrimMemoryPool();
+  released += SceneGraph::RenderTaskList::TrimMemoryPool();
+  released += SceneGraph::RenderItem::TrimMemoryPool();
+
+  DALI_LOG_INFO( gCoreFilter, Debug::General, "Core::TrimMemoryPools() released %u bytes\n", released );
+  return released;
+}
+
 void Core::RegisterProcessor( Integration::Processor& processor )
 {
   mProcessors.PushBack(&processor);
@@ -472,6 +511,11 @@ uint32_t* Core::ReserveMessageSlot( uint32_t size, bool updateScene )
   return mUpdateManager->ReserveMessageSlot( size, updateScene );
 }
 
+uint32_t* Core::ReservePropertyMessageSlot( uint32_t size, const void* property )
+{
+  return mUpdateManager->ReservePropertyMessageSlot( size, property );
+}
+
 BufferIndex Core::GetEventBufferIndex() const
 {
   return mUpdateManager->GetEventBufferIndex();
@@ -174,6 +174,21 @@ public:
    */
   uint32_t GetMaximumUpdateCount() const;
 
+  /**
+   * @copydoc Dali::Integration::Core::SetUpdateWorkerThreadCount()
+   */
+  void SetUpdateWorkerThreadCount( uint32_t threadCount );
+
+  /**
+   * @copydoc Dali::Integration::Core::SetProgramCacheBudget()
+   */
+  void SetProgramCacheBudget( uint32_t programCount );
+
+  /**
+   * @copydoc Dali::Integration::Core::TrimMemoryPools()
+   */
+  uint32_t TrimMemoryPools();
+
   /**
    * @copydoc Dali::Integration::Core::RegisterProcessor
    */
@@ -227,6 +242,11 @@ public: // Implementation of EventThreadServices
    */
   uint32_t* ReserveMessageSlot( uint32_t size, bool updateScene ) override;
 
+  /**
+   * @copydoc EventThreadServices::ReservePropertyMessageSlot
+   */
+  uint32_t* ReservePropertyMessageSlot( uint32_t size, const void* property ) override;
+
   /**
    * @copydoc EventThreadServices::GetEventBufferIndex
    */
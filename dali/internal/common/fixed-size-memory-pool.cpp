@@ -18,6 +18,11 @@
 // CLASS HEADER
 #include <dali/internal/common/fixed-size-memory-pool.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 // INTERNAL HEADERS
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/public-api/common/dali-common.h>
@@ -28,6 +33,36 @@ namespace Dali
 namespace Internal
 {
 
+namespace
+{
+
+const FixedSizeMemoryPool::SizeType MAGAZINE_CAPACITY = 64; ///< The number of freed allocations a thread keeps before returning them to the pool
+const FixedSizeMemoryPool::SizeType MAGAZINE_REFILL = 32;   ///< The number of allocations taken from the pool under the lock when a magazine is empty
+
+std::atomic< uint64_t > gNextPoolId( 1u ); ///< Identifies the pools in the thread caches; unlike the address it is never reused
+
+/**
+ * @brief Reads the address of the next allocation in a free list, stored in the allocation itself.
+ */
+inline void*& NextFree( void* memory )
+{
+  return *( reinterpret_cast< void** >( memory ) );
+}
+
+/**
+ * @brief Finds the last allocation of a free list.
+ */
+inline void* LastFree( void* memory )
+{
+  while( NextFree( memory ) )
+  {
+    memory = NextFree( memory );
+  }
+  return memory;
+}
+
+} // unnamed namespace
+
 /**
  * @brief Private implementation class
  */
@@ -42,19 +77,15 @@ struct FixedSizeMemoryPool::Impl
   {
     void* blockMemory;      ///< The allocated memory from which allocations can be made
     Block* nextBlock;       ///< The next block in the linked list
-#ifdef DEBUG_ENABLED
-    SizeType mBlockSize; ///< Size of the block in bytes
-#endif
+    SizeType mBlockSize;    ///< Size of the block in bytes
     /**
      * @brief Construct a new block with given size
      *
      * @param size The size of the memory block to allocate in bytes. Must be non-zero.
      */
     Block( SizeType size )
-    : nextBlock( nullptr )
-#ifdef DEBUG_ENABLED
-      ,mBlockSize( size )
-#endif
+    : nextBlock( nullptr ),
+      mBlockSize( size )
     {
       blockMemory = ::operator new( size );
       DALI_ASSERT_ALWAYS( blockMemory && "Out of memory" );
@@ -81,13 +112,19 @@ struct FixedSizeMemoryPool::Impl
    */
   Impl( SizeType fixedSize, SizeType initialCapacity, SizeType maximumBlockCapacity )
   :  mMutex(),
+     mId( gNextPoolId.fetch_add( 1u, std::memory_order_relaxed ) ),
      mFixedSize( fixedSize ),
      mMemoryBlocks( initialCapacity * mFixedSize ),
      mMaximumBlockCapacity( maximumBlockCapacity ),
      mCurrentBlock( &mMemoryBlocks ),
      mCurrentBlockCapacity( initialCapacity ),
      mCurrentBlockSize( 0 ),
-     mDeletedObjects( nullptr )
+     mDeletedObjects( nullptr ),
+     mReturnedObjects( nullptr ),
+     mLiveObjects( 0u ),
+     mPeakLiveObjects( 0u ),
+     mBlockCount( 1u ),
+     mCapacity( initialCapacity )
   {
     // We need enough room to store the deleted list in the data
     DALI_ASSERT_DEBUG( mFixedSize >= sizeof( void* ) );
@@ -128,6 +165,180 @@ struct FixedSizeMemoryPool::Impl
     mCurrentBlock = block;
 
     mCurrentBlockSize = 0;
+
+    ++mBlockCount;
+    mCapacity += mCurrentBlockCapacity;
+  }
+
+  /**
+   * @brief Take an allocation from the deleted objects list or the current block
+   *
+   * @return The allocation
+   */
+  void* TakeObject()
+  {
+    // First, recycle deleted objects
+    if( mDeletedObjects )
+    {
+      void* recycled = mDeletedObjects;
+      mDeletedObjects = NextFree( mDeletedObjects );  // Pop head off front of deleted objects list
+      return recycled;
+    }
+
+    // Check if current block is full
+    if( mCurrentBlockSize >= mCurrentBlockCapacity )
+    {
+      AllocateNewBlock();
+    }
+
+    uint8_t* objectAddress = static_cast< uint8_t* >( mCurrentBlock->blockMemory );
+    objectAddress += mCurrentBlockSize * mFixedSize;
+    mCurrentBlockSize++;
+
+    return objectAddress;
+  }
+
+  /**
+   * @brief Push a list of allocations onto the returned objects list without locking
+   *
+   * @param[in] first The first allocation of the list
+   * @param[in] last The last allocation of the list
+   */
+  void ReturnObjects( void* first, void* last )
+  {
+    void* head = mReturnedObjects.load( std::memory_order_relaxed );
+    do
+    {
+      NextFree( last ) = head;
+    }
+    while( !mReturnedObjects.compare_exchange_weak( head, first, std::memory_order_release, std::memory_order_relaxed ) );
+  }
+
+  /**
+   * @brief Release the blocks of which every allocation is in the deleted objects list
+   *
+   * Only blocks which have been filled can be released, so the first and the current block are kept.
+   * @return The number of bytes released
+   */
+  SizeType Trim()
+  {
+    // Allocations given back by other threads are free as well
+    void* returned = mReturnedObjects.exchange( nullptr, std::memory_order_acquire );
+    while( returned )
+    {
+      void* next = NextFree( returned );
+      NextFree( returned ) = mDeletedObjects;
+      mDeletedObjects = returned;
+      returned = next;
+    }
+
+    struct BlockRange
+    {
+      const uint8_t* begin;
+      const uint8_t* end;
+      SizeType freeCount;
+    };
+
+    std::vector< BlockRange > ranges;
+    for( Block* block = mMemoryBlocks.nextBlock; block; block = block->nextBlock )
+    {
+      if( block != mCurrentBlock )
+      {
+        const uint8_t* begin = static_cast< const uint8_t* >( block->blockMemory );
+        ranges.push_back( BlockRange{ begin, begin + block->mBlockSize, 0u } );
+      }
+    }
+    if( ranges.empty() )
+    {
+      return 0u;
+    }
+
+    // Sorting by address lets each allocation find its block with a binary search
+    std::sort( ranges.begin(), ranges.end(), []( const BlockRange& lhs, const BlockRange& rhs ) { return lhs.begin < rhs.begin; } );
+    auto findRange = [&ranges]( const void* memory ) -> BlockRange*
+    {
+      const uint8_t* address = static_cast< const uint8_t* >( memory );
+      auto iter = std::upper_bound( ranges.begin(), ranges.end(), address, []( const uint8_t* value, const BlockRange& range ) { return value < range.begin; } );
+      if( iter == ranges.begin() || address >= ( iter - 1 )->end )
+      {
+        return nullptr;
+      }
+      return &*( iter - 1 );
+    };
+
+    for( void* object = mDeletedObjects; object; object = NextFree( object ) )
+    {
+      BlockRange* range = findRange( object );
+      if( range )
+      {
+        ++range->freeCount;
+      }
+    }
+
+    auto isFree = [this]( const BlockRange* range )
+    {
+      return range && static_cast< SizeType >( range->end - range->begin ) == range->freeCount * mFixedSize;
+    };
+
+    if( std::none_of( ranges.begin(), ranges.end(), [&isFree]( const BlockRange& range ) { return isFree( &range ); } ) )
+    {
+      return 0u;
+    }
+
+    // Unlink the allocations of the free blocks from the deleted objects list
+    void** link = &mDeletedObjects;
+    while( *link )
+    {
+      if( isFree( findRange( *link ) ) )
+      {
+        *link = NextFree( *link );
+      }
+      else
+      {
+        link = &NextFree( *link );
+      }
+    }
+
+    SizeType released = 0u;
+    Block* previous = &mMemoryBlocks;
+    while( previous->nextBlock )
+    {
+      Block* block = previous->nextBlock;
+      if( block != mCurrentBlock && isFree( findRange( block->blockMemory ) ) )
+      {
+        previous->nextBlock = block->nextBlock;
+        released += block->mBlockSize;
+        mCapacity -= block->mBlockSize / mFixedSize;
+        --mBlockCount;
+        delete block;
+      }
+      else
+      {
+        previous = block;
+      }
+    }
+
+    return released;
+  }
+
+  /**
+   * @brief Count an allocation handed to the client
+   */
+  void CountAllocation()
+  {
+    const SizeType live = mLiveObjects.fetch_add( 1u, std::memory_order_relaxed ) + 1u;
+    SizeType peak = mPeakLiveObjects.load( std::memory_order_relaxed );
+    while( live > peak && !mPeakLiveObjects.compare_exchange_weak( peak, live, std::memory_order_relaxed ) )
+    {
+    }
+  }
+
+  /**
+   * @brief Count an allocation given back by the client
+   */
+  void CountFree()
+  {
+    mLiveObjects.fetch_sub( 1u, std::memory_order_relaxed );
   }
 #ifdef DEBUG_ENABLED
 
@@ -156,6 +367,7 @@ struct FixedSizeMemoryPool::Impl
 #endif
 
   Mutex mMutex;                       ///< Mutex for thread-safe allocation and deallocation
+  const uint64_t mId;                 ///< Unique identifier of the pool
 
   SizeType mFixedSize;                ///< The size of each allocation in bytes
 
@@ -167,40 +379,102 @@ struct FixedSizeMemoryPool::Impl
   SizeType mCurrentBlockSize;         ///< The number of allocations allocated to the current block
 
   void* mDeletedObjects;              ///< Pointer to the head of the list of deleted objects. The addresses are stored in the allocated memory blocks.
+
+  std::atomic< void* > mReturnedObjects;      ///< Head of the list of objects freed by threads with a full magazine, taken in one go by an allocating thread
+  std::atomic< SizeType > mLiveObjects;       ///< The number of allocations in use
+  std::atomic< SizeType > mPeakLiveObjects;   ///< The largest number of allocations in use at once
+  SizeType mBlockCount;                       ///< The number of allocated memory blocks
+  SizeType mCapacity;                         ///< The number of allocations the memory blocks can hold
+
+  /**
+   * @brief A thread's cache of free allocations for one pool
+   */
+  struct Magazine
+  {
+    uint64_t poolId;                                   ///< The identifier of the pool
+    std::weak_ptr< Impl > pool;   ///< The pool, used to give the allocations back when the thread exits
+    void* objects;                                     ///< Head of the list of cached allocations
+    void* last;                                        ///< Tail of the list of cached allocations
+    void* overflow;                                    ///< Head of the allocations taken from the returned list which did not fit in the magazine
+    SizeType count;               ///< The number of cached allocations
+  };
+
+  /**
+   * @brief The magazines of a thread, one per pool it has used
+   */
+  struct ThreadCache
+  {
+    ~ThreadCache()
+    {
+      for( auto& magazine : magazines )
+      {
+        auto pool = magazine.pool.lock();
+        if( pool && magazine.objects )
+        {
+          pool->ReturnObjects( magazine.objects, magazine.last );
+        }
+        if( pool && magazine.overflow )
+        {
+          pool->ReturnObjects( magazine.overflow, LastFree( magazine.overflow ) );
+        }
+      }
+    }
+
+    /**
+     * @brief Find the magazine of the pool, adding one if this thread has not used the pool yet
+     *
+     * @param[in] impl The implementation of the pool
+     * @return The magazine
+     */
+    Magazine& GetMagazine( const std::shared_ptr< Impl >& impl )
+    {
+      if( lastUsed < magazines.size() && magazines[ lastUsed ].poolId == impl->mId )
+      {
+        return magazines[ lastUsed ];
+      }
+
+      for( std::size_t index = 0u; index < magazines.size(); ++index )
+      {
+        if( magazines[ index ].poolId == impl->mId )
+        {
+          lastUsed = index;
+          return magazines[ index ];
+        }
+      }
+
+      // Drop the magazines of destroyed pools; their allocations went with the pool's memory
+      for( auto iter = magazines.begin(); iter != magazines.end(); )
+      {
+        iter = iter->pool.expired() ? magazines.erase( iter ) : iter + 1;
+      }
+
+      magazines.push_back( Magazine{ impl->mId, impl, nullptr, nullptr, nullptr, 0u } );
+      lastUsed = magazines.size() - 1u;
+      return magazines.back();
+    }
+
+    std::vector< Magazine > magazines; ///< The magazines
+    std::size_t lastUsed = 0u;         ///< Index of the most recently used magazine
+  };
+
+  static thread_local ThreadCache sThreadCache; ///< The magazines of the calling thread
 };
 
+thread_local FixedSizeMemoryPool::Impl::ThreadCache FixedSizeMemoryPool::Impl::sThreadCache;
+
 FixedSizeMemoryPool::FixedSizeMemoryPool( SizeType fixedSize, SizeType initialCapacity, SizeType maximumBlockCapacity )
+: mImpl( std::make_shared< Impl >( fixedSize, initialCapacity, maximumBlockCapacity ) )
 {
-  mImpl = new Impl( fixedSize, initialCapacity, maximumBlockCapacity );
 }
 
 FixedSizeMemoryPool::~FixedSizeMemoryPool()
 {
-  delete mImpl;
 }
 
 void* FixedSizeMemoryPool::Allocate()
 {
-  // First, recycle deleted objects
-  if( mImpl->mDeletedObjects )
-  {
-    void* recycled = mImpl->mDeletedObjects;
-    mImpl->mDeletedObjects = *( reinterpret_cast< void** >( mImpl->mDeletedObjects ) );  // Pop head off front of deleted objects list
-    return recycled;
-  }
-
-  // Check if current block is full
-  if( mImpl->mCurrentBlockSize >= mImpl->mCurrentBlockCapacity )
-  {
-    mImpl->AllocateNewBlock();
-  }
-
-  // Placement new the object in block memory
-  uint8_t* objectAddress = static_cast< uint8_t* >( mImpl->mCurrentBlock->blockMemory );
-  objectAddress += mImpl->mCurrentBlockSize * mImpl->mFixedSize;
-  mImpl->mCurrentBlockSize++;
-
-  return objectAddress;
+  mImpl->CountAllocation();
+  return mImpl->TakeObject();
 }
 
 void FixedSizeMemoryPool::Free( void* memory )
@@ -209,21 +483,124 @@ void FixedSizeMemoryPool::Free( void* memory )
   mImpl->CheckMemoryIsInsidePool( memory );
 #endif
 
+  mImpl->CountFree();
+
   // Add memory to head of deleted objects list. Store next address in the same memory space as the old object.
-  *( reinterpret_cast< void** >( memory ) ) = mImpl->mDeletedObjects;
+  NextFree( memory ) = mImpl->mDeletedObjects;
   mImpl->mDeletedObjects = memory;
 }
 
 void* FixedSizeMemoryPool::AllocateThreadSafe()
 {
-  Mutex::ScopedLock lock( mImpl->mMutex );
-  return Allocate();
+  Impl::Magazine& magazine = Impl::sThreadCache.GetMagazine( mImpl );
+
+  if( !magazine.objects )
+  {
+    // Take everything other threads have given back, or a batch from the pool if there is nothing
+    if( !magazine.overflow )
+    {
+      magazine.overflow = mImpl->mReturnedObjects.exchange( nullptr, std::memory_order_acquire );
+    }
+
+    if( magazine.overflow )
+    {
+      // Fill the magazine from the head of the list, the rest stays with this thread for the next refills
+      magazine.objects = magazine.overflow;
+      magazine.last = magazine.overflow;
+      magazine.count = 1u;
+      while( magazine.count < MAGAZINE_CAPACITY && NextFree( magazine.last ) )
+      {
+        magazine.last = NextFree( magazine.last );
+        ++magazine.count;
+      }
+
+      magazine.overflow = NextFree( magazine.last );
+      NextFree( magazine.last ) = nullptr;
+    }
+    else
+    {
+      Mutex::ScopedLock lock( mImpl->mMutex );
+      for( SizeType i = 0u; i < MAGAZINE_REFILL; ++i )
+      {
+        void* object = mImpl->TakeObject();
+        NextFree( object ) = magazine.objects;
+        magazine.objects = object;
+        if( i == 0u )
+        {
+          magazine.last = object;
+        }
+      }
+      magazine.count = MAGAZINE_REFILL;
+    }
+  }
+
+  void* object = magazine.objects;
+  magazine.objects = NextFree( object );
+  --magazine.count;
+
+  mImpl->CountAllocation();
+  return object;
 }
 
 void FixedSizeMemoryPool::FreeThreadSafe( void* memory )
+{
+#ifdef DEBUG_ENABLED
+  {
+    Mutex::ScopedLock lock( mImpl->mMutex );
+    mImpl->CheckMemoryIsInsidePool( memory );
+  }
+#endif
+
+  mImpl->CountFree();
+
+  Impl::Magazine& magazine = Impl::sThreadCache.GetMagazine( mImpl );
+  if( magazine.count >= MAGAZINE_CAPACITY )
+  {
+    // Typically the objects were allocated by another thread, which will take them back from here
+    mImpl->ReturnObjects( magazine.objects, magazine.last );
+    magazine.objects = nullptr;
+    magazine.count = 0u;
+  }
+
+  if( !magazine.objects )
+  {
+    magazine.last = memory;
+  }
+  NextFree( memory ) = magazine.objects;
+  magazine.objects = memory;
+  ++magazine.count;
+}
+
+FixedSizeMemoryPool::SizeType FixedSizeMemoryPool::Trim()
+{
+  Mutex::ScopedLock lock( mImpl->mMutex );
+
+  // Put the calling thread's cached allocations back in the pool so they do not keep their blocks
+  Impl::Magazine& magazine = Impl::sThreadCache.GetMagazine( mImpl );
+  if( magazine.objects )
+  {
+    NextFree( magazine.last ) = mImpl->mDeletedObjects;
+    mImpl->mDeletedObjects = magazine.objects;
+    magazine.objects = nullptr;
+    magazine.count = 0u;
+  }
+  if( magazine.overflow )
+  {
+    NextFree( LastFree( magazine.overflow ) ) = mImpl->mDeletedObjects;
+    mImpl->mDeletedObjects = magazine.overflow;
+    magazine.overflow = nullptr;
+  }
+
+  return mImpl->Trim();
+}
+
+FixedSizeMemoryPool::Statistics FixedSizeMemoryPool::GetStatistics() const
 {
   Mutex::ScopedLock lock( mImpl->mMutex );
-  Free( memory );
+  return Statistics{ mImpl->mLiveObjects.load( std::memory_order_relaxed ),
+                     mImpl->mPeakLiveObjects.load( std::memory_order_relaxed ),
+                     mImpl->mBlockCount,
+                     mImpl->mCapacity };
 }
 
 
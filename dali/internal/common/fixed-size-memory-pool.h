@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <stdint.h>
 #include <cstddef>
+#include <memory>
 
 namespace Dali
 {
@@ -48,12 +49,28 @@ struct TypeSizeWithAlignment
  * to ensure that the size of the block takes memory alignment into account for the
  * type of data they wish to store in the block. The TypeSizeWithAlignment<T> template
  * can be useful for determining the size of memory aligned blocks for a given type.
+ *
+ * The thread-safe allocation path keeps a small cache (magazine) of free allocations per thread,
+ * so most calls neither lock nor share data with other threads. Allocations freed by a thread whose
+ * magazine is full are pushed onto a lock-free list that any thread can take back in one go; this is
+ * the path taken when objects are allocated on one thread and freed on another.
  */
 class FixedSizeMemoryPool
 {
 public:
   using SizeType = uint32_t;
 
+  /**
+   * @brief Usage statistics of the pool
+   */
+  struct Statistics
+  {
+    SizeType liveObjects;     ///< The number of allocations currently in use
+    SizeType peakLiveObjects; ///< The largest number of allocations that have been in use at once
+    SizeType blockCount;      ///< The number of memory blocks allocated
+    SizeType capacity;        ///< The total number of allocations the blocks can hold
+  };
+
 public:
 
   /**
@@ -100,6 +117,23 @@ public:
    */
   void FreeThreadSafe( void* memory );
 
+  /**
+   * @brief Release the memory blocks of which no allocation is in use
+   *
+   * Allocations cached by threads other than the calling one keep their blocks, as does the first block.
+   * Must not be called while another thread uses Allocate() or Free().
+   * @return The number of bytes released
+   */
+  SizeType Trim();
+
+  /**
+   * @brief Retrieve the usage statistics of the pool
+   *
+   * Allocations cached by a thread after FreeThreadSafe() are not counted as live.
+   * @return The statistics
+   */
+  Statistics GetStatistics() const;
+
 private:
 
   // Undefined
@@ -111,7 +145,7 @@ private:
 private:
 
   struct Impl;
-  Impl* mImpl;
+  std::shared_ptr< Impl > mImpl; ///< Shared with the per-thread caches, which only keep a weak reference
 
 };
 
@@ -0,0 +1,148 @@
+#ifndef DALI_INTERNAL_LOCK_FREE_RING_H
+#define DALI_INTERNAL_LOCK_FREE_RING_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <cstdint> // uint32_t
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * A bounded queue for passing items from one thread to another without locking.
+ *
+ * Only one thread may call Push() (the producer) and only one thread may call Pop() (the consumer).
+ * The items are stored in a fixed array allocated on construction, so neither call allocates memory.
+ */
+template< typename T >
+class LockFreeRing
+{
+public:
+
+  /**
+   * Constructor
+   * @param[in] capacity The maximum number of items in the ring, must be a power of two
+   */
+  explicit LockFreeRing( uint32_t capacity )
+  : mItems( capacity ),
+    mMask( capacity - 1u ),
+    mHead( 0u ),
+    mTail( 0u ),
+    mHighWaterMark( 0u )
+  {
+    DALI_ASSERT_DEBUG( capacity > 0u && ( capacity & mMask ) == 0u && "Capacity must be a power of two" );
+  }
+
+  /**
+   * Adds an item to the back of the ring, called by the producer.
+   * @param[in] item The item to add
+   * @return false if the ring is full
+   */
+  bool Push( const T& item )
+  {
+    const uint32_t tail = mTail.load( std::memory_order_relaxed );
+    const uint32_t count = tail - mHead.load( std::memory_order_acquire );
+    if( count > mMask )
+    {
+      return false;
+    }
+
+    mItems[ tail & mMask ] = item;
+    mTail.store( tail + 1u, std::memory_order_release );
+
+    if( count >= mHighWaterMark.load( std::memory_order_relaxed ) )
+    {
+      mHighWaterMark.store( count + 1u, std::memory_order_relaxed );
+    }
+    return true;
+  }
+
+  /**
+   * Removes the item at the front of the ring, called by the consumer.
+   * @param[out] item The removed item
+   * @return false if the ring is empty
+   */
+  bool Pop( T& item )
+  {
+    const uint32_t head = mHead.load( std::memory_order_relaxed );
+    if( head == mTail.load( std::memory_order_acquire ) )
+    {
+      return false;
+    }
+
+    item = mItems[ head & mMask ];
+    mHead.store( head + 1u, std::memory_order_release );
+    return true;
+  }
+
+  /**
+   * Gets the number of items in the ring.
+   * The result is exact when called by the consumer once the producer has stopped, otherwise it is
+   * the number of items that can at least be popped (by the consumer) or pushed over (by the producer).
+   * @return The number of items
+   */
+  uint32_t GetCount() const
+  {
+    return mTail.load( std::memory_order_acquire ) - mHead.load( std::memory_order_acquire );
+  }
+
+  /**
+   * @return The maximum number of items in the ring
+   */
+  uint32_t GetCapacity() const
+  {
+    return mMask + 1u;
+  }
+
+  /**
+   * @return The largest number of items the ring has held
+   */
+  uint32_t GetHighWaterMark() const
+  {
+    return mHighWaterMark.load( std::memory_order_relaxed );
+  }
+
+private:
+
+  // Undefined
+  LockFreeRing( const LockFreeRing& ) = delete;
+  LockFreeRing& operator=( const LockFreeRing& ) = delete;
+
+private:
+
+  std::vector< T > mItems;                   ///< The storage of the items
+  const uint32_t mMask;                      ///< The capacity minus one, to wrap the indices
+  alignas( 64 ) std::atomic< uint32_t > mHead; ///< The index of the next item to pop, written by the consumer
+  alignas( 64 ) std::atomic< uint32_t > mTail; ///< The index of the next item to push, written by the producer
+  std::atomic< uint32_t > mHighWaterMark;    ///< The largest count seen by the producer
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_LOCK_FREE_RING_H
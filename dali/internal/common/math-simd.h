@@ -0,0 +1,146 @@
+#ifndef DALI_INTERNAL_MATH_SIMD_H
+#define DALI_INTERNAL_MATH_SIMD_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+/**
+ * The SIMD backend used by the math kernels is selected at compile time:
+ * - DALI_MATH_SIMD_SSE  : x86 / x86-64 with SSE intrinsics
+ * - DALI_MATH_SIMD_NEON : AArch64 with NEON intrinsics
+ * 32-bit ARM builds with __ARM_NEON__ keep using the hand written NEON assembly instead.
+ * Any other target uses the scalar code.
+ */
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 1 ) )
+#define DALI_MATH_SIMD_SSE
+#include <xmmintrin.h>
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#define DALI_MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined( DALI_MATH_SIMD_SSE ) || defined( DALI_MATH_SIMD_NEON )
+#define DALI_MATH_SIMD
+#endif
+
+#ifdef DALI_MATH_SIMD
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Simd
+{
+
+#ifdef DALI_MATH_SIMD_SSE
+
+typedef __m128 Float4;
+
+inline Float4 Load( const float* values )
+{
+  return _mm_loadu_ps( values );
+}
+
+inline void Store( float* values, Float4 vector )
+{
+  _mm_storeu_ps( values, vector );
+}
+
+inline Float4 Multiply( Float4 vector, float scalar )
+{
+  return _mm_mul_ps( vector, _mm_set1_ps( scalar ) );
+}
+
+inline Float4 MultiplyAdd( Float4 accumulator, Float4 vector, float scalar )
+{
+  return _mm_add_ps( accumulator, _mm_mul_ps( vector, _mm_set1_ps( scalar ) ) );
+}
+
+#else // DALI_MATH_SIMD_NEON
+
+typedef float32x4_t Float4;
+
+inline Float4 Load( const float* values )
+{
+  return vld1q_f32( values );
+}
+
+inline void Store( float* values, Float4 vector )
+{
+  vst1q_f32( values, vector );
+}
+
+inline Float4 Multiply( Float4 vector, float scalar )
+{
+  return vmulq_n_f32( vector, scalar );
+}
+
+inline Float4 MultiplyAdd( Float4 accumulator, Float4 vector, float scalar )
+{
+  return vmlaq_n_f32( accumulator, vector, scalar );
+}
+
+#endif
+
+/**
+ * @brief Loads the four rows of a 4x4 matrix.
+ *
+ * @param[out] rows The rows of the matrix
+ * @param[in] matrix The 16 floats of the matrix
+ */
+inline void LoadMatrix( Float4 rows[4], const float* matrix )
+{
+  rows[0] = Load( matrix );
+  rows[1] = Load( matrix + 4 );
+  rows[2] = Load( matrix + 8 );
+  rows[3] = Load( matrix + 12 );
+}
+
+/**
+ * @brief Multiplies a matrix by a matrix whose rows have already been loaded.
+ *
+ * Each row of the result only depends on the same row of lhs, so result may alias lhs.
+ * @param[out] result The 16 floats of the result
+ * @param[in] lhs The 16 floats of the matrix to multiply
+ * @param[in] rhsRows The rows of the matrix to multiply by
+ */
+inline void MultiplyMatrix( float* result, const float* lhs, const Float4 rhsRows[4] )
+{
+  for( int32_t i = 0; i < 16; i += 4 )
+  {
+    Float4 row = Multiply( rhsRows[0], lhs[i] );
+    row = MultiplyAdd( row, rhsRows[1], lhs[i + 1] );
+    row = MultiplyAdd( row, rhsRows[2], lhs[i + 2] );
+    row = MultiplyAdd( row, rhsRows[3], lhs[i + 3] );
+    Store( result + i, row );
+  }
+}
+
+} // namespace Simd
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_MATH_SIMD
+
+#endif // DALI_INTERNAL_MATH_SIMD_H
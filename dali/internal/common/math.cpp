@@ -22,6 +22,7 @@
 #include <cmath>
 
 // INTERNAL INCLUDES
+#include <dali/internal/common/math-simd.h>
 #include <dali/internal/render/common/performance-monitor.h>
 #include <dali/public-api/common/constants.h>
 #include <dali/public-api/math/vector2.h>
@@ -79,4 +80,26 @@ float Dali::Internal::Length( const Vec3 v )
   return sqrtf(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
 }
 
+void Dali::Internal::MultiplyMatrices( Matrix* result, const Matrix* lhs, const Matrix& rhs, uint32_t count )
+{
+#ifdef DALI_MATH_SIMD
+
+  MATH_INCREASE_BY( PerformanceMonitor::MATRIX_MULTIPLYS, count );
+  MATH_INCREASE_BY( PerformanceMonitor::FLOAT_POINT_MULTIPLY, 64 * count );
+
+  Simd::Float4 rhsRows[4];
+  Simd::LoadMatrix( rhsRows, rhs.AsFloat() );
+  for( uint32_t i = 0; i < count; ++i )
+  {
+    Simd::MultiplyMatrix( result[i].AsFloat(), lhs[i].AsFloat(), rhsRows );
+  }
+
+#else
+
+  for( uint32_t i = 0; i < count; ++i )
+  {
+    Matrix::Multiply( result[i], lhs[i], rhs );
+  }
 
+#endif
+}
@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstdint> // uint32_t
+
 namespace Dali
 {
 
@@ -59,6 +62,19 @@ Vector2 Transform2D( const Matrix& matrix, const float x, const float y );
  */
 float Length( const Vec3 v );
 
+/**
+ * @brief Multiplies a batch of matrices by the same matrix, i.e. result[i] = lhs[i] * rhs.
+ *
+ * This is used to calculate the world matrices of several siblings from the world matrix of their parent.
+ * The rhs matrix is only loaded once for the whole batch, and result may alias lhs.
+ *
+ * @param[out] result The array of matrices to store the results in
+ * @param[in] lhs The array of matrices to multiply
+ * @param[in] rhs The matrix to multiply every matrix of lhs by
+ * @param[in] count The number of matrices in result and lhs
+ */
+void MultiplyMatrices( Matrix* result, const Matrix* lhs, const Matrix& rhs, uint32_t count );
+
 } // namespace Internal
 
 } // namespace Dali
@@ -147,6 +147,26 @@ public:
     mPool->FreeThreadSafe( object );
   }
 
+  /**
+   * @brief Release the memory of the pool which no object is using
+   *
+   * @return The number of bytes released
+   */
+  uint32_t Trim()
+  {
+    return mPool->Trim();
+  }
+
+  /**
+   * @brief Retrieve the usage statistics of the memory pool
+   *
+   * @return The statistics
+   */
+  FixedSizeMemoryPool::Statistics GetStatistics() const
+  {
+    return mPool->GetStatistics();
+  }
+
   /**
    * @brief Reset the memory pool, unloading all block memory previously allocated
    */
@@ -105,6 +105,25 @@ std::size_t MessageBuffer::GetCapacity() const
   return mCapacity * WORD_SIZE;
 }
 
+std::size_t MessageBuffer::GetSize() const
+{
+  return mSize * WORD_SIZE;
+}
+
+std::size_t MessageBuffer::GetSlotOffset( const uint32_t* slot ) const
+{
+  DALI_ASSERT_DEBUG( reinterpret_cast<const WordType*>( slot ) > mData && reinterpret_cast<const WordType*>( slot ) < mNextSlot );
+
+  return static_cast<std::size_t>( reinterpret_cast<const WordType*>( slot ) - mData );
+}
+
+uint32_t* MessageBuffer::GetSlot( std::size_t offset ) const
+{
+  DALI_ASSERT_DEBUG( offset < mSize );
+
+  return reinterpret_cast<uint32_t*>( mData + offset );
+}
+
 MessageBuffer::Iterator MessageBuffer::Begin() const
 {
   if ( 0 != mSize )
@@ -62,6 +62,27 @@ public:
    */
   std::size_t GetCapacity() const;
 
+  /**
+   * Query the size of the messages reserved in the buffer, including the size markers.
+   * @return The size with respect to the size of type "char".
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * Query the position of a reserved slot in the buffer.
+   * Unlike the slot address, the position remains valid when the buffer grows.
+   * @param[in] slot A slot returned by ReserveMessageSlot()
+   * @return The position with respect to the size of type WordType.
+   */
+  std::size_t GetSlotOffset( const uint32_t* slot ) const;
+
+  /**
+   * Retrieve a previously reserved slot.
+   * @param[in] offset The position returned by GetSlotOffset()
+   * @return A pointer to the address allocated for the message.
+   */
+  uint32_t* GetSlot( std::size_t offset ) const;
+
   /**
    * Used to iterate though the messages in the buffer.
    */
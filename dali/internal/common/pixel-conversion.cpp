@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/common/pixel-conversion.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define DALI_PIXEL_CONVERSION_SSE2
+#include <emmintrin.h>
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define DALI_PIXEL_CONVERSION_NEON
+#include <arm_neon.h>
+#endif
+
+// INTERNAL INCLUDES
+#include <dali/public-api/math/math-utils.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace PixelConversion
+{
+
+namespace
+{
+
+const uint32_t MINIMUM_PIXEL_COUNT_PER_CONVERSION_TASK = 128u * 1024u; ///< Smaller images are not worth splitting between threads
+const size_t MAXIMUM_RECYCLED_BUFFER_COUNT = 4u;                       ///< Older recycled buffers are freed, so an image size which is no longer uploaded does not keep its buffer
+
+/**
+ * @brief Multiplies two channel values and divides by 255, rounding to the nearest value.
+ */
+inline uint8_t MultiplyChannel( uint32_t value, uint32_t alpha )
+{
+  const uint32_t product = value * alpha + 128u;
+  return static_cast<uint8_t>( ( product + ( product >> 8u ) ) >> 8u );
+}
+
+#ifdef DALI_PIXEL_CONVERSION_SSE2
+
+inline __m128i Load( const uint8_t* source )
+{
+  return _mm_loadu_si128( reinterpret_cast<const __m128i*>( source ) );
+}
+
+inline void Store( uint8_t* destination, __m128i pixels )
+{
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( destination ), pixels );
+}
+
+/**
+ * @brief Expands the four RGB888 pixels in the first 12 bytes of a register to RGBA8888.
+ */
+inline __m128i ExpandRgbToRgba( __m128i rgb, __m128i alphaMask )
+{
+  // Each pixel starts 3 bytes after the previous one, so shifting brings it to the start of the register;
+  // the byte following it is then replaced by the alpha
+  const __m128i pixels01 = _mm_unpacklo_epi32( rgb, _mm_srli_si128( rgb, 3 ) );
+  const __m128i pixels23 = _mm_unpacklo_epi32( _mm_srli_si128( rgb, 6 ), _mm_srli_si128( rgb, 9 ) );
+  return _mm_or_si128( _mm_unpacklo_epi64( pixels01, pixels23 ), alphaMask );
+}
+
+/**
+ * @brief Premultiplies two RGBA8888 pixels widened to 16 bits per channel.
+ */
+inline __m128i PremultiplyWidePixels( __m128i pixels, __m128i colourMask, __m128i alphaMultiplier, __m128i half )
+{
+  // Multiply the colour channels by the alpha and the alpha channel by 255, which leaves it unchanged
+  __m128i multiplier = _mm_shufflehi_epi16( _mm_shufflelo_epi16( pixels, _MM_SHUFFLE( 3, 3, 3, 3 ) ), _MM_SHUFFLE( 3, 3, 3, 3 ) );
+  multiplier = _mm_or_si128( _mm_and_si128( multiplier, colourMask ), alphaMultiplier );
+
+  const __m128i product = _mm_add_epi16( _mm_mullo_epi16( pixels, multiplier ), half );
+  return _mm_srli_epi16( _mm_add_epi16( product, _mm_srli_epi16( product, 8 ) ), 8 );
+}
+
+#endif // DALI_PIXEL_CONVERSION_SSE2
+
+} // unnamed namespace
+
+void ConvertRgbToRgba( uint8_t* destination, const uint8_t* source, uint32_t pixelCount )
+{
+  uint32_t i = 0u;
+
+#if defined( DALI_PIXEL_CONVERSION_SSE2 )
+  const __m128i alphaMask = _mm_set1_epi32( static_cast<int>( 0xFF000000u ) );
+  for( ; i + 16u <= pixelCount; i += 16u )
+  {
+    // Sixteen pixels are three registers of source data; realign them so each register starts with four whole pixels
+    const uint8_t* rgb = source + i * 3u;
+    const __m128i first = Load( rgb );
+    const __m128i second = Load( rgb + 16u );
+    const __m128i third = Load( rgb + 32u );
+
+    uint8_t* rgba = destination + i * 4u;
+    Store( rgba,       ExpandRgbToRgba( first, alphaMask ) );
+    Store( rgba + 16u, ExpandRgbToRgba( _mm_or_si128( _mm_srli_si128( first, 12 ), _mm_slli_si128( second, 4 ) ), alphaMask ) );
+    Store( rgba + 32u, ExpandRgbToRgba( _mm_or_si128( _mm_srli_si128( second, 8 ), _mm_slli_si128( third, 8 ) ), alphaMask ) );
+    Store( rgba + 48u, ExpandRgbToRgba( _mm_srli_si128( third, 4 ), alphaMask ) );
+  }
+#elif defined( DALI_PIXEL_CONVERSION_NEON )
+  for( ; i + 16u <= pixelCount; i += 16u )
+  {
+    const uint8x16x3_t rgb = vld3q_u8( source + i * 3u );
+    uint8x16x4_t rgba;
+    rgba.val[0] = rgb.val[0];
+    rgba.val[1] = rgb.val[1];
+    rgba.val[2] = rgb.val[2];
+    rgba.val[3] = vdupq_n_u8( 0xFF );
+    vst4q_u8( destination + i * 4u, rgba );
+  }
+#endif
+
+  for( ; i < pixelCount; ++i )
+  {
+    destination[i * 4u]      = source[i * 3u];
+    destination[i * 4u + 1u] = source[i * 3u + 1u];
+    destination[i * 4u + 2u] = source[i * 3u + 2u];
+    destination[i * 4u + 3u] = 0xFF;
+  }
+}
+
+void SwapRedAndBlue( uint8_t* destination, const uint8_t* source, uint32_t pixelCount )
+{
+  uint32_t i = 0u;
+
+#if defined( DALI_PIXEL_CONVERSION_SSE2 )
+  const __m128i greenAlphaMask = _mm_set1_epi32( static_cast<int>( 0xFF00FF00u ) );
+  for( ; i + 4u <= pixelCount; i += 4u )
+  {
+    const __m128i pixels = Load( source + i * 4u );
+    const __m128i redBlue = _mm_andnot_si128( greenAlphaMask, pixels );
+    const __m128i swapped = _mm_or_si128( _mm_slli_epi32( redBlue, 16 ), _mm_srli_epi32( redBlue, 16 ) );
+    Store( destination + i * 4u, _mm_or_si128( _mm_and_si128( pixels, greenAlphaMask ), swapped ) );
+  }
+#elif defined( DALI_PIXEL_CONVERSION_NEON )
+  for( ; i + 16u <= pixelCount; i += 16u )
+  {
+    uint8x16x4_t pixels = vld4q_u8( source + i * 4u );
+    const uint8x16_t first = pixels.val[0];
+    pixels.val[0] = pixels.val[2];
+    pixels.val[2] = first;
+    vst4q_u8( destination + i * 4u, pixels );
+  }
+#endif
+
+  for( ; i < pixelCount; ++i )
+  {
+    const uint8_t first = source[i * 4u];
+    destination[i * 4u]      = source[i * 4u + 2u];
+    destination[i * 4u + 1u] = source[i * 4u + 1u];
+    destination[i * 4u + 2u] = first;
+    destination[i * 4u + 3u] = source[i * 4u + 3u];
+  }
+}
+
+void PremultiplyAlpha( uint8_t* destination, const uint8_t* source, uint32_t pixelCount )
+{
+  uint32_t i = 0u;
+
+#if defined( DALI_PIXEL_CONVERSION_SSE2 )
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i colourMask = _mm_set_epi16( 0, -1, -1, -1, 0, -1, -1, -1 );
+  const __m128i alphaMultiplier = _mm_set_epi16( 255, 0, 0, 0, 255, 0, 0, 0 );
+  const __m128i half = _mm_set1_epi16( 128 );
+  for( ; i + 4u <= pixelCount; i += 4u )
+  {
+    const __m128i pixels = Load( source + i * 4u );
+    const __m128i low = PremultiplyWidePixels( _mm_unpacklo_epi8( pixels, zero ), colourMask, alphaMultiplier, half );
+    const __m128i high = PremultiplyWidePixels( _mm_unpackhi_epi8( pixels, zero ), colourMask, alphaMultiplier, half );
+    Store( destination + i * 4u, _mm_packus_epi16( low, high ) );
+  }
+#elif defined( DALI_PIXEL_CONVERSION_NEON )
+  for( ; i + 16u <= pixelCount; i += 16u )
+  {
+    uint8x16x4_t pixels = vld4q_u8( source + i * 4u );
+    const uint8x16_t alpha = pixels.val[3];
+    for( uint32_t channel = 0u; channel < 3u; ++channel )
+    {
+      const uint16x8_t low = vmull_u8( vget_low_u8( pixels.val[channel] ), vget_low_u8( alpha ) );
+      const uint16x8_t high = vmull_u8( vget_high_u8( pixels.val[channel] ), vget_high_u8( alpha ) );
+      pixels.val[channel] = vcombine_u8( vrshrn_n_u16( vrsraq_n_u16( low, low, 8 ), 8 ),
+                                         vrshrn_n_u16( vrsraq_n_u16( high, high, 8 ), 8 ) );
+    }
+    vst4q_u8( destination + i * 4u, pixels );
+  }
+#endif
+
+  for( ; i < pixelCount; ++i )
+  {
+    const uint32_t alpha = source[i * 4u + 3u];
+    destination[i * 4u]      = MultiplyChannel( source[i * 4u], alpha );
+    destination[i * 4u + 1u] = MultiplyChannel( source[i * 4u + 1u], alpha );
+    destination[i * 4u + 2u] = MultiplyChannel( source[i * 4u + 2u], alpha );
+    destination[i * 4u + 3u] = static_cast<uint8_t>( alpha );
+  }
+}
+
+void ConvertLuminanceToRgba( uint8_t* destination, const uint8_t* source, uint32_t pixelCount )
+{
+  uint32_t i = 0u;
+
+#if defined( DALI_PIXEL_CONVERSION_SSE2 )
+  const __m128i alphaMask = _mm_set1_epi32( static_cast<int>( 0xFF000000u ) );
+  for( ; i + 16u <= pixelCount; i += 16u )
+  {
+    const __m128i luminance = Load( source + i );
+    const __m128i low = _mm_unpacklo_epi8( luminance, luminance );
+    const __m128i high = _mm_unpackhi_epi8( luminance, luminance );
+
+    uint8_t* rgba = destination + i * 4u;
+    Store( rgba,       _mm_or_si128( _mm_unpacklo_epi16( low, low ), alphaMask ) );
+    Store( rgba + 16u, _mm_or_si128( _mm_unpackhi_epi16( low, low ), alphaMask ) );
+    Store( rgba + 32u, _mm_or_si128( _mm_unpacklo_epi16( high, high ), alphaMask ) );
+    Store( rgba + 48u, _mm_or_si128( _mm_unpackhi_epi16( high, high ), alphaMask ) );
+  }
+#elif defined( DALI_PIXEL_CONVERSION_NEON )
+  for( ; i + 16u <= pixelCount; i += 16u )
+  {
+    const uint8x16_t luminance = vld1q_u8( source + i );
+    uint8x16x4_t rgba;
+    rgba.val[0] = luminance;
+    rgba.val[1] = luminance;
+    rgba.val[2] = luminance;
+    rgba.val[3] = vdupq_n_u8( 0xFF );
+    vst4q_u8( destination + i * 4u, rgba );
+  }
+#endif
+
+  for( ; i < pixelCount; ++i )
+  {
+    destination[i * 4u]      = source[i];
+    destination[i * 4u + 1u] = source[i];
+    destination[i * 4u + 2u] = source[i];
+    destination[i * 4u + 3u] = 0xFF;
+  }
+}
+
+void ConvertLuminanceAlphaToRgba( uint8_t* destination, const uint8_t* source, uint32_t pixelCount )
+{
+  uint32_t i = 0u;
+
+#if defined( DALI_PIXEL_CONVERSION_SSE2 )
+  const __m128i luminanceMask = _mm_set1_epi16( 0x00FF );
+  for( ; i + 8u <= pixelCount; i += 8u )
+  {
+    // Each output pixel is a 16 bit pair of luminance values followed by the source pixel itself
+    const __m128i pixels = Load( source + i * 2u );
+    const __m128i luminance = _mm_and_si128( pixels, luminanceMask );
+    const __m128i luminancePairs = _mm_or_si128( luminance, _mm_slli_epi16( luminance, 8 ) );
+
+    uint8_t* rgba = destination + i * 4u;
+    Store( rgba,       _mm_unpacklo_epi16( luminancePairs, pixels ) );
+    Store( rgba + 16u, _mm_unpackhi_epi16( luminancePairs, pixels ) );
+  }
+#elif defined( DALI_PIXEL_CONVERSION_NEON )
+  for( ; i + 16u <= pixelCount; i += 16u )
+  {
+    const uint8x16x2_t pixels = vld2q_u8( source + i * 2u );
+    uint8x16x4_t rgba;
+    rgba.val[0] = pixels.val[0];
+    rgba.val[1] = pixels.val[0];
+    rgba.val[2] = pixels.val[0];
+    rgba.val[3] = pixels.val[1];
+    vst4q_u8( destination + i * 4u, rgba );
+  }
+#endif
+
+  for( ; i < pixelCount; ++i )
+  {
+    destination[i * 4u]      = source[i * 2u];
+    destination[i * 4u + 1u] = source[i * 2u];
+    destination[i * 4u + 2u] = source[i * 2u];
+    destination[i * 4u + 3u] = source[i * 2u + 1u];
+  }
+}
+
+UploadConverter::UploadConverter()
+: mThreadPool( nullptr )
+{
+}
+
+UploadConverter::~UploadConverter()
+{
+  Wait();
+
+  // The converted pixel data still referenced by the render thread frees its own buffer
+  for( auto&& buffer : mRecycledBuffers )
+  {
+    delete[] buffer.buffer;
+  }
+}
+
+void UploadConverter::SetThreadPool( Dali::ThreadPool* threadPool )
+{
+  Wait();
+  mThreadPool = threadPool;
+}
+
+PixelDataPtr UploadConverter::Convert( const PixelDataPtr& pixelData )
+{
+  const uint32_t pixelCount = pixelData->GetWidth() * pixelData->GetHeight();
+  const uint32_t bufferSize = pixelCount * 4u;
+  uint8_t* buffer = AcquireBuffer( bufferSize );
+  const uint8_t* source = pixelData->GetBuffer();
+
+  if( !mThreadPool )
+  {
+    ConvertRgbToRgba( buffer, source, pixelCount );
+  }
+  else
+  {
+    const uint32_t workerCount = static_cast<uint32_t>( mThreadPool->GetWorkerCount() );
+    const uint32_t taskCount = Clamp( pixelCount / MINIMUM_PIXEL_COUNT_PER_CONVERSION_TASK, 1u, workerCount );
+    const uint32_t chunkSize = pixelCount / taskCount;
+
+    // Spread the images converted in the same update over the workers
+    const uint32_t firstWorker = static_cast<uint32_t>( mConversions.size() );
+
+    uint32_t chunkBegin = 0u;
+    for( uint32_t task = 0u; task < taskCount; ++task )
+    {
+      const uint32_t count = ( task + 1u < taskCount ) ? chunkSize : pixelCount - chunkBegin;
+      mConversions.push_back( mThreadPool->SubmitTask( ( firstWorker + task ) % workerCount, [buffer, source, chunkBegin, count]( uint32_t )
+      {
+        ConvertRgbToRgba( buffer + chunkBegin * 4u, source + chunkBegin * 3u, count );
+      } ) );
+      chunkBegin += count;
+    }
+    mSources.push_back( pixelData );
+  }
+
+  PixelDataPtr converted = PixelData::New( buffer, bufferSize, pixelData->GetWidth(), pixelData->GetHeight(), Pixel::RGBA8888, Dali::PixelData::DELETE_ARRAY );
+  mUploads.push_back( converted );
+  return converted;
+}
+
+void UploadConverter::Wait()
+{
+  for( auto&& conversion : mConversions )
+  {
+    conversion->Wait();
+  }
+  mConversions.clear();
+  mSources.clear();
+
+  RecycleBuffers();
+}
+
+uint8_t* UploadConverter::AcquireBuffer( uint32_t size )
+{
+  // Search from the most recently recycled buffer
+  for( auto iter = mRecycledBuffers.rbegin(); iter != mRecycledBuffers.rend(); ++iter )
+  {
+    if( iter->bufferSize == size )
+    {
+      uint8_t* buffer = iter->buffer;
+      mRecycledBuffers.erase( std::next( iter ).base() );
+      return buffer;
+    }
+  }
+
+  return new uint8_t[ size ];
+}
+
+void UploadConverter::RecycleBuffers()
+{
+  // The render thread releases the pixel data once it has uploaded it
+  auto released = std::partition( mUploads.begin(), mUploads.end(), []( const PixelDataPtr& pixelData ) { return pixelData->ReferenceCount() > 1; } );
+  for( auto iter = released; iter != mUploads.end(); ++iter )
+  {
+    mRecycledBuffers.push_back( ( *iter )->ReleaseBuffer() );
+  }
+  mUploads.erase( released, mUploads.end() );
+
+  if( mRecycledBuffers.size() > MAXIMUM_RECYCLED_BUFFER_COUNT )
+  {
+    const auto excess = mRecycledBuffers.begin() + static_cast<std::ptrdiff_t>( mRecycledBuffers.size() - MAXIMUM_RECYCLED_BUFFER_COUNT );
+    for( auto iter = mRecycledBuffers.begin(); iter != excess; ++iter )
+    {
+      delete[] iter->buffer;
+    }
+    mRecycledBuffers.erase( mRecycledBuffers.begin(), excess );
+  }
+}
+
+} // namespace PixelConversion
+
+} // namespace Internal
+
+} // namespace Dali
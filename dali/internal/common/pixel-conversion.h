@@ -0,0 +1,157 @@
+#ifndef DALI_INTERNAL_PIXEL_CONVERSION_H
+#define DALI_INTERNAL_PIXEL_CONVERSION_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/images/pixel-data-devel.h>
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/internal/event/images/pixel-data-impl.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * Conversion kernels between 8 bit per channel pixel formats.
+ * They use SSE2 or NEON when available, and scalar code for any remaining pixels.
+ * The buffers do not have to be aligned.
+ */
+namespace PixelConversion
+{
+
+/**
+ * @brief Expands RGB888 pixels to RGBA8888 pixels with an opaque alpha.
+ * @param[out] destination The RGBA8888 pixels, 4 * pixelCount bytes, which must not overlap the source
+ * @param[in] source The RGB888 pixels, 3 * pixelCount bytes
+ * @param[in] pixelCount The number of pixels to convert
+ */
+void ConvertRgbToRgba( uint8_t* destination, const uint8_t* source, uint32_t pixelCount );
+
+/**
+ * @brief Swaps the first and third channels of 4 byte pixels, converting BGRA8888 to RGBA8888 and back.
+ * @param[out] destination The swizzled pixels, 4 * pixelCount bytes, which may be the source itself
+ * @param[in] source The pixels to swizzle, 4 * pixelCount bytes
+ * @param[in] pixelCount The number of pixels to convert
+ */
+void SwapRedAndBlue( uint8_t* destination, const uint8_t* source, uint32_t pixelCount );
+
+/**
+ * @brief Multiplies the colour channels of RGBA8888 pixels by their alpha, rounding to the nearest value.
+ * @param[out] destination The premultiplied pixels, 4 * pixelCount bytes, which may be the source itself
+ * @param[in] source The RGBA8888 pixels, 4 * pixelCount bytes
+ * @param[in] pixelCount The number of pixels to convert
+ */
+void PremultiplyAlpha( uint8_t* destination, const uint8_t* source, uint32_t pixelCount );
+
+/**
+ * @brief Expands L8 pixels to opaque grey RGBA8888 pixels.
+ * @param[out] destination The RGBA8888 pixels, 4 * pixelCount bytes, which must not overlap the source
+ * @param[in] source The L8 pixels, pixelCount bytes
+ * @param[in] pixelCount The number of pixels to convert
+ */
+void ConvertLuminanceToRgba( uint8_t* destination, const uint8_t* source, uint32_t pixelCount );
+
+/**
+ * @brief Expands LA88 pixels to grey RGBA8888 pixels.
+ * @param[out] destination The RGBA8888 pixels, 4 * pixelCount bytes, which must not overlap the source
+ * @param[in] source The LA88 pixels, 2 * pixelCount bytes
+ * @param[in] pixelCount The number of pixels to convert
+ */
+void ConvertLuminanceAlphaToRgba( uint8_t* destination, const uint8_t* source, uint32_t pixelCount );
+
+/**
+ * Expands RGB888 pixel data to RGBA8888 in the update thread, so the render thread can upload it without converting it.
+ * With worker threads the conversions run in them while the update carries on, large images being split between them.
+ *
+ * The converted pixels are written to staging buffers, which are reused for later conversions of the same size
+ * once the render thread has released the converted pixel data.
+ */
+class UploadConverter
+{
+public:
+
+  /**
+   * Constructor
+   */
+  UploadConverter();
+
+  /**
+   * Destructor, waits for the conversions which are still running
+   */
+  ~UploadConverter();
+
+  /**
+   * Sets the worker threads to convert in
+   * @param[in] threadPool The worker threads, or nullptr to convert in the calling thread
+   */
+  void SetThreadPool( Dali::ThreadPool* threadPool );
+
+  /**
+   * Starts expanding the pixel data
+   * @param[in] pixelData The RGB888 pixel data, which is kept alive until the conversion has finished
+   * @return The RGBA8888 pixel data, which can be read once Wait() has returned
+   */
+  PixelDataPtr Convert( const PixelDataPtr& pixelData );
+
+  /**
+   * Waits for the conversions started since the last call, which must finish before the render thread reads the data.
+   * The staging buffers of the converted pixel data released by the render thread since the last call are recycled.
+   */
+  void Wait();
+
+private:
+
+  /**
+   * Gets a staging buffer, reusing a recycled one of the same size if there is one
+   * @param[in] size The size of the buffer in bytes
+   * @return The buffer, allocated with new[]
+   */
+  uint8_t* AcquireBuffer( uint32_t size );
+
+  /**
+   * Moves the buffers of the converted pixel data which only the converter still references to the recycled buffers
+   */
+  void RecycleBuffers();
+
+  // Undefined
+  UploadConverter( const UploadConverter& ) = delete;
+  UploadConverter& operator=( const UploadConverter& ) = delete;
+
+private:
+
+  Dali::ThreadPool* mThreadPool;                                    ///< The worker threads, or nullptr
+  std::vector<SharedFuture> mConversions;                          ///< The conversions running in the worker threads
+  std::vector<PixelDataPtr> mSources;                              ///< The pixel data being converted, kept alive until the conversions finish
+  std::vector<PixelDataPtr> mUploads;                              ///< The converted pixel data, until the render thread has released it
+  std::vector<DevelPixelData::PixelDataBuffer> mRecycledBuffers;   ///< Staging buffers which can be reused, the most recently recycled last
+};
+
+} // namespace PixelConversion
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PIXEL_CONVERSION_H
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/common/radix-sort.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const uint32_t DIGIT_BITS = 8u;
+const uint32_t DIGIT_VALUE_COUNT = 1u << DIGIT_BITS;
+const uint32_t DIGITS_PER_KEY = 64u / DIGIT_BITS;
+const uint32_t DIGIT_COUNT = 2u * DIGITS_PER_KEY;
+
+/**
+ * @brief Gets a digit of the key of an item, digit 0 being the least significant digit of the secondary key.
+ */
+inline uint32_t GetDigit( const RadixSortItem& item, uint32_t digit )
+{
+  const uint64_t key = digit < DIGITS_PER_KEY ? item.secondaryKey : item.primaryKey;
+  return static_cast<uint32_t>( key >> ( ( digit % DIGITS_PER_KEY ) * DIGIT_BITS ) ) & ( DIGIT_VALUE_COUNT - 1u );
+}
+
+} // unnamed namespace
+
+void RadixSort( std::vector< RadixSortItem >& items, std::vector< RadixSortItem >& buffer )
+{
+  const uint32_t count = static_cast<uint32_t>( items.size() );
+  if( count < 2u )
+  {
+    return;
+  }
+
+  // Count the values of every digit in a single pass
+  uint32_t histograms[ DIGIT_COUNT ][ DIGIT_VALUE_COUNT ];
+  memset( histograms, 0, sizeof( histograms ) );
+  for( const auto& item : items )
+  {
+    for( uint32_t digit = 0u; digit < DIGIT_COUNT; ++digit )
+    {
+      ++histograms[ digit ][ GetDigit( item, digit ) ];
+    }
+  }
+
+  buffer.resize( count );
+  for( uint32_t digit = 0u; digit < DIGIT_COUNT; ++digit )
+  {
+    uint32_t* histogram = histograms[ digit ];
+
+    // Every item has the same value for this digit, so this pass would not move anything
+    if( histogram[ GetDigit( items[0], digit ) ] == count )
+    {
+      continue;
+    }
+
+    // Turn the counts into the position of the first item with each value
+    uint32_t offset = 0u;
+    for( uint32_t value = 0u; value < DIGIT_VALUE_COUNT; ++value )
+    {
+      const uint32_t valueCount = histogram[ value ];
+      histogram[ value ] = offset;
+      offset += valueCount;
+    }
+
+    for( const auto& item : items )
+    {
+      buffer[ histogram[ GetDigit( item, digit ) ]++ ] = item;
+    }
+    items.swap( buffer );
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
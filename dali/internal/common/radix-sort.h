@@ -0,0 +1,56 @@
+#ifndef DALI_INTERNAL_RADIX_SORT_H
+#define DALI_INTERNAL_RADIX_SORT_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <vector>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * @brief An item sorted by RadixSort, identified by its index in the caller's data.
+ * Items are ordered by primaryKey, then by secondaryKey.
+ */
+struct RadixSortItem
+{
+  uint64_t primaryKey;   ///< The most significant half of the sort key
+  uint64_t secondaryKey; ///< The least significant half of the sort key
+  uint32_t index;        ///< The index of the item in the caller's data
+};
+
+/**
+ * @brief Sorts items in ascending order of their 128 bit key with a least significant digit radix sort.
+ *
+ * The sort is stable, so items with the same key keep their relative order.
+ * Digits that are the same in every key are skipped, so the cost depends on how many bits actually differ between the keys.
+ * @param[in,out] items The items to sort
+ * @param[in,out] buffer Scratch storage, reused between calls to avoid allocations
+ */
+void RadixSort( std::vector< RadixSortItem >& items, std::vector< RadixSortItem >& buffer );
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_RADIX_SORT_H
@@ -52,7 +52,8 @@ public:
   : mShaderHash( -1 ),
     mVertexShader(std::move(vertexSource)),
     mFragmentShader(std::move(fragmentSource)),
-    mHints(hints)
+    mHints(hints),
+    mBinaryFormatId( 0u )
   { }
 
 protected:
@@ -156,6 +157,24 @@ public: // API
     return mBuffer;
   }
 
+  /**
+   * Set the identifier of the driver and binary format which compiled the binary
+   * @param[in] binaryFormatId The identifier, see ProgramCache::GetBinaryFormatId()
+   */
+  void SetBinaryFormatId( std::size_t binaryFormatId )
+  {
+    mBinaryFormatId = binaryFormatId;
+  }
+
+  /**
+   * Get the identifier of the driver and binary format which compiled the binary
+   * @return the identifier, or zero if it is not known
+   */
+  std::size_t GetBinaryFormatId() const
+  {
+    return mBinaryFormatId;
+  }
+
 private: // Not implemented
 
   ShaderData(const ShaderData& other);            ///< no copying of this object
@@ -168,6 +187,7 @@ private: // Data
   std::string               mFragmentShader; ///< source code for fragment program
   Dali::Shader::Hint::Value mHints;          ///< take a hint
   Dali::Vector<uint8_t>     mBuffer;         ///< buffer containing compiled binary bytecode
+  std::size_t               mBinaryFormatId; ///< identifies the driver and binary format which compiled the binary
 
 };
 
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/actors/layer-devel.h>
 #include <dali/public-api/actors/layer.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/object/type-registry.h>
@@ -60,6 +61,7 @@ DALI_PROPERTY("depth", INTEGER, false, false, false, Dali::Layer::Property::DEPT
 DALI_PROPERTY("depthTest", BOOLEAN, true, false, false, Dali::Layer::Property::DEPTH_TEST)
 DALI_PROPERTY("consumesTouch", BOOLEAN, true, false, false, Dali::Layer::Property::CONSUMES_TOUCH)
 DALI_PROPERTY("consumesHover", BOOLEAN, true, false, false, Dali::Layer::Property::CONSUMES_HOVER)
+DALI_PROPERTY("hitTestIndex", BOOLEAN, true, false, false, Dali::DevelLayer::Property::HIT_TEST_INDEX)
 DALI_PROPERTY_TABLE_END(DEFAULT_DERIVED_ACTOR_PROPERTY_START_INDEX, LayerDefaultProperties)
 
 // Actions
@@ -129,7 +131,8 @@ Layer::Layer(Actor::DerivedType type, const SceneGraph::Layer& layer)
   mIsClipping(false),
   mDepthTestDisabled(true),
   mTouchConsumed(false),
-  mHoverConsumed(false)
+  mHoverConsumed(false),
+  mHitTestIndexEnabled(false)
 {
 }
 
@@ -295,6 +298,22 @@ bool Layer::IsDepthTestDisabled() const
   return mDepthTestDisabled;
 }
 
+void Layer::SetHitTestIndexEnabled(bool enabled)
+{
+  if(enabled != mHitTestIndexEnabled)
+  {
+    mHitTestIndexEnabled = enabled;
+
+    // layerNode is being used in a separate thread; queue a message to set the value
+    SetHitTestIndexEnabledMessage(GetEventThreadServices(), GetSceneGraphLayer(), mHitTestIndexEnabled);
+  }
+}
+
+bool Layer::IsHitTestIndexEnabled() const
+{
+  return mHitTestIndexEnabled;
+}
+
 void Layer::SetSortFunction(Dali::Layer::SortFunctionType function)
 {
   if(function != mSortFunction)
@@ -414,6 +433,11 @@ void Layer::SetDefaultProperty(Property::Index index, const Property::Value& pro
         SetHoverConsumed(propertyValue.Get<bool>());
         break;
       }
+      case Dali::DevelLayer::Property::HIT_TEST_INDEX:
+      {
+        SetHitTestIndexEnabled(propertyValue.Get<bool>());
+        break;
+      }
       default:
       {
         DALI_LOG_WARNING("Unknown property (%d)\n", index);
@@ -470,6 +494,11 @@ Property::Value Layer::GetDefaultProperty(Property::Index index) const
         ret = mHoverConsumed;
         break;
       }
+      case Dali::DevelLayer::Property::HIT_TEST_INDEX:
+      {
+        ret = mHitTestIndexEnabled;
+        break;
+      }
       default:
       {
         DALI_LOG_WARNING("Unknown property (%d)\n", index);
@@ -172,6 +172,18 @@ public:
    */
   bool IsDepthTestDisabled() const;
 
+  /**
+   * Sets whether hit tests use the bounds of the actors of this layer to skip the actors which cannot be hit.
+   * @param[in] enabled True to enable the hit test index
+   */
+  void SetHitTestIndexEnabled( bool enabled );
+
+  /**
+   * Queries whether hit tests use the bounds of the actors of this layer.
+   * @return True if the hit test index is enabled
+   */
+  bool IsHitTestIndexEnabled() const;
+
   /**
    * @copydoc Dali::Layer::SetSortFunction()
    */
@@ -266,6 +278,7 @@ private:
   bool mDepthTestDisabled:1;                    ///< Whether depth test is disabled.
   bool mTouchConsumed:1;                        ///< Whether we should consume touch (including gesture).
   bool mHoverConsumed:1;                        ///< Whether we should consume hover.
+  bool mHitTestIndexEnabled:1;                  ///< Whether hit tests use the bounds of the actors.
 
 };
 
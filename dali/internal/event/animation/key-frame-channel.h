@@ -33,7 +33,8 @@ namespace Internal
 template<typename V>
 struct KeyFrameChannel
 {
-  using ProgressValues = std::vector<ProgressValue<V>>;
+  using ProgressValues             = std::vector<ProgressValue<V>>;
+  using CubicCoefficientsContainer = std::vector<CubicCoefficients<V>>;
 
   bool IsActive(float progress) const
   {
@@ -44,6 +45,26 @@ struct KeyFrameChannel
     return false;
   }
 
+  /**
+   * Calculates the cubic interpolation coefficients of every segment so that GetValue() does not
+   * recalculate the tangents on each call. Must be called again if key frames are added.
+   */
+  void PrepareCubicInterpolation()
+  {
+    mCubicCoefficients.clear();
+    if constexpr(HasCubicCoefficients<V>::value)
+    {
+      if(mValues.size() >= 2u)
+      {
+        mCubicCoefficients.resize(mValues.size() - 1u);
+        for(std::size_t index = 0u; index < mCubicCoefficients.size(); ++index)
+        {
+          CalculateCubicCoefficients(mCubicCoefficients[index], GetPreviousValue(index), mValues[index].GetValue(), mValues[index + 1u].GetValue(), GetNextValue(index + 1u));
+        }
+      }
+    }
+  }
+
   V GetValue(float progress, Dali::Animation::Interpolation interpolation) const
   {
     V interpolatedV{};
@@ -54,51 +75,86 @@ struct KeyFrameChannel
     }
     else
     {
-      auto end   = std::find_if(mValues.begin(), mValues.end(), [=](const auto& element) { return element.GetProgress() > progress; });
-      auto start = end - 1;
+      const std::size_t end   = FindSegmentEnd(progress);
+      const std::size_t start = end - 1u;
 
-      const bool validInterval = (end != mValues.end()) && (start->GetProgress() <= progress);
+      const bool validInterval = (end != 0u) && (end != mValues.size()) && (mValues[start].GetProgress() <= progress);
 
       if(validInterval)
       {
-        float frameProgress = (progress - start->GetProgress()) / (end->GetProgress() - start->GetProgress());
+        float frameProgress = (progress - mValues[start].GetProgress()) / (mValues[end].GetProgress() - mValues[start].GetProgress());
         if(interpolation == Dali::Animation::LINEAR)
         {
-          Interpolate(interpolatedV, start->GetValue(), end->GetValue(), frameProgress);
+          Interpolate(interpolatedV, mValues[start].GetValue(), mValues[end].GetValue(), frameProgress);
         }
         else
         {
-          //Calculate prev and next values
-          V prev;
-          if(start != mValues.begin())
+          if constexpr(HasCubicCoefficients<V>::value)
           {
-            prev = (start - 1)->GetValue();
+            if(mCubicCoefficients.size() + 1u == mValues.size())
+            {
+              CubicInterpolate(interpolatedV, mCubicCoefficients[start], frameProgress);
+              return interpolatedV;
+            }
           }
-          else
-          {
-            //Project next value through start point
-            prev = start->GetValue() + (start->GetValue() - (start + 1)->GetValue());
-          }
-
-          V next;
-          if(end != mValues.end() - 1)
-          {
-            next = (end + 1)->GetValue();
-          }
-          else
-          {
-            //Project prev value through end point
-            next = end->GetValue() + (end->GetValue() - (end - 1)->GetValue());
-          }
-
-          CubicInterpolate(interpolatedV, prev, start->GetValue(), end->GetValue(), next, frameProgress);
+          CubicInterpolate(interpolatedV, GetPreviousValue(start), mValues[start].GetValue(), mValues[end].GetValue(), GetNextValue(end), frameProgress);
         }
       }
     }
     return interpolatedV;
   }
 
-  ProgressValues mValues;
+  ProgressValues             mValues;
+  CubicCoefficientsContainer mCubicCoefficients; ///< One per segment once PrepareCubicInterpolation() is called
+
+private:
+  /**
+   * Finds the first key frame after the progress, as std::upper_bound would.
+   * Animations usually move forward a little on each call, so the segment found last time and the one
+   * after it are tried before searching.
+   */
+  std::size_t FindSegmentEnd(float progress) const
+  {
+    const std::size_t count = mValues.size();
+    for(std::size_t end = mCachedSegmentEnd; end < count && end <= mCachedSegmentEnd + 1u; ++end)
+    {
+      if((mValues[end].GetProgress() > progress) && (end == 0u || mValues[end - 1u].GetProgress() <= progress))
+      {
+        mCachedSegmentEnd = end;
+        return end;
+      }
+    }
+
+    auto iter         = std::upper_bound(mValues.begin(), mValues.end(), progress, [](float value, const auto& element) { return value < element.GetProgress(); });
+    mCachedSegmentEnd = static_cast<std::size_t>(iter - mValues.begin());
+    return mCachedSegmentEnd;
+  }
+
+  /**
+   * @return The value before the key frame, projected through the first key frame if there is none
+   */
+  V GetPreviousValue(std::size_t index) const
+  {
+    if(index != 0u)
+    {
+      return mValues[index - 1u].GetValue();
+    }
+    return mValues[0].GetValue() + (mValues[0].GetValue() - mValues[1].GetValue());
+  }
+
+  /**
+   * @return The value after the key frame, projected through the last key frame if there is none
+   */
+  V GetNextValue(std::size_t index) const
+  {
+    if(index != mValues.size() - 1u)
+    {
+      return mValues[index + 1u].GetValue();
+    }
+    return mValues[index].GetValue() + (mValues[index].GetValue() - mValues[index - 1u].GetValue());
+  }
+
+  mutable std::size_t mCachedSegmentEnd{0u}; ///< The result of the last FindSegmentEnd()
 };
 
 } // Internal
@@ -117,15 +117,25 @@ class KeyFrameBaseSpec : public KeyFrameSpec
 
 public:
   /**
-   * Add a key frame to the channel. Key frames should be added
-   * in time order (this method does not sort the vector by time)
+   * Add a key frame to the channel. The channel is kept sorted by progress, as its
+   * segment search relies on it; a key frame added at the same progress as an existing
+   * one goes after it.
    * @param[in] t - progress
    * @param[in] v - value
    * @param[in] alpha - Alpha function for blending to the next keyframe
    */
   void AddKeyFrame(float t, V v, AlphaFunction alpha)
   {
-    mChannel.mValues.push_back({t, v});
+    auto& values = mChannel.mValues;
+    if(values.empty() || values.back().GetProgress() <= t)
+    {
+      values.push_back({t, v});
+    }
+    else
+    {
+      auto iter = std::upper_bound(values.begin(), values.end(), t, [](float progress, const auto& element) { return progress < element.GetProgress(); });
+      values.insert(iter, {t, v});
+    }
   }
 
   /**
@@ -179,6 +189,14 @@ public:
   {
     return mChannel.GetValue(progress, interpolation);
   }
+
+  /**
+   * Prepare the key frames for cubic interpolation, so GetValue() does not recalculate the tangents.
+   */
+  void PrepareCubicInterpolation()
+  {
+    mChannel.PrepareCubicInterpolation();
+  }
 };
 
 using KeyFrameNumber     = KeyFrameBaseSpec<float>;
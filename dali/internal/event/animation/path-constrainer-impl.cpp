@@ -19,6 +19,7 @@
 #include <dali/internal/event/animation/path-constrainer-impl.h>
 
 //EXTRENAL INCLUDES
+#include <algorithm> // for std::max
 #include <cstring> // for strcmp
 
 // INTERNAL INCLUDES
@@ -42,6 +43,7 @@ DALI_PROPERTY_TABLE_BEGIN
 DALI_PROPERTY( "forward",       VECTOR3,   true,    false,       false,        Dali::PathConstrainer::Property::FORWARD )
 DALI_PROPERTY( "points",         ARRAY,    true,    false,       false,        Dali::PathConstrainer::Property::POINTS )
 DALI_PROPERTY( "controlPoints",  ARRAY,    true,    false,       false,        Dali::PathConstrainer::Property::CONTROL_POINTS )
+DALI_PROPERTY( "arcLengthSamples", INTEGER, true,    false,       false,        Dali::PathConstrainer::Property::ARC_LENGTH_SAMPLES )
 DALI_PROPERTY_TABLE_END( DEFAULT_OBJECT_PROPERTY_START_INDEX, PathConstrainerDefaultProperties )
 
 BaseHandle Create()
@@ -108,6 +110,10 @@ Property::Value PathConstrainer::GetDefaultProperty( Property::Index index ) con
       }
       return value;
     }
+    else if( index == Dali::PathConstrainer::Property::ARC_LENGTH_SAMPLES )
+    {
+      return Property::Value( static_cast<int32_t>( mPath->GetArcLengthSampleCount() ) );
+    }
   }
 
   return Property::Value();
@@ -152,15 +158,30 @@ void PathConstrainer::SetDefaultProperty( Property::Index index, const Property:
       }
     }
   }
+  else if( index == Dali::PathConstrainer::Property::ARC_LENGTH_SAMPLES )
+  {
+    int32_t sampleCount = 0;
+    if( propertyValue.Get( sampleCount ) )
+    {
+      mPath->SetArcLengthSampleCount( static_cast<uint32_t>( std::max( sampleCount, 0 ) ) );
+    }
+  }
 }
 
 void PathConstrainer::Apply( Property target, Property source, const Vector2& range, const Vector2& wrap)
 {
+  // The arc length table of the path is built here, so the constraint samples a copy which the event thread does not change
+  PathPtr path = mPath;
+  if( mPath->GetArcLengthSampleCount() > 0u )
+  {
+    path = Path::Clone( *mPath );
+  }
+
   Dali::Property::Type propertyType = target.object.GetPropertyType( target.propertyIndex);
   if( propertyType == Dali::Property::VECTOR3)
   {
     // If property type is Vector3, constrain its value to the position of the path
-    Dali::Constraint constraint = Dali::Constraint::New<Vector3>( target.object, target.propertyIndex, PathConstraintFunctor( mPath, range, wrap ) );
+    Dali::Constraint constraint = Dali::Constraint::New<Vector3>( target.object, target.propertyIndex, PathConstraintFunctor( path, range, wrap ) );
     constraint.AddSource( Dali::Source(source.object, source.propertyIndex ) );
 
     constraint.SetTag( static_cast<uint32_t>( reinterpret_cast<uintptr_t>( this ) ) ); // taking 32bits of this as tag
@@ -170,7 +191,7 @@ void PathConstrainer::Apply( Property target, Property source, const Vector2& ra
   else if( propertyType == Dali::Property::ROTATION )
   {
     // If property type is Rotation, constrain its value to align the forward vector to the tangent of the path
-    Dali::Constraint constraint = Dali::Constraint::New<Quaternion>( target.object, target.propertyIndex, PathConstraintFunctor( mPath, range, mForward, wrap) );
+    Dali::Constraint constraint = Dali::Constraint::New<Quaternion>( target.object, target.propertyIndex, PathConstraintFunctor( path, range, mForward, wrap) );
     constraint.AddSource( Dali::Source(source.object, source.propertyIndex ) );
 
     constraint.SetTag( static_cast<uint32_t>( reinterpret_cast<uintptr_t>( this ) ) ); // taking 32bits of this as tag
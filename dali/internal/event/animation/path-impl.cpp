@@ -19,9 +19,12 @@
 #include <dali/internal/event/animation/path-impl.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm> // for std::min
 #include <cstring> // for strcmp
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/animation/path-devel.h>
+#include <dali/public-api/math/math-utils.h>
 #include <dali/public-api/object/property-array.h>
 #include <dali/public-api/object/type-registry.h>
 #include <dali/internal/event/common/property-helper.h>
@@ -41,6 +44,7 @@ namespace
 DALI_PROPERTY_TABLE_BEGIN
 DALI_PROPERTY( "points",         ARRAY, true, false, false,   Dali::Path::Property::POINTS         )
 DALI_PROPERTY( "controlPoints",  ARRAY, true, false, false,   Dali::Path::Property::CONTROL_POINTS )
+DALI_PROPERTY( "arcLengthSamples", INTEGER, true, false, false, Dali::DevelPath::Property::ARC_LENGTH_SAMPLES )
 DALI_PROPERTY_TABLE_END( DEFAULT_OBJECT_PROPERTY_START_INDEX, PathDefaultProperties )
 
 /**
@@ -62,6 +66,12 @@ const float BezierBasisCoeff[] = {  -1.0f,  3.0f, -3.0f, 1.0f,
 
 const Dali::Matrix BezierBasis = Dali::Matrix( BezierBasisCoeff );
 
+/**
+ * The number of points measured along the curves, per entry of the arc length table, to find the
+ * distance travelled
+ */
+const uint32_t ARC_LENGTH_SUBDIVISIONS = 4u;
+
 Dali::BaseHandle Create()
 {
   return Dali::Path::New();
@@ -82,7 +92,9 @@ Path* Path::New()
 }
 
 Path::Path()
-: Object( nullptr ) // we don't have our own scene object
+: Object( nullptr ), // we don't have our own scene object
+  mArcLengthSampleCount( 0u ),
+  mArcLengthTableDirty( true )
 {
 }
 
@@ -93,6 +105,10 @@ Path* Path::Clone(const Path& path)
   Path* clone = new Path();
   clone->SetPoints( path.GetPoints() );
   clone->SetControlPoints( path.GetControlPoints() );
+  clone->SetArcLengthSampleCount( path.GetArcLengthSampleCount() );
+
+  // The clone is sampled in the update thread
+  clone->PrepareArcLengthTable();
 
   return clone;
 }
@@ -131,6 +147,10 @@ Property::Value Path::GetDefaultProperty( Property::Index index ) const
     }
     return value;
   }
+  else if( index == Dali::DevelPath::Property::ARC_LENGTH_SAMPLES )
+  {
+    return Property::Value( static_cast<int32_t>( mArcLengthSampleCount ) );
+  }
 
   return Property::Value();
 }
@@ -161,17 +181,28 @@ void Path::SetDefaultProperty(Property::Index index, const Property::Value& prop
         mControlPoint.PushBack( point );
       }
     }
+    mArcLengthTableDirty = true;
+  }
+  else if( index == Dali::DevelPath::Property::ARC_LENGTH_SAMPLES )
+  {
+    int32_t sampleCount = 0;
+    if( propertyValue.Get( sampleCount ) )
+    {
+      SetArcLengthSampleCount( static_cast<uint32_t>( std::max( sampleCount, 0 ) ) );
+    }
   }
 }
 
 void Path::AddPoint(const Vector3& point )
 {
   mPoint.PushBack( point );
+  mArcLengthTableDirty = true;
 }
 
 void Path::AddControlPoint(const Vector3& point )
 {
   mControlPoint.PushBack( point );
+  mArcLengthTableDirty = true;
 }
 
 uint32_t Path::GetNumberOfSegments() const
@@ -236,6 +267,7 @@ void Path::GenerateControlPoints( float curvature )
     mControlPoint[2*i] =   p1 + tangentOut*length;
     mControlPoint[2*i+1] = p2 - tangentIn*length;
   }
+  mArcLengthTableDirty = true;
 }
 
 void Path::FindSegmentAndProgress( float t, uint32_t& segment, float& tLocal ) const
@@ -276,63 +308,14 @@ bool Path::SampleAt( float t, Vector3& position, Vector3& tangent ) const
 
   if( PathIsComplete(mPoint, mControlPoint) )
   {
-    uint32_t segment;
-    float tLocal;
-    FindSegmentAndProgress( t, segment, tLocal );
-
-    //Get points and control points in the segment
-    const Vector3& controlPoint0 = mControlPoint[2*segment];
-    const Vector3& controlPoint1 = mControlPoint[2*segment+1];
-    const Vector3& point0 = mPoint[segment];
-    const Vector3& point1 = mPoint[segment+1];
-
-    if(tLocal < Math::MACHINE_EPSILON_1)
+    if( mArcLengthSampleCount > 0u && !mArcLengthTableDirty )
     {
-      position = point0;
-      tangent = ( controlPoint0 - point0 ) * 3.0f;
-      tangent.Normalize();
-    }
-    else if( (1.0 - tLocal) < Math::MACHINE_EPSILON_1)
-    {
-      position = point1;
-      tangent = ( point1 - controlPoint1 ) * 3.0f;
-      tangent.Normalize();
+      LookUpArcLengthTable( t, &position, &tangent );
     }
     else
     {
-      const Vector4 sVect(tLocal*tLocal*tLocal, tLocal*tLocal, tLocal, 1.0f );
-      const Vector3 sVectDerivative(3.0f*tLocal*tLocal, 2.0f*tLocal, 1.0f );
-
-      //X
-      Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
-
-      Vector4 A = BezierBasis * cVect;
-      position.x = sVect.Dot4(A);
-      tangent.x  = sVectDerivative.Dot(Vector3(A));
-
-      //Y
-      cVect.x  = point0.y;
-      cVect.y  = controlPoint0.y;
-      cVect.z  = controlPoint1.y;
-      cVect.w  = point1.y;
-
-      A = BezierBasis * cVect;
-      position.y = sVect.Dot4(A);
-      tangent.y  = sVectDerivative.Dot(Vector3(A));
-
-      //Z
-      cVect.x  = point0.z;
-      cVect.y  = controlPoint0.z;
-      cVect.z  = controlPoint1.z;
-      cVect.w  = point1.z;
-
-      A = BezierBasis * cVect;
-      position.z = sVect.Dot4(A);
-      tangent.z  = sVectDerivative.Dot(Vector3(A));
-
-      tangent.Normalize();
+      SampleCurveAt( t, position, tangent );
     }
-
     done = true;
   }
 
@@ -345,46 +328,14 @@ bool Path::SamplePosition( float t, Vector3& position ) const
 
   if( PathIsComplete(mPoint, mControlPoint) )
   {
-    uint32_t segment;
-    float tLocal;
-    FindSegmentAndProgress( t, segment, tLocal );
-
-    const Vector3& controlPoint0 = mControlPoint[2*segment];
-    const Vector3& controlPoint1 = mControlPoint[2*segment+1];
-    const Vector3& point0 = mPoint[segment];
-    const Vector3& point1 = mPoint[segment+1];
-
-    if(tLocal < Math::MACHINE_EPSILON_1)
-    {
-      position = point0;
-    }
-    else if( (1.0 - tLocal) < Math::MACHINE_EPSILON_1)
+    if( mArcLengthSampleCount > 0u && !mArcLengthTableDirty )
     {
-      position = point1;
+      LookUpArcLengthTable( t, &position, nullptr );
     }
     else
     {
-      const Vector4 sVect(tLocal*tLocal*tLocal, tLocal*tLocal, tLocal, 1.0f );
-
-      //X
-      Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
-      position.x = sVect.Dot4(BezierBasis * cVect);
-
-      //Y
-      cVect.x  = point0.y;
-      cVect.y  = controlPoint0.y;
-      cVect.z  = controlPoint1.y;
-      cVect.w  = point1.y;
-      position.y = sVect.Dot4(BezierBasis * cVect);
-
-      //Z
-      cVect.x  = point0.z;
-      cVect.y  = controlPoint0.z;
-      cVect.z  = controlPoint1.z;
-      cVect.w  = point1.z;
-      position.z = sVect.Dot4(BezierBasis * cVect);
+      SampleCurvePosition( t, position );
     }
-
     done = true;
   }
 
@@ -397,57 +348,252 @@ bool Path::SampleTangent( float t, Vector3& tangent ) const
 
   if( PathIsComplete(mPoint, mControlPoint) )
   {
-    uint32_t segment;
-    float tLocal;
-    FindSegmentAndProgress( t, segment, tLocal );
-
-    const Vector3& controlPoint0 = mControlPoint[2*segment];
-    const Vector3& controlPoint1 = mControlPoint[2*segment+1];
-    const Vector3& point0 = mPoint[segment];
-    const Vector3& point1 = mPoint[segment+1];
-
-    if(tLocal < Math::MACHINE_EPSILON_1)
+    if( mArcLengthSampleCount > 0u && !mArcLengthTableDirty )
     {
-      tangent = ( controlPoint0 - point0 ) * 3.0f;
-    }
-    else if( (1.0f - tLocal) < Math::MACHINE_EPSILON_1)
-    {
-      tangent = ( point1 - controlPoint1 ) * 3.0f;
+      LookUpArcLengthTable( t, nullptr, &tangent );
     }
     else
     {
-      const Vector3 sVectDerivative(3.0f*tLocal*tLocal, 2.0f*tLocal, 1.0f );
-
-      //X
-      Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
-      tangent.x  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
-
-      //Y
-      cVect.x  = point0.y;
-      cVect.y  = controlPoint0.y;
-      cVect.z  = controlPoint1.y;
-      cVect.w  = point1.y;
-      tangent.y  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
-
-      //Z
-      cVect.x  = point0.z;
-      cVect.y  = controlPoint0.z;
-      cVect.z  = controlPoint1.z;
-      cVect.w  = point1.z;
-      tangent.z  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
+      SampleCurveTangent( t, tangent );
     }
-
-    tangent.Normalize();
     done = true;
   }
 
   return done;
 }
 
+void Path::SampleCurveAt( float t, Vector3& position, Vector3& tangent ) const
+{
+  uint32_t segment;
+  float tLocal;
+  FindSegmentAndProgress( t, segment, tLocal );
+
+  //Get points and control points in the segment
+  const Vector3& controlPoint0 = mControlPoint[2*segment];
+  const Vector3& controlPoint1 = mControlPoint[2*segment+1];
+  const Vector3& point0 = mPoint[segment];
+  const Vector3& point1 = mPoint[segment+1];
+
+  if(tLocal < Math::MACHINE_EPSILON_1)
+  {
+    position = point0;
+    tangent = ( controlPoint0 - point0 ) * 3.0f;
+    tangent.Normalize();
+  }
+  else if( (1.0 - tLocal) < Math::MACHINE_EPSILON_1)
+  {
+    position = point1;
+    tangent = ( point1 - controlPoint1 ) * 3.0f;
+    tangent.Normalize();
+  }
+  else
+  {
+    const Vector4 sVect(tLocal*tLocal*tLocal, tLocal*tLocal, tLocal, 1.0f );
+    const Vector3 sVectDerivative(3.0f*tLocal*tLocal, 2.0f*tLocal, 1.0f );
+
+    //X
+    Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
+
+    Vector4 A = BezierBasis * cVect;
+    position.x = sVect.Dot4(A);
+    tangent.x  = sVectDerivative.Dot(Vector3(A));
+
+    //Y
+    cVect.x  = point0.y;
+    cVect.y  = controlPoint0.y;
+    cVect.z  = controlPoint1.y;
+    cVect.w  = point1.y;
+
+    A = BezierBasis * cVect;
+    position.y = sVect.Dot4(A);
+    tangent.y  = sVectDerivative.Dot(Vector3(A));
+
+    //Z
+    cVect.x  = point0.z;
+    cVect.y  = controlPoint0.z;
+    cVect.z  = controlPoint1.z;
+    cVect.w  = point1.z;
+
+    A = BezierBasis * cVect;
+    position.z = sVect.Dot4(A);
+    tangent.z  = sVectDerivative.Dot(Vector3(A));
+
+    tangent.Normalize();
+  }
+}
+
+void Path::SampleCurvePosition( float t, Vector3& position ) const
+{
+  uint32_t segment;
+  float tLocal;
+  FindSegmentAndProgress( t, segment, tLocal );
+
+  const Vector3& controlPoint0 = mControlPoint[2*segment];
+  const Vector3& controlPoint1 = mControlPoint[2*segment+1];
+  const Vector3& point0 = mPoint[segment];
+  const Vector3& point1 = mPoint[segment+1];
+
+  if(tLocal < Math::MACHINE_EPSILON_1)
+  {
+    position = point0;
+  }
+  else if( (1.0 - tLocal) < Math::MACHINE_EPSILON_1)
+  {
+    position = point1;
+  }
+  else
+  {
+    const Vector4 sVect(tLocal*tLocal*tLocal, tLocal*tLocal, tLocal, 1.0f );
+
+    //X
+    Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
+    position.x = sVect.Dot4(BezierBasis * cVect);
+
+    //Y
+    cVect.x  = point0.y;
+    cVect.y  = controlPoint0.y;
+    cVect.z  = controlPoint1.y;
+    cVect.w  = point1.y;
+    position.y = sVect.Dot4(BezierBasis * cVect);
+
+    //Z
+    cVect.x  = point0.z;
+    cVect.y  = controlPoint0.z;
+    cVect.z  = controlPoint1.z;
+    cVect.w  = point1.z;
+    position.z = sVect.Dot4(BezierBasis * cVect);
+  }
+}
+
+void Path::SampleCurveTangent( float t, Vector3& tangent ) const
+{
+  uint32_t segment;
+  float tLocal;
+  FindSegmentAndProgress( t, segment, tLocal );
+
+  const Vector3& controlPoint0 = mControlPoint[2*segment];
+  const Vector3& controlPoint1 = mControlPoint[2*segment+1];
+  const Vector3& point0 = mPoint[segment];
+  const Vector3& point1 = mPoint[segment+1];
+
+  if(tLocal < Math::MACHINE_EPSILON_1)
+  {
+    tangent = ( controlPoint0 - point0 ) * 3.0f;
+  }
+  else if( (1.0f - tLocal) < Math::MACHINE_EPSILON_1)
+  {
+    tangent = ( point1 - controlPoint1 ) * 3.0f;
+  }
+  else
+  {
+    const Vector3 sVectDerivative(3.0f*tLocal*tLocal, 2.0f*tLocal, 1.0f );
+
+    //X
+    Vector4  cVect( point0.x, controlPoint0.x, controlPoint1.x,  point1.x);
+    tangent.x  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
+
+    //Y
+    cVect.x  = point0.y;
+    cVect.y  = controlPoint0.y;
+    cVect.z  = controlPoint1.y;
+    cVect.w  = point1.y;
+    tangent.y  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
+
+    //Z
+    cVect.x  = point0.z;
+    cVect.y  = controlPoint0.z;
+    cVect.z  = controlPoint1.z;
+    cVect.w  = point1.z;
+    tangent.z  = sVectDerivative.Dot(Vector3(BezierBasis * cVect));
+  }
+
+  tangent.Normalize();
+}
+
+void Path::SetArcLengthSampleCount( uint32_t sampleCount )
+{
+  if( sampleCount != mArcLengthSampleCount )
+  {
+    mArcLengthSampleCount = sampleCount;
+    mArcLengthTableDirty = true;
+  }
+}
+
+void Path::PrepareArcLengthTable() const
+{
+  if( mArcLengthSampleCount > 0u && PathIsComplete(mPoint, mControlPoint) && mArcLengthTableDirty )
+  {
+    BuildArcLengthTable();
+  }
+}
+
+void Path::BuildArcLengthTable() const
+{
+  // Measure the distance travelled at evenly spaced progress values
+  const uint32_t measureCount = mArcLengthSampleCount * ARC_LENGTH_SUBDIVISIONS;
+  Dali::Vector<float> distances;
+  distances.Resize( measureCount + 1u );
+  distances[0] = 0.0f;
+
+  Vector3 previous;
+  SampleCurvePosition( 0.0f, previous );
+  for( uint32_t i = 1u; i <= measureCount; ++i )
+  {
+    Vector3 position;
+    SampleCurvePosition( static_cast<float>( i ) / static_cast<float>( measureCount ), position );
+    distances[i] = distances[i - 1u] + ( position - previous ).Length();
+    previous = position;
+  }
+
+  // Find the progress at evenly spaced distances, and sample the curves there
+  const float length = distances[measureCount];
+  mArcLengthPositions.Resize( mArcLengthSampleCount + 1u );
+  mArcLengthTangents.Resize( mArcLengthSampleCount + 1u );
+
+  uint32_t measure = 0u;
+  for( uint32_t i = 0u; i <= mArcLengthSampleCount; ++i )
+  {
+    const float distance = length * static_cast<float>( i ) / static_cast<float>( mArcLengthSampleCount );
+    while( measure < measureCount - 1u && distances[measure + 1u] < distance )
+    {
+      ++measure;
+    }
+
+    const float measureLength = distances[measure + 1u] - distances[measure];
+    const float measureProgress = ( measureLength > Math::MACHINE_EPSILON_1 ) ? Clamp( ( distance - distances[measure] ) / measureLength, 0.0f, 1.0f ) : 0.0f;
+    const float t = ( static_cast<float>( measure ) + measureProgress ) / static_cast<float>( measureCount );
+
+    SampleCurveAt( t, mArcLengthPositions[i], mArcLengthTangents[i] );
+  }
+
+  mArcLengthTableDirty = false;
+}
+
+void Path::LookUpArcLengthTable( float t, Vector3* position, Vector3* tangent ) const
+{
+  const float sample = Clamp( t, 0.0f, 1.0f ) * static_cast<float>( mArcLengthSampleCount );
+  const uint32_t index = std::min( static_cast<uint32_t>( sample ), mArcLengthSampleCount - 1u );
+  const float progress = sample - static_cast<float>( index );
+
+  if( position )
+  {
+    *position = mArcLengthPositions[index] + ( mArcLengthPositions[index + 1u] - mArcLengthPositions[index] ) * progress;
+  }
+
+  if( tangent )
+  {
+    *tangent = mArcLengthTangents[index] + ( mArcLengthTangents[index + 1u] - mArcLengthTangents[index] ) * progress;
+    tangent->Normalize();
+  }
+}
+
 Vector3& Path::GetPoint( uint32_t index )
 {
   DALI_ASSERT_ALWAYS( index < mPoint.Size() && "Path: Point index out of bounds" );
 
+  // The point may be changed through the reference
+  mArcLengthTableDirty = true;
+
   return mPoint[index];
 }
 
@@ -455,6 +601,9 @@ Vector3& Path::GetControlPoint( uint32_t index )
 {
   DALI_ASSERT_ALWAYS( index < mControlPoint.Size() && "Path: Control Point index out of bounds" );
 
+  // The control point may be changed through the reference
+  mArcLengthTableDirty = true;
+
   return mControlPoint[index];
 }
 
@@ -466,11 +615,13 @@ uint32_t Path::GetPointCount() const
 void Path::ClearPoints()
 {
   mPoint.Clear();
+  mArcLengthTableDirty = true;
 }
 
 void Path::ClearControlPoints()
 {
   mControlPoint.Clear();
+  mArcLengthTableDirty = true;
 }
 
 } // Internal
@@ -160,7 +160,7 @@ public:
    *
    * @param[in] p New value for mPoint property
    */
-  void SetPoints( const Dali::Vector<Vector3>& p ){ mPoint = p; }
+  void SetPoints( const Dali::Vector<Vector3>& p ){ mPoint = p; mArcLengthTableDirty = true; }
 
   /**
    * @brief Get mCotrolPoint property
@@ -174,7 +174,30 @@ public:
    *
    * @param[in] p New value for mControlPoint property
    */
-  void SetControlPoints( const Dali::Vector<Vector3>& p ){ mControlPoint = p; }
+  void SetControlPoints( const Dali::Vector<Vector3>& p ){ mControlPoint = p; mArcLengthTableDirty = true; }
+
+  /**
+   * @brief Sets the number of samples of the table used to sample the path by arc length
+   *
+   * @param[in] sampleCount The number of samples, or 0 to sample the path by segment
+   */
+  void SetArcLengthSampleCount( uint32_t sampleCount );
+
+  /**
+   * @brief Retrieves the number of samples of the table used to sample the path by arc length
+   *
+   * @return The number of samples, or 0 if the path is sampled by segment
+   */
+  uint32_t GetArcLengthSampleCount() const { return mArcLengthSampleCount; }
+
+  /**
+   * @brief Builds the arc length table if it is used and out of date.
+   *
+   * Sampling never builds the table, as paths are also sampled in the update thread. Those paths are
+   * clones which are prepared in the event thread and not changed afterwards, see Clone(). Until the
+   * table is prepared, the curves are sampled per segment.
+   */
+  void PrepareArcLengthTable() const;
 
 private:
 
@@ -199,6 +222,30 @@ private:
    */
   void FindSegmentAndProgress( float t, uint32_t& segment, float& tLocal ) const;
 
+  /**
+   * Helpers to sample the curves of the path, see SampleAt(), SamplePosition() and SampleTangent()
+   * @pre The path is complete
+   */
+  void SampleCurveAt( float t, Vector3& position, Vector3& tangent ) const;
+  void SampleCurvePosition( float t, Vector3& position ) const;
+  void SampleCurveTangent( float t, Vector3& tangent ) const;
+
+  /**
+   * Helper function to build the arc length table
+   * @pre The path is complete
+   */
+  void BuildArcLengthTable() const;
+
+  /**
+   * Helper function to interpolate the arc length table
+   * @pre The table has been built by PrepareArcLengthTable()
+   *
+   * @param[in] t Progress
+   * @param[out] position The interpolated position, if not null
+   * @param[out] tangent The interpolated tangent, if not null
+   */
+  void LookUpArcLengthTable( float t, Vector3* position, Vector3* tangent ) const;
+
   /**
    * Helper function to calculate to number of segments in the path
    */
@@ -206,6 +253,11 @@ private:
 
   Dali::Vector<Vector3> mPoint;            ///< Interpolation points
   Dali::Vector<Vector3> mControlPoint;     ///< Control points
+
+  mutable Dali::Vector<Vector3> mArcLengthPositions; ///< Positions at evenly spaced distances along the path
+  mutable Dali::Vector<Vector3> mArcLengthTangents;  ///< Tangents at the same distances
+  uint32_t mArcLengthSampleCount;                    ///< The number of intervals between the entries of the table, 0 if not used
+  mutable bool mArcLengthTableDirty;                 ///< Whether the path has changed since the table was built
 };
 
 } // Internal
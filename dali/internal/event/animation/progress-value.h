@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <type_traits>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/math/angle-axis.h>
 #include <dali/public-api/math/quaternion.h>
@@ -158,6 +161,59 @@ inline void CubicInterpolate( Vector4& result, const Vector4& p0, const Vector4&
   result = a3*progress*progress*progress + a2*progress*progress + a1*progress + p1;
 }
 
+/**
+ * The coefficients of the Catmull-Rom polynomial between two values, so that values which are
+ * interpolated repeatedly do not have to recalculate the tangents every time. See CubicInterpolate().
+ */
+template <typename T>
+struct CubicCoefficients
+{
+  using Type = typename std::conditional< std::is_same< T, int32_t >::value, float, T >::type;
+
+  Type a3;
+  Type a2;
+  Type a1;
+  Type a0;
+};
+
+/**
+ * Whether CubicCoefficients can be calculated for the type; other types interpolate linearly
+ */
+template <typename T>
+struct HasCubicCoefficients
+{
+  static constexpr bool value = std::is_same< T, int32_t >::value || std::is_same< T, float >::value ||
+                                std::is_same< T, Vector2 >::value || std::is_same< T, Vector3 >::value || std::is_same< T, Vector4 >::value;
+};
+
+inline void CalculateCubicCoefficients( CubicCoefficients< int32_t >& coefficients, int32_t p0, int32_t p1, int32_t p2, int32_t p3 )
+{
+  coefficients.a3 = static_cast<float>( p3 ) * 0.5f - static_cast<float>( p2 ) * 1.5f + static_cast<float>( p1 ) * 1.5f - static_cast<float>( p0 ) * 0.5f;
+  coefficients.a2 = static_cast<float>( p0 ) - static_cast<float>( p1 ) * 2.5f + static_cast<float>( p2 ) * 2.0f - static_cast<float>( p3 ) * 0.5f;
+  coefficients.a1 = static_cast<float>( p2 - p0 ) * 0.5f;
+  coefficients.a0 = static_cast<float>( p1 );
+}
+
+template <typename T>
+inline void CalculateCubicCoefficients( CubicCoefficients< T >& coefficients, const T& p0, const T& p1, const T& p2, const T& p3 )
+{
+  coefficients.a3 = p3*0.5f - p2*1.5f + p1*1.5f - p0*0.5f;
+  coefficients.a2 = p0 - p1*2.5f + p2*2.0f - p3*0.5f;
+  coefficients.a1 = (p2-p0)*0.5f;
+  coefficients.a0 = p1;
+}
+
+inline void CubicInterpolate( int32_t& result, const CubicCoefficients< int32_t >& c, float progress )
+{
+  result = static_cast<int>( c.a3*progress*progress*progress + c.a2*progress*progress + c.a1*progress + c.a0 + 0.5f );
+}
+
+template <typename T>
+inline void CubicInterpolate( T& result, const CubicCoefficients< T >& c, float progress )
+{
+  result = c.a3*progress*progress*progress + c.a2*progress*progress + c.a1*progress + c.a0;
+}
+
 inline void CubicInterpolate( bool& result, bool p0, bool p1, bool  p2, bool  p3, float progress )
 {
   Interpolate( result, p1, p2, progress);
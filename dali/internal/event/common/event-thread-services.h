@@ -100,6 +100,17 @@ public:
    */
   virtual uint32_t* ReserveMessageSlot( uint32_t size, bool updateScene = true ) = 0;
 
+  /**
+   * Reserve space for a message which bakes the value of a property; this must then be initialized by the caller.
+   * If property messages are coalesced, this may return the slot of a previous message for the same property,
+   * which has been destroyed as the new message supersedes it.
+   * @post Calling this method may invalidate any previously returned slots.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @param[in] property The property the message bakes.
+   * @return A pointer to the first char allocated for the message.
+   */
+  virtual uint32_t* ReservePropertyMessageSlot( uint32_t size, const void* property ) = 0;
+
   /**
    * @return the current event-buffer index.
    */
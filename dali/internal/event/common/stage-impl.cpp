@@ -214,6 +214,21 @@ DevelStage::Rendering Stage::GetRenderingBehavior() const
   return mRenderingBehavior;
 }
 
+void Stage::SetPropertyMessageCoalescing( bool enabled )
+{
+  mUpdateManager.SetPropertyMessageCoalescing( enabled );
+}
+
+bool Stage::IsPropertyMessageCoalescingEnabled() const
+{
+  return mUpdateManager.IsPropertyMessageCoalescingEnabled();
+}
+
+uint32_t Stage::GetCoalescedPropertyMessageCount() const
+{
+  return mUpdateManager.GetCoalescedMessageCount();
+}
+
 bool Stage::DoConnectSignal( BaseObject* object, ConnectionTrackerInterface* tracker, const std::string& signalName, FunctorDelegate* functor )
 {
   bool connected( true );
@@ -195,6 +195,21 @@ public:
    */
   DevelStage::Rendering GetRenderingBehavior() const;
 
+  /**
+   * @copydoc Dali::DevelStage::SetPropertyMessageCoalescing()
+   */
+  void SetPropertyMessageCoalescing( bool enabled );
+
+  /**
+   * @copydoc Dali::DevelStage::IsPropertyMessageCoalescingEnabled()
+   */
+  bool IsPropertyMessageCoalescingEnabled() const;
+
+  /**
+   * @copydoc Dali::DevelStage::GetCoalescedPropertyMessageCount()
+   */
+  uint32_t GetCoalescedPropertyMessageCount() const;
+
   /**
    * Callback for Internal::Scene EventProcessingFinished signal
    */
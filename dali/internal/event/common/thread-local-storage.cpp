@@ -149,6 +149,11 @@ AnimationPlaylist& ThreadLocalStorage::GetAnimationPlaylist()
   return mCore->GetAnimationPlaylist();
 }
 
+Integration::GlAbstraction& ThreadLocalStorage::GetGlAbstraction()
+{
+  return mCore->GetGlAbstraction();
+}
+
 bool ThreadLocalStorage::IsBlendEquationSupported( DevelBlendEquation::Type blendEquation )
 {
   return mCore->GetGlAbstraction().IsBlendEquationSupported( blendEquation );
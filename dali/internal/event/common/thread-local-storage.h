@@ -34,6 +34,7 @@ struct Vector2;
 namespace Integration
 {
 class PlatformAbstraction;
+class GlAbstraction;
 }
 
 namespace Internal
@@ -162,6 +163,12 @@ public:
    */
   AnimationPlaylist& GetAnimationPlaylist();
 
+  /**
+   * @brief Gets the GL abstraction.
+   * @return A reference to the GL abstraction
+   */
+  Integration::GlAbstraction& GetGlAbstraction();
+
   /**
    * @brief Returns whether the blend equation is supported in the system or not.
    * @param[in] blendEquation blend equation to be checked.
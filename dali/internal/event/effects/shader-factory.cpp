@@ -19,6 +19,7 @@
 #include <dali/internal/event/effects/shader-factory.h>
 
 // EXTERNAL INCLUDES
+#include <cstring>
 #include <sstream>
 
 // INTERNAL INCLUDES
@@ -32,7 +33,30 @@
 namespace
 {
 const char* VERSION_SEPARATOR = "-";
+const char* ARCHIVE_NAME = "shaders";
 const char* SHADER_SUFFIX = ".dali-bin";
+
+const uint32_t ARCHIVE_MAGIC   = 0x41534C44; ///< "DLSA" in little endian
+const uint32_t ARCHIVE_VERSION = 1u;         ///< Incremented when the layout of the archive changes
+
+/**
+ * The archive starts with this header, followed by an index entry for each binary, followed by the binaries
+ */
+struct ArchiveHeader
+{
+  uint32_t magic;          ///< ARCHIVE_MAGIC
+  uint32_t version;        ///< ARCHIVE_VERSION
+  uint64_t binaryFormatId; ///< Identifies the driver which compiled the binaries
+  uint32_t binaryCount;    ///< The number of index entries
+  uint32_t reserved;       ///< Keeps the index entries aligned
+};
+
+struct ArchiveIndexEntry
+{
+  uint64_t shaderHash; ///< The hash over the shader sources
+  uint32_t offset;     ///< The offset of the binary from the start of the archive, in bytes
+  uint32_t size;       ///< The size of the binary, in bytes
+};
 }
 
 namespace Dali
@@ -45,17 +69,40 @@ namespace
 {
 
 /**
- * @brief Generates a filename for a shader binary based on the hash value passed in.
- * @param[in] shaderHash A hash over shader sources.
+ * @brief Generates the filename of the shader binary archive.
  * @param[out] filename A string to overwrite with the filename.
  */
-void shaderBinaryFilename( size_t shaderHash, std::string& filename )
+void shaderArchiveFilename( std::string& filename )
 {
-  std::stringstream binaryShaderFilenameBuilder( std::ios_base::out );
-  binaryShaderFilenameBuilder << CORE_MAJOR_VERSION << VERSION_SEPARATOR << CORE_MINOR_VERSION << VERSION_SEPARATOR << CORE_MICRO_VERSION << VERSION_SEPARATOR
-                              << shaderHash
-                              << SHADER_SUFFIX;
-  filename = binaryShaderFilenameBuilder.str();
+  std::stringstream archiveFilenameBuilder( std::ios_base::out );
+  archiveFilenameBuilder << CORE_MAJOR_VERSION << VERSION_SEPARATOR << CORE_MINOR_VERSION << VERSION_SEPARATOR << CORE_MICRO_VERSION << VERSION_SEPARATOR
+                         << ARCHIVE_NAME
+                         << SHADER_SUFFIX;
+  filename = archiveFilenameBuilder.str();
+}
+
+/**
+ * @brief Calculates the same hash as Dali::CalculateHash( vertexSource, fragmentSource ) without copying the sources.
+ * @param[in] vertexSource The vertex shader source
+ * @param[in] fragmentSource The fragment shader source
+ * @return The hash over both sources
+ */
+size_t CalculateShaderHash( std::string_view vertexSource, std::string_view fragmentSource )
+{
+  size_t hash( INITIAL_HASH_VALUE );
+  for( std::string_view source : { vertexSource, fragmentSource } )
+  {
+    // djb2, which stops at a terminating null like the std::string version
+    for( const char c : source )
+    {
+      if( c == '\0' )
+      {
+        break;
+      }
+      hash = hash * 33 + c;
+    }
+  }
+  return hash;
 }
 
 }
@@ -65,37 +112,28 @@ ShaderFactory::ShaderFactory() = default;
 ShaderFactory::~ShaderFactory()
 {
   // Let all the cached objects destroy themselves:
-  for( std::size_t i = 0, cacheSize = mShaderBinaryCache.Size(); i < cacheSize; ++i )
+  for( auto&& entry : mShaderBinaryCache )
   {
-    if( mShaderBinaryCache[i] )
-    {
-      mShaderBinaryCache[i]->Unreference();
-    }
+    entry.second->Unreference();
   }
 }
 
 ShaderDataPtr ShaderFactory::Load( std::string_view vertexSource, std::string_view fragmentSource, const Dali::Shader::Hint::Value hints, size_t& shaderHash )
 {
-  // Work out the filename for the binary that the glsl source will be compiled and linked to:
-  shaderHash = CalculateHash( vertexSource.data(), fragmentSource.data() );
-  std::string binaryShaderFilename;
-  shaderBinaryFilename( shaderHash, binaryShaderFilename );
+  shaderHash = CalculateShaderHash( vertexSource, fragmentSource );
 
   ShaderDataPtr shaderData;
 
   /// Check a cache of previously loaded shaders:
-  for( std::size_t i = 0, cacheSize = mShaderBinaryCache.Size(); i < cacheSize; ++i )
+  auto iter = mShaderBinaryCache.find( shaderHash );
+  if( iter != mShaderBinaryCache.end() )
   {
-    if( mShaderBinaryCache[i]->GetHashValue() == shaderHash )
-    {
-      shaderData = mShaderBinaryCache[i];
+    shaderData = iter->second;
 
-      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Mem cache hit on path: \"%s\"\n", binaryShaderFilename.c_str() );
-      break;
-    }
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Mem cache hit for hash: %zu\n", shaderHash );
   }
 
-  // If memory cache failed check the file system for a binary or return a source-only ShaderData:
+  // If memory cache failed check the archive for a binary or return a source-only ShaderData:
   if( shaderData.Get() == nullptr )
   {
     // Allocate the structure that returns the loaded shader:
@@ -103,20 +141,30 @@ ShaderDataPtr ShaderFactory::Load( std::string_view vertexSource, std::string_vi
     shaderData->SetHashValue( shaderHash );
     shaderData->GetBuffer().Clear();
 
-    // Try to load the binary (this will fail if the shader source has never been compiled before):
-    ThreadLocalStorage& tls = ThreadLocalStorage::Get();
-    Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
-    const bool loaded = platformAbstraction.LoadShaderBinaryFile( binaryShaderFilename, shaderData->GetBuffer() );
+    // Try to find the binary (this will fail if the shader source has never been compiled before):
+    LoadArchive();
+    auto entry = mArchiveIndex.find( shaderHash );
+    const bool loaded = entry != mArchiveIndex.end();
 
     if( loaded )
     {
+      shaderData->AllocateBuffer( entry->second.size );
+      memcpy( shaderData->GetBufferData(), mArchive.Begin() + entry->second.offset, entry->second.size );
+      shaderData->SetBinaryFormatId( mArchiveBinaryFormatId );
       MemoryCacheInsert( *shaderData );
+
+      // The memory cache holds the binary from now on
+      mArchiveIndex.erase( entry );
+      if( mArchiveIndex.empty() )
+      {
+        mArchive.Release();
+      }
     }
 
-    DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, loaded ?
-        "loaded on path: \"%s\"\n" :
-        "failed to load on path: \"%s\"\n",
-        binaryShaderFilename.c_str());
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, loaded ?
+        "loaded from archive for hash: %zu\n" :
+        "not in archive for hash: %zu\n",
+        shaderHash );
   }
 
   return shaderData;
@@ -124,19 +172,168 @@ ShaderDataPtr ShaderFactory::Load( std::string_view vertexSource, std::string_vi
 
 void ShaderFactory::SaveBinary( Internal::ShaderDataPtr shaderData )
 {
-  // Save the binary to the file system:
-  std::string binaryShaderFilename;
-  shaderBinaryFilename( shaderData->GetHashValue(), binaryShaderFilename );
+  // Keep the binaries of the archive when it is written again
+  LoadArchive();
 
-  ThreadLocalStorage& tls = ThreadLocalStorage::Get();
-  Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
-  const bool saved = platformAbstraction.SaveShaderBinaryFile( binaryShaderFilename, &shaderData->GetBuffer()[0], static_cast<unsigned int>( shaderData->GetBufferSize() ) ); // don't expect buffer larger than unsigned int
+  if( shaderData->GetBinaryFormatId() != mArchiveBinaryFormatId )
+  {
+    // Compiled by another driver, which cannot load the binaries of the archive
+    size_t discardedCount = mArchiveIndex.size();
+    for( auto&& entry : mShaderBinaryCache )
+    {
+      if( entry.second->GetBinaryFormatId() == mArchiveBinaryFormatId )
+      {
+        ++discardedCount;
+      }
+    }
+    if( discardedCount > 0u )
+    {
+      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Driver changed, discarding %zu archived binaries\n", discardedCount );
+    }
+    mArchive.Release();
+    mArchiveIndex.clear();
+    mArchiveBinaryFormatId = shaderData->GetBinaryFormatId();
+  }
+  mArchiveChanged = true;
+  mBinariesArrived = true;
 
   // Save the binary into to memory cache:
   MemoryCacheInsert( *shaderData );
+}
+
+bool ShaderFactory::SaveArchiveWhenIdle()
+{
+  if( mBinariesArrived )
+  {
+    // More binaries may follow while the new shaders are used, so wait for an idle event processing
+    mBinariesArrived = false;
+    return true;
+  }
+
+  SaveArchive();
+  return false;
+}
+
+void ShaderFactory::SaveArchive()
+{
+  if( !mArchiveChanged )
+  {
+    return;
+  }
+
+  // The binaries of the driver are in the memory cache, apart from those of the archive which have not been loaded
+  ArchiveHeader header{ ARCHIVE_MAGIC, ARCHIVE_VERSION, mArchiveBinaryFormatId, 0u, 0u };
+  std::vector< ArchiveIndexEntry > index;
+  std::vector< const uint8_t* > binaries;
+  index.reserve( mShaderBinaryCache.size() + mArchiveIndex.size() );
+  binaries.reserve( index.capacity() );
+
+  for( auto&& entry : mShaderBinaryCache )
+  {
+    if( entry.second->GetBinaryFormatId() == mArchiveBinaryFormatId )
+    {
+      index.push_back( ArchiveIndexEntry{ entry.first, 0u, static_cast<uint32_t>( entry.second->GetBufferSize() ) } );
+      binaries.push_back( entry.second->GetBufferData() );
+    }
+  }
+  for( auto&& entry : mArchiveIndex )
+  {
+    auto cached = mShaderBinaryCache.find( entry.first );
+    if( cached == mShaderBinaryCache.end() || cached->second->GetBinaryFormatId() != mArchiveBinaryFormatId )
+    {
+      index.push_back( ArchiveIndexEntry{ entry.first, 0u, entry.second.size } );
+      binaries.push_back( mArchive.Begin() + entry.second.offset );
+    }
+  }
+  header.binaryCount = static_cast<uint32_t>( index.size() );
+
+  // Lay out the binaries after the index
+  uint32_t offset = static_cast<uint32_t>( sizeof( ArchiveHeader ) + index.size() * sizeof( ArchiveIndexEntry ) );
+  for( auto&& entry : index )
+  {
+    entry.offset = offset;
+    offset += entry.size;
+  }
+
+  Dali::Vector< uint8_t > archive;
+  archive.Resize( offset );
+  memcpy( archive.Begin(), &header, sizeof( ArchiveHeader ) );
+  memcpy( archive.Begin() + sizeof( ArchiveHeader ), index.data(), index.size() * sizeof( ArchiveIndexEntry ) );
+  for( uint32_t i = 0u; i < index.size(); ++i )
+  {
+    memcpy( archive.Begin() + index[i].offset, binaries[i], index[i].size );
+  }
+
+  std::string archiveFilename;
+  shaderArchiveFilename( archiveFilename );
 
-  DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, saved ? "Saved to file: %s\n" : "Save to file failed: %s\n", binaryShaderFilename.c_str() );
-  if( saved ) {} // Avoid unused variable warning in release builds
+  ThreadLocalStorage& tls = ThreadLocalStorage::Get();
+  Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
+  if( platformAbstraction.SaveShaderBinaryFile( archiveFilename, archive.Begin(), archive.Count() ) )
+  {
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Saved %zu binaries to file: %s\n", index.size(), archiveFilename.c_str() );
+  }
+  else
+  {
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Save of %zu binaries to file failed: %s\n", index.size(), archiveFilename.c_str() );
+  }
+
+  mArchiveChanged = false;
+}
+
+void ShaderFactory::LoadArchive()
+{
+  if( mArchiveLoaded )
+  {
+    return;
+  }
+  mArchiveLoaded = true;
+
+  std::string archiveFilename;
+  shaderArchiveFilename( archiveFilename );
+
+  ThreadLocalStorage& tls = ThreadLocalStorage::Get();
+  Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
+  if( !platformAbstraction.LoadShaderBinaryFile( archiveFilename, mArchive ) )
+  {
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "failed to load archive on path: \"%s\"\n", archiveFilename.c_str() );
+    mArchive.Clear();
+    return;
+  }
+
+  // Index the binaries, ignoring the archive if it is not complete or has another layout
+  ArchiveHeader header{};
+  const uint32_t archiveSize = static_cast<uint32_t>( mArchive.Count() );
+  bool valid = archiveSize >= sizeof( ArchiveHeader );
+  if( valid )
+  {
+    memcpy( &header, mArchive.Begin(), sizeof( ArchiveHeader ) );
+    valid = header.magic == ARCHIVE_MAGIC && header.version == ARCHIVE_VERSION &&
+            header.binaryCount <= ( archiveSize - sizeof( ArchiveHeader ) ) / sizeof( ArchiveIndexEntry );
+  }
+
+  for( uint32_t i = 0u; valid && i < header.binaryCount; ++i )
+  {
+    ArchiveIndexEntry entry;
+    memcpy( &entry, mArchive.Begin() + sizeof( ArchiveHeader ) + i * sizeof( ArchiveIndexEntry ), sizeof( ArchiveIndexEntry ) );
+    valid = entry.size > 0u && entry.offset <= archiveSize && entry.size <= archiveSize - entry.offset;
+    if( valid )
+    {
+      mArchiveIndex[ static_cast<size_t>( entry.shaderHash ) ] = ArchiveEntry{ entry.offset, entry.size };
+    }
+  }
+
+  if( valid )
+  {
+    mArchiveBinaryFormatId = static_cast<size_t>( header.binaryFormatId );
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "loaded %zu binaries from archive: \"%s\"\n", mArchiveIndex.size(), archiveFilename.c_str() );
+  }
+  else
+  {
+    DALI_LOG_ERROR( "Ignoring invalid shader archive: \"%s\"\n", archiveFilename.c_str() );
+    mArchive.Clear();
+    mArchiveIndex.clear();
+  }
 }
 
 void ShaderFactory::MemoryCacheInsert( ShaderData& shaderData )
@@ -146,9 +343,13 @@ void ShaderFactory::MemoryCacheInsert( ShaderData& shaderData )
   // Save the binary into to memory cache:
   if( shaderData.GetBufferSize() > 0 )
   {
-    mShaderBinaryCache.Reserve( mShaderBinaryCache.Size() + 1 ); // Make sure the push won't throw after we inc the ref count.
+    Internal::ShaderData*& entry = mShaderBinaryCache[ shaderData.GetHashValue() ]; // Make sure the insertion won't throw after we inc the ref count.
     shaderData.Reference();
-    mShaderBinaryCache.PushBack( &shaderData );
+    if( entry )
+    {
+      entry->Unreference();
+    }
+    entry = &shaderData;
     DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "CACHED BINARY FOR HASH: %u\n", shaderData.GetHashValue() );
   }
 }
@@ -18,6 +18,10 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <unordered_map>
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/internal/common/message.h>
@@ -36,6 +40,9 @@ using ShaderDataPtr = IntrusivePtr<ShaderData>;
 /**
  * @brief ShaderFactory loads and saves shader binaries synchronously.
  *
+ * The binaries are stored together in a single archive file, which is loaded the first time a
+ * shader is loaded and written again when new binaries have been saved. The archive records the
+ * driver which compiled the binaries, and is discarded when a binary compiled by another driver is saved.
  * Binaries loaded or saved are also cached by the ShaderFactory.
  */
 class ShaderFactory : public ShaderSaver
@@ -70,17 +77,39 @@ public:
   Internal::ShaderDataPtr Load( std::string_view vertexSource, std::string_view fragmentSource, const Dali::Shader::Hint::Value hints, size_t& shaderHash );
 
   /**
-   * @brief Saves shader to memory cache and filesystem.
+   * @brief Saves shader to memory cache and adds it to the archive.
    *
    * This is called when a shader binary is ready to be saved to the memory cache file system.
    * Shaders that pass through here become available to subsequent invocations of Load.
+   * The archive is written to the file system by SaveArchive().
    * @param[in] shader The data to be saved.
    * @sa Load
    */
   void SaveBinary( Internal::ShaderDataPtr shader ) override;
 
+  /**
+   * @brief Writes the archive once an event processing has received no new binaries.
+   *
+   * Called at the end of each event processing. Binaries arrive in bursts while new shaders are used,
+   * so this writes them together instead of rewriting the archive for each binary.
+   * @return True if binaries have just arrived, in which case the caller should request an idle event processing
+   */
+  bool SaveArchiveWhenIdle();
+
+  /**
+   * @brief Writes the archive to the file system if binaries have been added to it since it was last written.
+   *
+   * The whole archive is written by a single call to the platform abstraction.
+   */
+  void SaveArchive();
+
 private:
 
+  /**
+   * @brief Loads the archive from the file system and indexes its binaries, unless this has been done already.
+   */
+  void LoadArchive();
+
   void MemoryCacheInsert( Internal::ShaderData& shaderData );
 
   // Undefined
@@ -90,7 +119,23 @@ private:
   ShaderFactory& operator=( const ShaderFactory& rhs );
 
 private:
-  Dali::Vector< Internal::ShaderData* > mShaderBinaryCache; ///< Cache of pre-compiled shaders.
+
+  /**
+   * The location of a binary within the archive
+   */
+  struct ArchiveEntry
+  {
+    uint32_t offset; ///< The offset of the binary from the start of the archive, in bytes
+    uint32_t size;   ///< The size of the binary, in bytes
+  };
+
+  std::unordered_map< size_t, Internal::ShaderData* > mShaderBinaryCache; ///< Cache of pre-compiled shaders by shader hash.
+  Dali::Vector< uint8_t > mArchive;                                      ///< The contents of the archive file, released once every binary has been loaded
+  std::unordered_map< size_t, ArchiveEntry > mArchiveIndex;              ///< The binaries of mArchive which have not been loaded yet, by shader hash
+  size_t mArchiveBinaryFormatId = 0u;                                    ///< Identifies the driver which compiled the binaries of the archive
+  bool mArchiveLoaded = false;                                           ///< Whether LoadArchive() has been called
+  bool mArchiveChanged = false;                                          ///< Whether binaries have been added since the archive was last written
+  bool mBinariesArrived = false;                                         ///< Whether binaries have been added since the last event processing
 
 }; // class ShaderFactory
 
@@ -148,6 +148,7 @@ bool IsActorExclusiveToAnotherRenderTask( const Actor& actor,
  * Exceptions to this rule are:
  * - When comparing against renderable parents, if Actor is the same distance
  * or closer than it's renderable parent, then it takes priority.
+ * When useSubtreeBounds is true, the sub-trees whose bounds the ray misses are skipped.
  */
 HitActor HitTestWithinLayer( Actor& actor,
                              const RenderTask& renderTask,
@@ -161,7 +162,8 @@ HitActor HitTestWithinLayer( Actor& actor,
                              bool layerIs3d,
                              uint32_t clippingDepth,
                              uint32_t clippingBitPlaneMask,
-                             const RayTest& rayTest )
+                             const RayTest& rayTest,
+                             bool useSubtreeBounds )
 {
   HitActor hit;
 
@@ -170,6 +172,12 @@ HitActor HitTestWithinLayer( Actor& actor,
     return hit;
   }
 
+  // Neither the actor nor its children can be hit if the ray misses the bounds of all of them.
+  if( useSubtreeBounds && !rayTest.SubtreeTest( actor, rayOrigin, rayDir ) )
+  {
+    return hit;
+  }
+
   // For clipping, regardless of whether we have hit this actor or not,
   // we increase the clipping depth if we have hit a clipping actor.
   // This is used later to ensure all nested clipped children have hit
@@ -299,7 +307,8 @@ HitActor HitTestWithinLayer( Actor& actor,
                                                  layerIs3d,
                                                  newClippingDepth,
                                                  clippingBitPlaneMask,
-                                                 rayTest ) );
+                                                 rayTest,
+                                                 useSubtreeBounds ) );
 
         bool updateChildHit = false;
         if( currentHit.distance >= 0.0f )
@@ -477,7 +486,8 @@ bool HitTestRenderTask( const RenderTaskList::ExclusivesContainer& exclusives,
                                         layer->GetBehavior() == Dali::Layer::LAYER_3D,
                                         0u,
                                         0u,
-                                        rayTest );
+                                        rayTest,
+                                        layer->IsHitTestIndexEnabled() );
             }
             else if( IsWithinSourceActors( *sourceActor, *layer ) )
             {
@@ -494,7 +504,8 @@ bool HitTestRenderTask( const RenderTaskList::ExclusivesContainer& exclusives,
                                         layer->GetBehavior() == Dali::Layer::LAYER_3D,
                                         0u,
                                         0u,
-                                        rayTest );
+                                        rayTest,
+                                        layer->IsHitTestIndexEnabled() );
             }
 
             // If this layer is set to consume the hit, then do not check any layers behind it
@@ -18,6 +18,11 @@
 // CLASS HEADER
 #include <dali/internal/event/events/ray-test.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/math/vector2.h>
 #include <dali/public-api/math/vector3.h>
@@ -129,6 +134,50 @@ bool RayTest::SphereTest( const Internal::Actor& actor, const Vector4& rayOrigin
   return ( b2 * b2 - a * c ) >= 0.0f;
 }
 
+bool RayTest::SubtreeTest( const Internal::Actor& actor, const Vector4& rayOrigin, const Vector4& rayDir ) const
+{
+  Vector3 boundsMin;
+  Vector3 boundsMax;
+  if( !actor.OnScene() || !actor.GetNode().GetSubtreeBounds( EventThreadServices::Get().GetEventBufferIndex(), boundsMin, boundsMax ) )
+  {
+    return true;
+  }
+
+  // Like the sphere test, the whole line is tested and not only the points in front of the ray origin.
+  // Intersect the parameter intervals where the line is between the two planes of each axis.
+  float nearest = -std::numeric_limits<float>::max();
+  float farthest = std::numeric_limits<float>::max();
+  for( uint32_t axis = 0u; axis < 3u; ++axis )
+  {
+    const float origin = rayOrigin.AsFloat()[axis];
+    const float direction = rayDir.AsFloat()[axis];
+    if( fabsf( direction ) < std::numeric_limits<float>::min() )
+    {
+      // The line is parallel to the planes, so it is either always or never between them
+      if( origin < boundsMin.AsFloat()[axis] || origin > boundsMax.AsFloat()[axis] )
+      {
+        return false;
+      }
+    }
+    else
+    {
+      float enter = ( boundsMin.AsFloat()[axis] - origin ) / direction;
+      float exit = ( boundsMax.AsFloat()[axis] - origin ) / direction;
+      if( enter > exit )
+      {
+        std::swap( enter, exit );
+      }
+      nearest = std::max( nearest, enter );
+      farthest = std::min( farthest, exit );
+      if( nearest > farthest )
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
 
 bool RayTest::ActorTest(const Internal::Actor& actor, const Vector4& rayOrigin, const Vector4& rayDir, Vector2& hitPointLocal, float& distance) const
 {
@@ -61,6 +61,17 @@ public:
    */
   bool SphereTest(const Internal::Actor& actor, const Vector4& rayOrigin, const Vector4& rayDir) const;
 
+  /**
+   * Performs a ray-box test with the given pick-ray and the bounds of the given actor and of all its descendants.
+   *
+   * @param[in] actor The actor whose sub-tree to test
+   * @param[in] rayOrigin The ray origin in the world's reference system
+   * @param[in] rayDir The ray director vector in the world's reference system
+   * @return False if the ray cannot pass the sphere test of the actor nor of any of its descendants,
+   * true if it can or if the bounds of the actor are not available
+   */
+  bool SubtreeTest(const Internal::Actor& actor, const Vector4& rayOrigin, const Vector4& rayDir) const;
+
   /**
    * Performs a ray-actor test with the given pick-ray and the given actor's geometry.
    *
@@ -44,7 +44,8 @@ DALI_PROPERTY_TABLE_END( DEFAULT_ACTOR_PROPERTY_START_INDEX, ShaderDefaultProper
 Dali::Scripting::StringEnum ShaderHintsTable[] =
   { { "NONE",                     Dali::Shader::Hint::NONE},
     { "OUTPUT_IS_TRANSPARENT",    Dali::Shader::Hint::OUTPUT_IS_TRANSPARENT},
-    { "MODIFIES_GEOMETRY",        Dali::Shader::Hint::MODIFIES_GEOMETRY}
+    { "MODIFIES_GEOMETRY",        Dali::Shader::Hint::MODIFIES_GEOMETRY},
+    { "INSTANCED",                Dali::Shader::Hint::INSTANCED}
   };
 
 const uint32_t ShaderHintsTableSize = static_cast<uint32_t>( sizeof( ShaderHintsTable ) / sizeof( ShaderHintsTable[0] ) );
@@ -86,6 +87,11 @@ Property::Value HintString(const Dali::Shader::Hint::Value& hints)
     AppendString(s, "MODIFIES_GEOMETRY");
   }
 
+  if(hints & Dali::Shader::Hint::INSTANCED)
+  {
+    AppendString(s, "INSTANCED");
+  }
+
   return Property::Value(s);
 }
 
@@ -211,6 +217,13 @@ void Shader::SetShader( std::string_view vertexSource,
   SetShaderProgramMessage( updateManager, GetShaderSceneObject(), mShaderData, (hints & Dali::Shader::Hint::MODIFIES_GEOMETRY) != 0x0 );
 }
 
+void Shader::Precompile()
+{
+  EventThreadServices& eventThreadServices = GetEventThreadServices();
+  SceneGraph::UpdateManager& updateManager = eventThreadServices.GetUpdateManager();
+  PrecompileShaderProgramMessage( updateManager, mShaderData, ( mShaderData->GetHints() & Dali::Shader::Hint::MODIFIES_GEOMETRY ) != 0x0 );
+}
+
 Shader::~Shader()
 {
   if( EventThreadServices::IsCoreRunning() )
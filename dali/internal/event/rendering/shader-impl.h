@@ -59,6 +59,11 @@ public:
    */
   const SceneGraph::Shader& GetShaderSceneObject() const;
 
+  /**
+   * @copydoc Dali::DevelShader::Precompile()
+   */
+  void Precompile();
+
 public: // Default property extensions from Object
 
   /**
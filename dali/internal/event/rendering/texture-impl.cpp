@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/integration-api/render-controller.h>
 #include <dali/internal/event/common/stage-impl.h>
+#include <dali/internal/event/common/thread-local-storage.h>
 #include <dali/internal/update/manager/update-manager.h>
 
 // EXTERNAL INCLUDES
@@ -91,6 +92,7 @@ void Texture::Initialize()
     else
     {
       mRenderObject = new Render::Texture(mType, mFormat, mSize);
+      mRenderObject->CacheRgbaConversion(ThreadLocalStorage::Get().GetGlAbstraction());
     }
 
     OwnerPointer<Render::Texture> transferOwnership(mRenderObject);
@@ -51,6 +51,7 @@ public:
     CONSTRAINTS_APPLIED,
     CONSTRAINTS_SKIPPED,
     UPDATE_NODES,
+    TRANSFORMS_SKIPPED,
     PREPARE_RENDERABLES,
     PROCESS_RENDER_TASKS,
     DRAW_NODES,
@@ -164,6 +164,39 @@ inline void SetupStencilClipping( const RenderItem& item, Context& context, uint
   }
 }
 
+/**
+ * @brief Checks whether an item is inside the root clipping rect, so needs to be drawn.
+ * @param[in] item             The RenderItem to check
+ * @param[in] viewport         The viewport rectangle
+ * @param[in] rootClippingRect The root clipping rect, empty when not used
+ * @return True if the item needs to be drawn
+ */
+inline bool IsInsideRootClippingRect( const RenderItem& item, const ClippingBox& viewport, const Rect<int>& rootClippingRect )
+{
+  if( rootClippingRect.IsEmpty() )
+  {
+    return true;
+  }
+
+  auto rect = item.CalculateViewportSpaceAABB( item.mUpdateSize, viewport.width, viewport.height );
+  return rect.Intersect( rootClippingRect );
+}
+
+/**
+ * @brief Checks whether an item can be drawn in the same instanced draw call as the previous item,
+ * without the clipping set up for the previous item having to change.
+ * @param[in] item     The RenderItem to check
+ * @param[in] previous The previous RenderItem
+ * @return True if the clipping state is unchanged
+ */
+inline bool HasSameClipping( const RenderItem& item, const RenderItem& previous )
+{
+  return ( item.mNode->GetClippingMode() == ClippingMode::DISABLED ) &&
+         ( item.mNode->GetClippingDepth() == previous.mNode->GetClippingDepth() ) &&
+         ( item.mNode->GetClippingId() == previous.mNode->GetClippingId() ) &&
+         ( item.mNode->GetScissorDepth() == previous.mNode->GetScissorDepth() );
+}
+
 /**
  * @brief Sets up the depth buffer for reading and writing based on the current render item.
  * The items read and write mode are used if specified.
@@ -389,6 +422,42 @@ inline void RenderAlgorithms::SetupClipping(const RenderItem&
   }
 }
 
+inline uint32_t RenderAlgorithms::GetInstanceCount( const RenderList& renderList,
+                                                    uint32_t index,
+                                                    BufferIndex bufferIndex,
+                                                    const Rect<int>& rootClippingRect )
+{
+  const RenderItem& item = renderList.GetItem( index );
+  if( !item.mRenderer->IsInstanced() )
+  {
+    return 0u;
+  }
+
+  // The first item may set up a new clip, which the following items would have to undo
+  uint32_t instanceCount = 1u;
+  if( item.mNode->GetClippingMode() != ClippingMode::DISABLED )
+  {
+    return instanceCount;
+  }
+
+  const uint32_t count = renderList.Count();
+  for( uint32_t next = index + 1u; next < count; ++next )
+  {
+    const RenderItem& nextItem = renderList.GetItem( next );
+    if( !nextItem.mRenderer ||
+        nextItem.mIsOpaque != item.mIsOpaque ||
+        !HasSameClipping( nextItem, item ) ||
+        !IsInsideRootClippingRect( nextItem, mViewportRectangle, rootClippingRect ) ||
+        !item.mRenderer->IsInstanceCompatible( bufferIndex, *item.mNode, *nextItem.mRenderer, *nextItem.mNode ) )
+    {
+      break;
+    }
+    ++instanceCount;
+  }
+
+  return instanceCount;
+}
+
 inline void RenderAlgorithms::ProcessRenderList( const RenderList& renderList,
                                                  Context& context,
                                                  BufferIndex bufferIndex,
@@ -449,20 +518,7 @@ inline void RenderAlgorithms::ProcessRenderList( const RenderList& renderList,
     const RenderItem& item = renderList.GetItem( index );
 
     // Discard renderers outside the root clipping rect
-    bool skip = true;
-    if( !rootClippingRect.IsEmpty() )
-    {
-      auto rect = item.CalculateViewportSpaceAABB( item.mUpdateSize, mViewportRectangle.width, mViewportRectangle.height );
-
-      if(rect.Intersect( rootClippingRect ))
-      {
-        skip = false;
-      }
-    }
-    else
-    {
-      skip = false;
-    }
+    const bool skip = !IsInsideRootClippingRect( item, mViewportRectangle, rootClippingRect );
 
     DALI_PRINT_RENDER_ITEM( item );
 
@@ -487,7 +543,15 @@ inline void RenderAlgorithms::ProcessRenderList( const RenderList& renderList,
       // iteration must be done and the default behaviour of the renderer will be executed.
       // The queues allow to iterate over the same renderer multiple times changing the state of the renderer.
       // It is similar to the multi-pass rendering.
-      if( !skip )
+      // Runs of items using an instanced shader and compatible renderers are drawn with a single draw call.
+      const uint32_t instanceCount = skip ? 0u : GetInstanceCount( renderList, index, bufferIndex, rootClippingRect );
+      if( instanceCount > 0u )
+      {
+        item.mRenderer->RenderInstances( context, bufferIndex, renderList, index, instanceCount,
+                                         viewMatrix, projectionMatrix, !item.mIsOpaque, boundTextures, instruction );
+        index += instanceCount - 1u;
+      }
+      else if( !skip )
       {
         auto const MAX_QUEUE = item.mRenderer->GetDrawCommands().empty() ? 1 : DevelRenderer::RENDER_QUEUE_MAX;
         for (auto queue = 0u; queue < MAX_QUEUE; ++queue)
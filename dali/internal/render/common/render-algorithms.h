@@ -110,6 +110,20 @@ class RenderAlgorithms
                               Integration::StencilBufferAvailable                  stencilBufferAvailable,
                               const Dali::Internal::SceneGraph::RenderInstruction& instruction);
 
+    /**
+     * @brief Counts the items, starting at the given one, that can be drawn with a single instanced draw call.
+     * The items must use an instanced shader and compatible renderers, and must not change the clipping state.
+     * @param[in] renderList       The render-list containing the items
+     * @param[in] index            The index of the first item
+     * @param[in] bufferIndex      The current render buffer index (previous update buffer)
+     * @param[in] rootClippingRect The clipping rect of the render-list, empty when not used
+     * @return The number of items to draw together, or 0 if the first item does not use an instanced shader
+     */
+    inline uint32_t GetInstanceCount( const SceneGraph::RenderList& renderList,
+                                      uint32_t index,
+                                      BufferIndex bufferIndex,
+                                      const Rect<int>& rootClippingRect );
+
     /**
      * @brief Process a render-list.
      * @param[in] renderList             The render-list to process.
@@ -39,7 +39,7 @@ namespace SceneGraph
 
 RenderItem* RenderItem::New()
 {
-  return new ( gRenderItemPool.AllocateRaw() ) RenderItem();
+  return new ( gRenderItemPool.AllocateRawThreadSafe() ) RenderItem();
 }
 
 RenderItem::RenderItem()
@@ -117,7 +117,12 @@ ClippingBox RenderItem::CalculateViewportSpaceAABB( const Vector3& size, const i
 
 void RenderItem::operator delete( void* ptr )
 {
-  gRenderItemPool.Free( static_cast<RenderItem*>( ptr ) );
+  gRenderItemPool.FreeThreadSafe( static_cast<RenderItem*>( ptr ) );
+}
+
+uint32_t RenderItem::TrimMemoryPool()
+{
+  return gRenderItemPool.Trim();
 }
 
 } // namespace SceneGraph
@@ -76,6 +76,12 @@ struct RenderItem
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the memory of the render item memory pool which no render item is using.
+   * @return The number of bytes released
+   */
+  static uint32_t TrimMemoryPool();
+
   Matrix            mModelMatrix;
   Matrix            mModelViewMatrix;
   Vector4           mColor;
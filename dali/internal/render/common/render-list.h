@@ -121,6 +121,19 @@ public:
     return item;
   }
 
+  /**
+   * Makes sure that the next calls to GetNextFreeItem() reuse existing items instead of creating new ones.
+   * Items can then be taken from the list outside of the update thread, as they are allocated from a shared pool
+   * @param[in] count The number of items that will be requested
+   */
+  void ReserveFreeItems( uint32_t count )
+  {
+    while( mItems.Count() < mNextFree + count )
+    {
+      mItems.PushBack( RenderItem::New() );
+    }
+  }
+
   /**
    * Get item at a given position in the list
    */
@@ -113,6 +113,7 @@ struct RenderManager::Impl
     auto iter = std::find( sceneContextContainer.Begin(), sceneContextContainer.End(), sceneContext );
     if( iter != sceneContextContainer.End() )
     {
+      ForgetVertexArrays( *sceneContext );
       ( *iter )->GlContextDestroyed();
       sceneContextContainer.Erase( iter );
     }
@@ -122,12 +123,24 @@ struct RenderManager::Impl
   {
     Context* newContext = new Context( glAbstraction );
 
+    ForgetVertexArrays( *oldSceneContext );
     oldSceneContext->GlContextDestroyed();
 
     std::replace( sceneContextContainer.begin(), sceneContextContainer.end(), oldSceneContext, newContext );
     return newContext;
   }
 
+  /**
+   * Vertex array objects are not shared between contexts, so the geometries forget the ones of a destroyed context
+   */
+  void ForgetVertexArrays( const Context& sceneContext )
+  {
+    for( auto&& geometry : geometryContainer )
+    {
+      geometry->GlContextDestroyed( sceneContext );
+    }
+  }
+
   void UpdateTrackers()
   {
     for( auto&& iter : mRenderTrackers )
@@ -215,7 +228,7 @@ RenderQueue& RenderManager::GetRenderQueue()
 void RenderManager::ContextCreated()
 {
   mImpl->context.GlContextCreated();
-  mImpl->programController.GlContextCreated();
+  mImpl->programController.GlContextCreated( mImpl->context.CachedGlesMajorVersion() );
 
   // renderers, textures and gpu buffers cannot reinitialize themselves
   // so they rely on someone reloading the data for them
@@ -244,6 +257,12 @@ void RenderManager::ContextDestroyed()
     renderer->GlContextDestroyed();
   }
 
+  // inform geometries, including the ones not used by any renderer
+  for( auto&& geometry : mImpl->geometryContainer )
+  {
+    geometry->GlContextDestroyed();
+  }
+
   // inform context
   for( auto&& context : mImpl->sceneContextContainer )
   {
@@ -427,6 +446,7 @@ void RenderManager::AddGeometry( OwnerPointer< Render::Geometry >& geometry )
 
 void RenderManager::RemoveGeometry( Render::Geometry* geometry )
 {
+  geometry->Destroy( *mImpl->currentContext );
   mImpl->geometryContainer.EraseObject( geometry );
 }
 
@@ -480,6 +500,17 @@ ProgramCache* RenderManager::GetProgramCache()
   return &(mImpl->programController);
 }
 
+void RenderManager::SetProgramCacheBudget( uint32_t programCount )
+{
+  mImpl->programController.SetProgramBudget( programCount );
+}
+
+void RenderManager::PrecompileProgram( Internal::ShaderDataPtr shaderData, bool modifiesGeometry )
+{
+  Program* program = Program::New( mImpl->programController, shaderData, modifiesGeometry );
+  mImpl->programController.Precompile( *program );
+}
+
 void RenderManager::PreRender( Integration::RenderStatus& status, bool forceClear, bool uploadOnly )
 {
   DALI_PRINT_RENDER_START( mImpl->renderBufferIndex );
@@ -490,8 +521,24 @@ void RenderManager::PreRender( Integration::RenderStatus& status, bool forceClea
   // Increment the frame count at the beginning of each frame
   ++mImpl->frameCount;
 
+  // Uniform blocks written by the previous frames may still be in use by the GPU, so move to the next part of the ring
+  mImpl->context.GetUniformBufferRing().NextFrame();
+  for( auto&& context : mImpl->sceneContextContainer )
+  {
+    context->GetUniformBufferRing().NextFrame();
+  }
+
   // Process messages queued during previous update
   mImpl->renderQueue.ProcessMessages( mImpl->renderBufferIndex );
+  status.SetRenderQueueSize( static_cast<uint32_t>( mImpl->renderQueue.GetProcessedSize() ) );
+
+  // Load the programs created by the messages, and compile some of the deferred ones
+  mImpl->programController.LoadPendingPrograms();
+  if( mImpl->programController.HasDeferredPrograms() )
+  {
+    // Keep rendering until the renderers waiting for them can be drawn
+    status.SetNeedsUpdate( true );
+  }
 
   uint32_t count = 0u;
   for( uint32_t i = 0; i < mImpl->sceneContainer.size(); ++i )
@@ -525,6 +572,7 @@ void RenderManager::PreRender( Integration::RenderStatus& status, bool forceClea
       // Clear the current cached program when the context is switched
       mImpl->programController.ClearCurrentProgram();
     }
+    mImpl->currentContext->DeletePendingVertexArrays();
 
     // Upload the geometries
     for( uint32_t i = 0; i < mImpl->sceneContainer.size(); ++i )
@@ -869,6 +917,7 @@ void RenderManager::RenderScene( Integration::RenderStatus& status, Integration:
 
     // Make sure that GL context must be created
      mImpl->currentContext->GlContextCreated();
+     mImpl->currentContext->DeletePendingVertexArrays();
 
     // reset the program matrices for all programs once per frame
     // this ensures we will set view and projection matrix once per program per camera
@@ -1093,7 +1142,6 @@ void RenderManager::RenderScene( Integration::RenderStatus& status, Integration:
 
   GLenum attachments[] = { GL_DEPTH, GL_STENCIL };
   mImpl->currentContext->InvalidateFramebuffer(GL_FRAMEBUFFER, 2, attachments);
-
 }
 
 void RenderManager::PostRender( bool uploadOnly )
@@ -1103,10 +1151,20 @@ void RenderManager::PostRender( bool uploadOnly )
     if ( mImpl->currentContext->IsSurfacelessContextSupported() )
     {
       mImpl->glContextHelperAbstraction.MakeSurfacelessContextCurrent();
+
+      // Keep track of the current context, which the render messages of the next frame delete resources in
+      if ( mImpl->currentContext != &mImpl->context )
+      {
+        mImpl->currentContext = &mImpl->context;
+        mImpl->programController.ClearCurrentProgram();
+      }
     }
 
     GLenum attachments[] = { GL_DEPTH, GL_STENCIL };
     mImpl->context.InvalidateFramebuffer(GL_FRAMEBUFFER, 2, attachments);
+
+    // Programs are shared between the contexts, so they can be unloaded with the shared context current
+    mImpl->programController.UnloadLeastRecentlyUsedPrograms();
   }
 
   //Notify RenderGeometries that rendering has finished
@@ -352,6 +352,19 @@ public:
    */
   ProgramCache* GetProgramCache();
 
+  /**
+   * Sets the maximum number of GL programs to keep loaded.
+   * @param[in] programCount The number of programs, or 0 for no limit
+   */
+  void SetProgramCacheBudget( uint32_t programCount );
+
+  /**
+   * Creates the program of a shader ahead of its use and compiles it in a later frame, without stalling the rendering.
+   * @param[in] shaderData The shader source and binary
+   * @param[in] modifiesGeometry True if the shader modifies geometry
+   */
+  void PrecompileProgram( Internal::ShaderDataPtr shaderData, bool modifiesGeometry );
+
   // This method should be called from Core::PreRender()
 
   /**
@@ -88,6 +88,9 @@ Context::Context( Integration::GlAbstraction& glAbstraction, OwnerContainer< Con
   mBoundArrayBufferId(0),
   mBoundElementArrayBufferId(0),
   mBoundTransformFeedbackBufferId(0),
+  mBoundUniformBufferId(0),
+  mDefaultElementArrayBufferId(0),
+  mBoundVertexArrayId(0),
   mActiveTextureUnit( TEXTURE_UNIT_LAST ),
   mBlendColor(Color::TRANSPARENT),
   mBlendFuncSeparateSrcRGB(GL_ONE),
@@ -104,11 +107,14 @@ Context::Context( Integration::GlAbstraction& glAbstraction, OwnerContainer< Con
   mStencilOpDepthPass( GL_KEEP ),
   mDepthFunction( GL_LESS ),
   mMaxTextureSize(0),
+  mGlesMajorVersion(2),
   mClearColor(Color::WHITE),    // initial color, never used until it's been set by the user
   mCullFaceMode( FaceCullingMode::NONE ),
   mViewPort( 0, 0, 0, 0 ),
   mSceneContexts( contexts ),
-  mSurfaceOrientation(0)
+  mSurfaceOrientation(0),
+  mPendingVertexArrayDeletions(),
+  mUniformBufferRing( *this )
 {
 }
 
@@ -135,6 +141,10 @@ void Context::GlContextDestroyed()
 {
   DALI_LOG_INFO(gContextLogFilter, Debug::Verbose, "Context::GlContextDestroyed()\n");
   mGlContextCreated = false;
+  mUniformBufferRing.GlContextDestroyed();
+
+  // GL has released the vertex array objects with the context
+  mPendingVertexArrayDeletions.Clear();
 }
 
 const char* Context::ErrorToString( GLenum errorCode )
@@ -156,6 +166,12 @@ const Rect< int >& Context::GetViewport()
 
 void Context::FlushVertexAttributeLocations()
 {
+  if( mBoundVertexArrayId != 0 )
+  {
+    // the cached state belongs to the default vertex array, the bound one holds its own state
+    return;
+  }
+
   for( unsigned int i = 0; i < MAX_ATTRIBUTE_CACHE_SIZE; ++i )
   {
     // see if our cached state is different to the actual state
@@ -182,10 +198,9 @@ void Context::FlushVertexAttributeLocations()
 
 void Context::SetVertexAttributeLocation(unsigned int location, bool state)
 {
-
-  if( location >= MAX_ATTRIBUTE_CACHE_SIZE )
+  if( location >= MAX_ATTRIBUTE_CACHE_SIZE || mBoundVertexArrayId != 0 )
   {
-    // not cached, make the gl call through context
+    // not cached, or the state belongs to the bound vertex array, make the gl call through context
     if ( state )
     {
        LOG_GL("EnableVertexAttribArray %d\n", location);
@@ -227,6 +242,9 @@ void Context::InitializeGlState()
   mBoundArrayBufferId = 0;
   mBoundElementArrayBufferId = 0;
   mBoundTransformFeedbackBufferId = 0;
+  mBoundUniformBufferId = 0;
+  mDefaultElementArrayBufferId = 0;
+  mBoundVertexArrayId = 0;
   mActiveTextureUnit = TEXTURE_UNIT_IMAGE;
 
   mUsingDefaultBlendColor = true; //Default blend color is (0,0,0,0)
@@ -245,6 +263,11 @@ void Context::InitializeGlState()
   // get maximum texture size
   mGlAbstraction.GetIntegerv(GL_MAX_TEXTURE_SIZE, &mMaxTextureSize);
 
+  // get the version of the context, GL_MAJOR_VERSION is not known by OpenGL ES 2.0 so clear the error it raises there
+  mGlesMajorVersion = 2;
+  mGlAbstraction.GetIntegerv(GL_MAJOR_VERSION, &mGlesMajorVersion);
+  mGlAbstraction.GetError();
+
   // reset viewport, this will be set to something useful when rendering
   mViewPort.x = mViewPort.y = mViewPort.width = mViewPort.height = 0;
 
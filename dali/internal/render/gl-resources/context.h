@@ -32,6 +32,7 @@
 #include <dali/internal/render/gl-resources/texture-units.h>
 #include <dali/internal/render/gl-resources/frame-buffer-state-cache.h>
 #include <dali/internal/render/gl-resources/gl-call-debug.h>
+#include <dali/internal/render/gl-resources/uniform-buffer-ring.h>
 
 namespace Dali
 {
@@ -145,6 +146,8 @@ public:
     mBoundArrayBufferId = 0;
     mBoundElementArrayBufferId = 0;
     mBoundTransformFeedbackBufferId = 0;
+    mBoundUniformBufferId = 0;
+    mDefaultElementArrayBufferId = 0;
   }
 
   /**
@@ -309,6 +312,56 @@ public:
     }
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindBuffer(GL_UNIFORM_BUFFER, ...)
+   */
+  void BindUniformBuffer(GLuint buffer)
+  {
+    // Avoid unecessary calls to BindBuffer
+    if (mBoundUniformBufferId != buffer)
+    {
+      mBoundUniformBufferId = buffer;
+
+      LOG_GL("BindBuffer GL_UNIFORM_BUFFER %d\n", buffer);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindBuffer(GL_UNIFORM_BUFFER, buffer) );
+    }
+  }
+
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindVertexArray()
+   * The element array buffer binding is part of the vertex array state, so the cached binding of the
+   * default vertex array is kept aside while another vertex array is bound.
+   */
+  void BindVertexArray(GLuint array)
+  {
+    // Avoid unecessary calls to BindVertexArray
+    if (mBoundVertexArrayId != array)
+    {
+      if( mBoundVertexArrayId == 0 )
+      {
+        mDefaultElementArrayBufferId = mBoundElementArrayBufferId;
+        mBoundElementArrayBufferId = 0;
+      }
+      else if( array == 0 )
+      {
+        mBoundElementArrayBufferId = mDefaultElementArrayBufferId;
+      }
+      mBoundVertexArrayId = array;
+
+      LOG_GL("BindVertexArray %d\n", array);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindVertexArray(array) );
+    }
+  }
+
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindBufferRange()
+   */
+  void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+  {
+    LOG_GL("BindBufferRange %x %d %d %d %d\n", target, index, buffer, offset, size);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.BindBufferRange(target, index, buffer, offset, size) );
+  }
+
   /**
    * Wrapper for OpenGL ES 2.0 glBindFramebuffer()
    */
@@ -765,6 +818,49 @@ public:
     }
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glDeleteVertexArrays()
+   */
+  void DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+  {
+    if( this->IsGlContextCreated() )
+    {
+      // If the bound vertex array is deleted, the binding reverts to the default vertex array
+      for( GLsizei i = 0; i < n; ++i )
+      {
+        if( arrays[i] == mBoundVertexArrayId )
+        {
+          BindVertexArray( 0 );
+        }
+      }
+
+      LOG_GL("DeleteVertexArrays %d %p\n", n, arrays);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.DeleteVertexArrays(n, arrays) );
+    }
+  }
+
+  /**
+   * Queues a vertex array object of this context to be deleted the next time the context is current.
+   * Vertex array objects are not shared between contexts, so they cannot be deleted while another one is.
+   * @param[in] array The vertex array object
+   */
+  void QueueVertexArrayDeletion( GLuint array )
+  {
+    mPendingVertexArrayDeletions.PushBack( array );
+  }
+
+  /**
+   * Deletes the vertex array objects queued by QueueVertexArrayDeletion(); call when this context is current.
+   */
+  void DeletePendingVertexArrays()
+  {
+    if( !mPendingVertexArrayDeletions.Empty() )
+    {
+      DeleteVertexArrays( static_cast< GLsizei >( mPendingVertexArrayDeletions.Count() ), mPendingVertexArrayDeletions.Begin() );
+      mPendingVertexArrayDeletions.Clear();
+    }
+  }
+
   /**
    * Wrapper for OpenGL ES 3.0 glDeleteTransformFeedbacks()
    */
@@ -906,6 +1002,15 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.GenTransformFeedbacks(n, ids) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glGenVertexArrays()
+   */
+  void GenVertexArrays(GLsizei n, GLuint* arrays)
+  {
+    LOG_GL("GenVertexArrays %d %p\n", n, arrays);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GenVertexArrays(n, arrays) );
+  }
+
   /**
    * @return the current buffer bound for a given target
    */
@@ -956,6 +1061,15 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttribDivisor( index, divisor ) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 2.0 glVertexAttrib4fv()
+   */
+  void VertexAttrib4fv( GLuint index, const GLfloat* values )
+  {
+    LOG_GL("VertexAttrib4fv(%d, %p)\n", index, values );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttrib4fv( index, values ) );
+  }
+
   /**
    * Wrapper for OpenGL ES 2.0 glVertexAttribPointer()
    */
@@ -1833,6 +1947,24 @@ public:
     return mMaxTextureSize;
   }
 
+  /**
+   * Get the major version of the OpenGL ES context. This value is cached when the context is created
+   * @return The major version, i.e. 2 for an OpenGL ES 2.0 context
+   */
+  GLint CachedGlesMajorVersion() const
+  {
+    return mGlesMajorVersion;
+  }
+
+  /**
+   * Get the ring buffer that the uniform blocks of each draw call are written to
+   * @return The uniform buffer ring
+   */
+  UniformBufferRing& GetUniformBufferRing()
+  {
+    return mUniformBufferRing;
+  }
+
   void SetSurfaceOrientation(int orientation)
   {
     LOG_GL( "SetSurfaceOrientation: orientation: %d\n", orientation );
@@ -1906,6 +2038,11 @@ private: // Data
   GLuint mBoundArrayBufferId;        ///< The ID passed to glBindBuffer(GL_ARRAY_BUFFER)
   GLuint mBoundElementArrayBufferId; ///< The ID passed to glBindBuffer(GL_ELEMENT_ARRAY_BUFFER)
   GLuint mBoundTransformFeedbackBufferId; ///< The ID passed to glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER)
+  GLuint mBoundUniformBufferId;      ///< The ID passed to glBindBuffer(GL_UNIFORM_BUFFER)
+  GLuint mDefaultElementArrayBufferId; ///< The element array buffer of the default vertex array, while another one is bound
+
+  // glBindVertexArray() state
+  GLuint mBoundVertexArrayId;        ///< The ID passed to glBindVertexArray()
 
   // glBindTexture() state
   TextureUnit mActiveTextureUnit;
@@ -1935,6 +2072,7 @@ private: // Data
   GLenum mDepthFunction;  ///The depth function
 
   GLint mMaxTextureSize;      ///< return value from GetIntegerv(GL_MAX_TEXTURE_SIZE)
+  GLint mGlesMajorVersion;    ///< return value from GetIntegerv(GL_MAJOR_VERSION), 2 if it is not supported
   Vector4 mClearColor;        ///< clear color
 
   // Face culling mode
@@ -1952,6 +2090,10 @@ private: // Data
   OwnerContainer< Context* >* mSceneContexts;      ///< The pointer of the container of contexts for surface rendering
 
   int mSurfaceOrientation;
+
+  Dali::Vector< GLuint > mPendingVertexArrayDeletions; ///< Vertex array objects to delete the next time this context is current
+
+  UniformBufferRing mUniformBufferRing; ///< Uniform block values of the draw calls, destroyed first as it uses the context
 };
 
 } // namespace Internal
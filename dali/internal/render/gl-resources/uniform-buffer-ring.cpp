@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/gl-resources/uniform-buffer-ring.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali/internal/render/gl-resources/context.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const GLsizeiptr INITIAL_FRAME_SIZE = 16 * 1024; ///< Enough for a few hundred small uniform blocks per frame
+const GLint DEFAULT_ALIGNMENT = 256;             ///< The largest alignment GLES 3.0 allows an implementation to require
+
+} // unnamed namespace
+
+UniformBufferRing::UniformBufferRing( Context& context )
+: mContext( context ),
+  mFrameSize( 0 ),
+  mOffset( 0 ),
+  mAlignment( 0 ),
+  mBufferId( 0u ),
+  mFrame( 0u )
+{
+}
+
+UniformBufferRing::~UniformBufferRing()
+{
+  if( mBufferId )
+  {
+    mContext.DeleteBuffers( 1, &mBufferId );
+  }
+}
+
+void UniformBufferRing::NextFrame()
+{
+  mFrame = ( mFrame + 1u ) % FRAME_COUNT;
+  mOffset = 0;
+}
+
+void UniformBufferRing::WriteAndBind( GLuint binding, const void* data, GLsizeiptr size )
+{
+  if( mBufferId == 0u )
+  {
+    Reserve( std::max( INITIAL_FRAME_SIZE, size ) );
+  }
+  else if( mOffset + size > mFrameSize )
+  {
+    // Orphan the buffer; the draw calls already issued keep reading the old storage
+    Reserve( std::max( mFrameSize * 2, size ) );
+  }
+  else
+  {
+    mContext.BindUniformBuffer( mBufferId );
+  }
+
+  const GLintptr offset = static_cast<GLintptr>( mFrame ) * mFrameSize + mOffset;
+  mContext.BufferSubData( GL_UNIFORM_BUFFER, offset, size, data );
+  mContext.BindBufferRange( GL_UNIFORM_BUFFER, binding, mBufferId, offset, size );
+
+  // The next block has to start at an aligned offset too
+  mOffset += ( ( size + mAlignment - 1 ) / mAlignment ) * mAlignment;
+}
+
+void UniformBufferRing::GlContextDestroyed()
+{
+  // GL has released the buffer with the context
+  mFrameSize = 0;
+  mOffset = 0;
+  mAlignment = 0;
+  mBufferId = 0u;
+}
+
+void UniformBufferRing::Reserve( GLsizeiptr frameSize )
+{
+  if( mBufferId == 0u )
+  {
+    mContext.GetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &mAlignment );
+    if( mAlignment <= 0 )
+    {
+      mAlignment = DEFAULT_ALIGNMENT;
+    }
+
+    mContext.GenBuffers( 1, &mBufferId );
+  }
+
+  // Keep the start of every frame's part aligned
+  mFrameSize = ( ( frameSize + mAlignment - 1 ) / mAlignment ) * mAlignment;
+  mOffset = 0;
+
+  mContext.BindUniformBuffer( mBufferId );
+  mContext.BufferData( GL_UNIFORM_BUFFER, mFrameSize * FRAME_COUNT, nullptr, GL_DYNAMIC_DRAW );
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,104 @@
+#ifndef DALI_INTERNAL_UNIFORM_BUFFER_RING_H
+#define DALI_INTERNAL_UNIFORM_BUFFER_RING_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/gl-abstraction.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+class Context;
+
+/**
+ * A uniform buffer that is allocated once and written as a ring, one part per frame.
+ *
+ * The uniform block values of every draw call are appended to the part of the current frame,
+ * so a region is never overwritten while the GPU may still be reading it for one of the
+ * previous frames. The buffer grows (and is orphaned) when a frame needs more space.
+ */
+class UniformBufferRing
+{
+public:
+
+  /**
+   * The number of frames that use separate parts of the buffer
+   */
+  static constexpr uint32_t FRAME_COUNT = 3u;
+
+  /**
+   * Constructor
+   * @param[in] context The context that owns the ring
+   */
+  explicit UniformBufferRing( Context& context );
+
+  /**
+   * Destructor, deletes the GL buffer
+   */
+  ~UniformBufferRing();
+
+  /**
+   * Moves to the part of the buffer used by the next frame
+   */
+  void NextFrame();
+
+  /**
+   * Copies a block of uniform values to the current frame's part of the buffer and binds it
+   * to a uniform block binding point.
+   * @param[in] binding The uniform block binding point
+   * @param[in] data The uniform values, laid out as the program reported
+   * @param[in] size The size of the data in bytes
+   */
+  void WriteAndBind( GLuint binding, const void* data, GLsizeiptr size );
+
+  /**
+   * Needs to be called when the GL context is destroyed
+   */
+  void GlContextDestroyed();
+
+private:
+
+  /**
+   * Allocates the GL buffer with room for the given size per frame
+   * @param[in] frameSize The size of each frame's part of the buffer
+   */
+  void Reserve( GLsizeiptr frameSize );
+
+  // Undefined
+  UniformBufferRing( const UniformBufferRing& );
+  UniformBufferRing& operator=( const UniformBufferRing& );
+
+private:
+
+  Context&   mContext;    ///< The context used for GL calls
+  GLsizeiptr mFrameSize;  ///< The size of each frame's part of the buffer
+  GLintptr   mOffset;     ///< The next free offset in the current frame's part
+  GLint      mAlignment;  ///< The required alignment of the bound offsets
+  GLuint     mBufferId;   ///< The GL buffer, 0 if it has not been created yet
+  uint32_t   mFrame;      ///< The index of the current frame's part
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_UNIFORM_BUFFER_RING_H
@@ -40,7 +40,8 @@ namespace SceneGraph
 
 RenderQueue::RenderQueue()
 : container0( nullptr ),
-  container1( nullptr )
+  container1( nullptr ),
+  processedSize( 0u )
 {
   container0 = new MessageBuffer( INITIAL_BUFFER_SIZE );
   container1 = new MessageBuffer( INITIAL_BUFFER_SIZE );
@@ -86,6 +87,8 @@ void RenderQueue::ProcessMessages( BufferIndex bufferIndex )
 {
   MessageBuffer* container = GetCurrentContainer( bufferIndex );
 
+  processedSize = container->GetSize();
+
   for( MessageBuffer::Iterator iter = container->Begin(); iter.IsValid(); iter.Next() )
   {
     MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
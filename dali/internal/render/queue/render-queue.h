@@ -67,6 +67,15 @@ public:
    */
   void ProcessMessages( BufferIndex bufferIndex );
 
+  /**
+   * Query the size of the messages processed by the last call to ProcessMessages().
+   * @return The size with respect to the size of type "char".
+   */
+  std::size_t GetProcessedSize() const
+  {
+    return processedSize;
+  }
+
 private:
 
   /**
@@ -93,6 +102,7 @@ private:
 
   MessageBuffer* container0; ///< Messages are queued here when the update buffer index == 0
   MessageBuffer* container1; ///< Messages are queued here when the update buffer index == 1
+  std::size_t processedSize; ///< The size of the messages processed by the last ProcessMessages()
 };
 
 } // namespace SceneGraph
@@ -17,6 +17,9 @@
 // CLASS HEADER
 #include <dali/internal/render/renderers/render-geometry.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/render/gl-resources/context.h>
@@ -35,13 +38,34 @@ Geometry::Geometry()
 : mIndices(),
   mIndexBuffer(nullptr),
   mGeometryType( Dali::Geometry::TRIANGLES ),
+  mVertexArrays(),
+  mVertexArrayVersion(0u),
+  mFormatVersion(0u),
   mIndicesChanged(false),
   mHasBeenUpdated(false),
   mAttributesChanged(true)
 {
 }
 
-Geometry::~Geometry() = default;
+Geometry::~Geometry()
+{
+}
+
+void Geometry::Destroy( Context& currentContext )
+{
+  for( auto&& vertexArray : mVertexArrays )
+  {
+    if( vertexArray.context == &currentContext )
+    {
+      currentContext.DeleteVertexArrays( 1, &vertexArray.id );
+    }
+    else
+    {
+      vertexArray.context->QueueVertexArrayDeletion( vertexArray.id );
+    }
+  }
+  mVertexArrays.clear();
+}
 
 void Geometry::GlContextCreated( Context& context )
 {
@@ -49,18 +73,29 @@ void Geometry::GlContextCreated( Context& context )
 
 void Geometry::GlContextDestroyed()
 {
+  // GL has released the vertex array objects with the context
+  mVertexArrays.clear();
+}
+
+void Geometry::GlContextDestroyed( const Context& context )
+{
+  mVertexArrays.erase( std::remove_if( mVertexArrays.begin(), mVertexArrays.end(),
+                                       [&context]( const VertexArray& vertexArray ) { return vertexArray.context == &context; } ),
+                       mVertexArrays.end() );
 }
 
 void Geometry::AddVertexBuffer( Render::VertexBuffer* vertexBuffer )
 {
   mVertexBuffers.PushBack( vertexBuffer );
   mAttributesChanged = true;
+  ++mVertexArrayVersion;
 }
 
 void Geometry::SetIndexBuffer( Dali::Vector<uint16_t>& indices )
 {
   mIndices.Swap( indices );
   mIndicesChanged = true;
+  ++mVertexArrayVersion;
 }
 
 void Geometry::RemoveVertexBuffer( const Render::VertexBuffer* vertexBuffer )
@@ -73,6 +108,7 @@ void Geometry::RemoveVertexBuffer( const Render::VertexBuffer* vertexBuffer )
       //This will delete the gpu buffer associated to the RenderVertexBuffer if there is one
       mVertexBuffers.Remove( iter );
       mAttributesChanged = true;
+      ++mVertexArrayVersion;
       break;
     }
   }
@@ -132,6 +168,18 @@ void Geometry::Upload( Context& context )
       mIndicesChanged = false;
     }
 
+    // Vertex array objects hold the attribute formats, so they are rebuilt when any format changes
+    uint32_t formatVersion = 0u;
+    for( auto&& buffer : mVertexBuffers )
+    {
+      formatVersion += buffer->GetFormatVersion();
+    }
+    if( formatVersion != mFormatVersion )
+    {
+      mFormatVersion = formatVersion;
+      ++mVertexArrayVersion;
+    }
+
     for( auto&& buffer : mVertexBuffers )
     {
       if( !buffer->Update( context ) )
@@ -150,17 +198,23 @@ void Geometry::Draw(
     BufferIndex bufferIndex,
     Vector<GLint>& attributeLocation,
     uint32_t elementBufferOffset,
-    uint32_t elementBufferCount )
+    uint32_t elementBufferCount,
+    uint32_t instanceCount )
 {
-  //Bind buffers to attribute locations
-  uint32_t base = 0u;
-  const uint32_t vertexBufferCount = static_cast<uint32_t>( mVertexBuffers.Count() );
-  for( uint32_t i = 0; i < vertexBufferCount; ++i )
+  // Vertex array objects need OpenGL ES 3.0 and buffers which have all been uploaded. Instanced draw calls
+  // set up their per-instance attributes on the default vertex array, so they keep binding the buffers too
+  const bool useVertexArray = mHasBeenUpdated && ( instanceCount == 0u ) && ( context.CachedGlesMajorVersion() >= 3 );
+  if( useVertexArray )
+  {
+    BindVertexArray( context, attributeLocation );
+  }
+  else
   {
-    mVertexBuffers[i]->BindBuffer( context, GpuBuffer::ARRAY_BUFFER );
-    base += mVertexBuffers[i]->EnableVertexAttributes( context, attributeLocation, base );
+    EnableVertexAttributes( context, attributeLocation );
   }
 
+  const uint32_t vertexBufferCount = static_cast<uint32_t>( mVertexBuffers.Count() );
+
   uint32_t numIndices(0u);
   intptr_t firstIndexOffset(0u);
   if( mIndexBuffer )
@@ -223,10 +277,20 @@ void Geometry::Draw(
   //Draw call
   if( mIndexBuffer && geometryGLType != GL_POINTS )
   {
-    //Indexed draw call
-    mIndexBuffer->Bind( context, GpuBuffer::ELEMENT_ARRAY_BUFFER );
+    //Indexed draw call, the index buffer binding is part of the vertex array
+    if( !useVertexArray )
+    {
+      mIndexBuffer->Bind( context, GpuBuffer::ELEMENT_ARRAY_BUFFER );
+    }
     // numIndices truncated, no value loss happening in practice
-    context.DrawElements( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ) );
+    if( instanceCount > 0u )
+    {
+      context.DrawElementsInstanced( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ), static_cast<GLsizei>( instanceCount ) );
+    }
+    else
+    {
+      context.DrawElements( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ) );
+    }
   }
   else
   {
@@ -238,17 +302,94 @@ void Geometry::Draw(
       numVertices = static_cast<GLsizei>( mVertexBuffers[0]->GetElementCount() );
     }
 
-    context.DrawArrays( geometryGLType, 0, numVertices );
+    if( instanceCount > 0u )
+    {
+      context.DrawArraysInstanced( geometryGLType, 0, numVertices, static_cast<GLsizei>( instanceCount ) );
+    }
+    else
+    {
+      context.DrawArrays( geometryGLType, 0, numVertices );
+    }
+  }
+
+  if( useVertexArray )
+  {
+    // Leave the default vertex array bound for buffer uploads and draw calls not using vertex array objects
+    context.BindVertexArray( 0 );
   }
+  else
+  {
+    //Disable attributes
+    for( auto&& attribute : attributeLocation )
+    {
+      if( attribute != -1 )
+      {
+        context.DisableVertexAttributeArray( static_cast<GLuint>( attribute ) );
+      }
+    }
+  }
+}
 
-  //Disable attributes
-  for( auto&& attribute : attributeLocation )
+void Geometry::EnableVertexAttributes( Context& context, Vector<GLint>& attributeLocation )
+{
+  //Bind buffers to attribute locations
+  uint32_t base = 0u;
+  for( auto&& vertexBuffer : mVertexBuffers )
+  {
+    vertexBuffer->BindBuffer( context, GpuBuffer::ARRAY_BUFFER );
+    base += vertexBuffer->EnableVertexAttributes( context, attributeLocation, base );
+  }
+}
+
+void Geometry::BindVertexArray( Context& context, Vector<GLint>& attributeLocation )
+{
+  bool hasOutdatedVertexArrays = false;
+  for( auto&& vertexArray : mVertexArrays )
   {
-    if( attribute != -1 )
+    if( vertexArray.context == &context )
     {
-      context.DisableVertexAttributeArray( static_cast<GLuint>( attribute ) );
+      if( vertexArray.version != mVertexArrayVersion )
+      {
+        hasOutdatedVertexArrays = true;
+      }
+      else if( vertexArray.attributeLocation.Count() == attributeLocation.Count() &&
+               std::equal( attributeLocation.Begin(), attributeLocation.End(), vertexArray.attributeLocation.Begin() ) )
+      {
+        context.BindVertexArray( vertexArray.id );
+        return;
+      }
+    }
+  }
+
+  if( hasOutdatedVertexArrays )
+  {
+    // Vertex array objects are not shared between contexts, so only the ones of the current context can be deleted here
+    auto iter = mVertexArrays.begin();
+    while( iter != mVertexArrays.end() )
+    {
+      if( iter->context == &context && iter->version != mVertexArrayVersion )
+      {
+        context.DeleteVertexArrays( 1, &iter->id );
+        iter = mVertexArrays.erase( iter );
+      }
+      else
+      {
+        ++iter;
+      }
     }
   }
+
+  VertexArray vertexArray{ &context, attributeLocation, mVertexArrayVersion, 0u };
+  context.GenVertexArrays( 1, &vertexArray.id );
+  context.BindVertexArray( vertexArray.id );
+
+  EnableVertexAttributes( context, attributeLocation );
+  if( mIndexBuffer )
+  {
+    mIndexBuffer->Bind( context, GpuBuffer::ELEMENT_ARRAY_BUFFER );
+  }
+
+  mVertexArrays.push_back( vertexArray );
 }
 
 } // namespace SceneGraph
@@ -17,6 +17,9 @@
  * limitations under the License.
  */
 
+// EXTERNAL INCLUDES
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/rendering/geometry.h>
@@ -56,6 +59,13 @@ public:
    */
   ~Geometry();
 
+  /**
+   * Deletes the vertex array objects. Those of other contexts are queued on their context,
+   * as a vertex array object can only be deleted while its context is current.
+   * @param[in] currentContext The GL context which is current
+   */
+  void Destroy( Context& currentContext );
+
   /**
    * Called on Gl Context created
    */
@@ -66,6 +76,12 @@ public:
    */
   void GlContextDestroyed();
 
+  /**
+   * Called when a scene context is destroyed, forgets the vertex array objects created in it
+   * @param[in] context The context being destroyed
+   */
+  void GlContextDestroyed( const Context& context );
+
   /**
    * Adds a property buffer to the geometry
    * @param[in] dataProvider The VertexBuffer data provider
@@ -128,15 +144,40 @@ public:
    * @param[in] attributeLocation The location for the attributes in the shader
    * @param[in] elementBufferOffset The index of first element to draw if index buffer bound
    * @param[in] elementBufferCount Number of elements to draw if index buffer bound, uses whole buffer when 0
+   * @param[in] instanceCount Number of instances to draw with an instanced draw call, or 0 for a normal draw call
    */
   void Draw(Context& context,
             BufferIndex bufferIndex,
             Vector<GLint>& attributeLocation,
             uint32_t elementBufferOffset,
-            uint32_t elementBufferCount );
+            uint32_t elementBufferCount,
+            uint32_t instanceCount = 0u );
 
 private:
 
+  /**
+   * Bind the vertex buffers to the attribute locations and enable the attributes
+   * @param[in] context The GL context
+   * @param[in] attributeLocation The location for the attributes in the shader
+   */
+  void EnableVertexAttributes( Context& context, Vector<GLint>& attributeLocation );
+
+  /**
+   * Bind the vertex array object holding the vertex and index buffer bindings for the attribute
+   * layout of a program, building it first if there is none for the current buffers yet
+   * @param[in] context The GL context
+   * @param[in] attributeLocation The location for the attributes in the shader
+   */
+  void BindVertexArray( Context& context, Vector<GLint>& attributeLocation );
+
+  struct VertexArray
+  {
+    Context*      context;           ///< The context the vertex array object was created in, they are not shared
+    Vector<GLint> attributeLocation; ///< The attribute layout of the program it was built for
+    uint32_t      version;           ///< The value of mVertexArrayVersion when it was built
+    GLuint        id;                ///< The vertex array object
+  };
+
   // VertexBuffers
   Vector< Render::VertexBuffer* > mVertexBuffers;
 
@@ -144,6 +185,10 @@ private:
   OwnerPointer< GpuBuffer > mIndexBuffer;
   Type mGeometryType;
 
+  std::vector< VertexArray > mVertexArrays; ///< Vertex array objects per context and attribute layout
+  uint32_t mVertexArrayVersion;             ///< Incremented whenever the vertex buffers, their formats or the indices change
+  uint32_t mFormatVersion;                  ///< The sum of the format versions of the vertex buffers
+
   // Booleans
   bool mIndicesChanged : 1;
   bool mHasBeenUpdated : 1;
@@ -18,7 +18,12 @@
 // CLASS HEADER
 #include <dali/internal/render/renderers/render-renderer.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+
 // INTERNAL INCLUDES
+#include <dali/public-api/math/math-utils.h>
 #include <dali/internal/common/image-sampler.h>
 #include <dali/internal/render/gl-resources/context.h>
 #include <dali/internal/render/renderers/render-sampler.h>
@@ -27,6 +32,8 @@
 #include <dali/internal/render/data-providers/node-data-provider.h>
 #include <dali/internal/render/data-providers/uniform-map-data-provider.h>
 #include <dali/internal/render/common/render-instruction.h>
+#include <dali/internal/render/common/render-list.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
 
 namespace Dali
 {
@@ -37,6 +44,19 @@ namespace Internal
 namespace
 {
 
+/**
+ * Helper to read a value packed by SceneGraph::Renderer for ApplyStateChanges()
+ * @param[in,out] values The packed values, moved past the value read
+ * @return The value
+ */
+template< typename T >
+inline T ReadStateValue( const uint8_t*& values )
+{
+  T value;
+  memcpy( static_cast<void*>( &value ), values, sizeof( T ) );
+  values += sizeof( T );
+  return value;
+}
 
 /**
  * Helper to set view and projection matrices once per program
@@ -102,6 +122,210 @@ inline void SetMatrices( Program& program,
   }
 }
 
+/**
+ * Helper to write a matrix to a uniform block
+ * @param[out] destination The location of the matrix in the block
+ * @param[in] matrix The column-major matrix
+ * @param[in] columns The number of columns and rows of the matrix
+ * @param[in] matrixStride The stride between the columns in the block, in bytes
+ */
+void WriteMatrixToBlock( uint8_t* destination, const float* matrix, uint32_t columns, GLint matrixStride )
+{
+  const uint32_t columnSize = columns * static_cast<uint32_t>( sizeof( float ) );
+  const uint32_t stride = matrixStride > 0 ? static_cast<uint32_t>( matrixStride ) : columnSize;
+  for( uint32_t column = 0u; column < columns; ++column )
+  {
+    memcpy( destination + column * stride, matrix + column * columns, columnSize );
+  }
+}
+
+/**
+ * Helper to write a property mapped to a uniform to a uniform block
+ * @param[out] destination The location of the uniform in the block
+ * @param[in] matrixStride The stride between the columns of a matrix in the block, in bytes
+ * @param[in] bufferIndex The index of the previous update buffer
+ * @param[in] property The property
+ */
+void WritePropertyToBlock( uint8_t* destination, GLint matrixStride, BufferIndex bufferIndex, const PropertyInputImpl& property )
+{
+  switch( property.GetType() )
+  {
+    case Property::INTEGER:
+    {
+      const int32_t value = property.GetInteger( bufferIndex );
+      memcpy( destination, &value, sizeof( value ) );
+      break;
+    }
+    case Property::FLOAT:
+    {
+      const float value = property.GetFloat( bufferIndex );
+      memcpy( destination, &value, sizeof( value ) );
+      break;
+    }
+    case Property::VECTOR2:
+    {
+      memcpy( destination, property.GetVector2( bufferIndex ).AsFloat(), 2u * sizeof( float ) );
+      break;
+    }
+    case Property::VECTOR3:
+    {
+      memcpy( destination, property.GetVector3( bufferIndex ).AsFloat(), 3u * sizeof( float ) );
+      break;
+    }
+    case Property::VECTOR4:
+    {
+      memcpy( destination, property.GetVector4( bufferIndex ).AsFloat(), 4u * sizeof( float ) );
+      break;
+    }
+    case Property::ROTATION:
+    {
+      memcpy( destination, property.GetQuaternion( bufferIndex ).mVector.AsFloat(), 4u * sizeof( float ) );
+      break;
+    }
+    case Property::MATRIX:
+    {
+      WriteMatrixToBlock( destination, property.GetMatrix( bufferIndex ).AsFloat(), 4u, matrixStride );
+      break;
+    }
+    case Property::MATRIX3:
+    {
+      WriteMatrixToBlock( destination, property.GetMatrix3( bufferIndex ).AsFloat(), 3u, matrixStride );
+      break;
+    }
+    default:
+    {
+      // Other property types are ignored
+      break;
+    }
+  }
+}
+
+/**
+ * Helper to check whether two properties mapped to uniforms have the same value
+ * @param[in] bufferIndex The index of the previous update buffer
+ * @param[in] lhs The first property
+ * @param[in] rhs The second property
+ * @return True if the properties have the same type and value
+ */
+bool HaveSameValue( BufferIndex bufferIndex, const PropertyInputImpl& lhs, const PropertyInputImpl& rhs )
+{
+  if( &lhs == &rhs )
+  {
+    return true;
+  }
+
+  if( lhs.GetType() != rhs.GetType() )
+  {
+    return false;
+  }
+
+  switch( lhs.GetType() )
+  {
+    case Property::BOOLEAN:
+    {
+      return lhs.GetBoolean( bufferIndex ) == rhs.GetBoolean( bufferIndex );
+    }
+    case Property::INTEGER:
+    {
+      return lhs.GetInteger( bufferIndex ) == rhs.GetInteger( bufferIndex );
+    }
+    case Property::FLOAT:
+    {
+      return Equals( lhs.GetFloat( bufferIndex ), rhs.GetFloat( bufferIndex ) );
+    }
+    case Property::VECTOR2:
+    {
+      return lhs.GetVector2( bufferIndex ) == rhs.GetVector2( bufferIndex );
+    }
+    case Property::VECTOR3:
+    {
+      return lhs.GetVector3( bufferIndex ) == rhs.GetVector3( bufferIndex );
+    }
+    case Property::VECTOR4:
+    {
+      return lhs.GetVector4( bufferIndex ) == rhs.GetVector4( bufferIndex );
+    }
+    case Property::ROTATION:
+    {
+      return lhs.GetQuaternion( bufferIndex ) == rhs.GetQuaternion( bufferIndex );
+    }
+    case Property::MATRIX:
+    {
+      return lhs.GetMatrix( bufferIndex ) == rhs.GetMatrix( bufferIndex );
+    }
+    case Property::MATRIX3:
+    {
+      return lhs.GetMatrix3( bufferIndex ) == rhs.GetMatrix3( bufferIndex );
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * Helper to check whether two collected uniform maps map the same names to the same values
+ * @param[in] bufferIndex The index of the previous update buffer
+ * @param[in] lhs The first map
+ * @param[in] rhs The second map
+ * @return True if the maps are the same
+ */
+bool HaveSameUniforms( BufferIndex bufferIndex, const SceneGraph::CollectedUniformMap& lhs, const SceneGraph::CollectedUniformMap& rhs )
+{
+  if( lhs.Count() != rhs.Count() )
+  {
+    return false;
+  }
+
+  for( uint32_t index = 0u; index < lhs.Count(); ++index )
+  {
+    if( lhs[index].uniformName != rhs[index].uniformName ||
+        !HaveSameValue( bufferIndex, *lhs[index].propertyPtr, *rhs[index].propertyPtr ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Gets the number of floats of a property which can be read by the shader as a per-instance attribute
+ * @param[in] type The type of the property
+ * @return The number of floats, or 0 if the property can only be set as a uniform
+ */
+uint32_t GetInstanceAttributeComponentCount( Property::Type type )
+{
+  switch( type )
+  {
+    case Property::FLOAT:
+    {
+      return 1u;
+    }
+    case Property::VECTOR2:
+    {
+      return 2u;
+    }
+    case Property::VECTOR3:
+    {
+      return 3u;
+    }
+    case Property::VECTOR4:
+    {
+      return 4u;
+    }
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+// The attributes which are not mapped from a node uniform
+const uint32_t INSTANCE_ATTRIBUTE_MODEL_VIEW = 0xffffffff;
+const uint32_t INSTANCE_ATTRIBUTE_COLOR      = 0xfffffffe;
+const uint32_t INSTANCE_ATTRIBUTE_SIZE       = 0xfffffffd;
+
 }
 
 namespace Render
@@ -178,6 +402,110 @@ void Renderer::SetDrawCommands( Dali::DevelRenderer::DrawCommand* pDrawCommands,
   mDrawCommands.insert( mDrawCommands.end(), pDrawCommands, pDrawCommands+size );
 }
 
+void Renderer::ApplyStateChanges( uint32_t changedFields, const uint8_t* values )
+{
+  if( changedFields & GEOMETRY )
+  {
+    SetGeometry( ReadStateValue< Render::Geometry* >( values ) );
+  }
+
+  if( changedFields & DRAW_COMMANDS )
+  {
+    Dali::DevelRenderer::DrawCommand* drawCommands = ReadStateValue< Dali::DevelRenderer::DrawCommand* >( values );
+    SetDrawCommands( drawCommands, ReadStateValue< uint32_t >( values ) );
+  }
+
+  if( changedFields & FACE_CULLING_MODE )
+  {
+    SetFaceCullingMode( static_cast< FaceCullingMode::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & BLEND_BIT_MASK )
+  {
+    SetBlendingBitMask( ReadStateValue< uint32_t >( values ) );
+  }
+
+  if( changedFields & BLEND_COLOR )
+  {
+    SetBlendColor( ReadStateValue< Vector4 >( values ) );
+  }
+
+  if( changedFields & PREMULTIPLIED_ALPHA )
+  {
+    EnablePreMultipliedAlpha( ReadStateValue< uint8_t >( values ) != 0u );
+  }
+
+  if( changedFields & INDEXED_DRAW_FIRST_ELEMENT )
+  {
+    SetIndexedDrawFirstElement( ReadStateValue< uint32_t >( values ) );
+  }
+
+  if( changedFields & INDEXED_DRAW_ELEMENTS_COUNT )
+  {
+    SetIndexedDrawElementsCount( ReadStateValue< uint32_t >( values ) );
+  }
+
+  if( changedFields & DEPTH_WRITE_MODE )
+  {
+    SetDepthWriteMode( static_cast< DepthWriteMode::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & DEPTH_TEST_MODE )
+  {
+    SetDepthTestMode( static_cast< DepthTestMode::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & DEPTH_FUNCTION )
+  {
+    SetDepthFunction( static_cast< DepthFunction::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & RENDER_MODE )
+  {
+    SetRenderMode( static_cast< RenderMode::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & STENCIL_FUNCTION )
+  {
+    SetStencilFunction( static_cast< StencilFunction::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & STENCIL_FUNCTION_MASK )
+  {
+    SetStencilFunctionMask( ReadStateValue< int32_t >( values ) );
+  }
+
+  if( changedFields & STENCIL_FUNCTION_REFERENCE )
+  {
+    SetStencilFunctionReference( ReadStateValue< int32_t >( values ) );
+  }
+
+  if( changedFields & STENCIL_MASK )
+  {
+    SetStencilMask( ReadStateValue< int32_t >( values ) );
+  }
+
+  if( changedFields & STENCIL_OPERATION_ON_FAIL )
+  {
+    SetStencilOperationOnFail( static_cast< StencilOperation::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & STENCIL_OPERATION_ON_Z_FAIL )
+  {
+    SetStencilOperationOnZFail( static_cast< StencilOperation::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & STENCIL_OPERATION_ON_Z_PASS )
+  {
+    SetStencilOperationOnZPass( static_cast< StencilOperation::Type >( ReadStateValue< uint8_t >( values ) ) );
+  }
+
+  if( changedFields & SHADER )
+  {
+    SetShaderChanged( true );
+  }
+}
+
 void Renderer::SetBlending( Context& context, bool blend )
 {
   context.SetBlend( blend );
@@ -221,9 +549,45 @@ void Renderer::SetBlending( Context& context, bool blend )
   mUpdated = true;
 }
 
+void Renderer::SetFaceCulling( Context& context, const Dali::Internal::SceneGraph::RenderInstruction& instruction )
+{
+  const Dali::Internal::SceneGraph::Camera* cam = instruction.GetCamera();
+  if (cam->GetReflectionUsed())
+  {
+    auto adjFaceCullingMode = mFaceCullingMode;
+    switch( mFaceCullingMode )
+    {
+      case FaceCullingMode::Type::FRONT:
+      {
+        adjFaceCullingMode = FaceCullingMode::Type::BACK;
+        break;
+      }
+      case FaceCullingMode::Type::BACK:
+      {
+        adjFaceCullingMode = FaceCullingMode::Type::FRONT;
+        break;
+      }
+      default:
+      {
+        // nothing to do, leave culling as it is
+      }
+    }
+    context.CullFace( adjFaceCullingMode );
+  }
+  else
+  {
+    context.CullFace( mFaceCullingMode );
+  }
+}
+
 void Renderer::GlContextDestroyed()
 {
   mGeometry->GlContextDestroyed();
+
+  if( mInstanceBuffer )
+  {
+    mInstanceBuffer->GlContextDestroyed();
+  }
 }
 
 void Renderer::GlCleanup()
@@ -369,6 +733,101 @@ void Renderer::SetUniformFromProperty( BufferIndex bufferIndex, Program& program
   }
 }
 
+void Renderer::WriteUniformBlocks( Context& context,
+                                   BufferIndex bufferIndex,
+                                   const SceneGraph::NodeDataProvider& node,
+                                   const Matrix& modelMatrix,
+                                   const Matrix& modelViewMatrix,
+                                   const Matrix& viewMatrix,
+                                   const Matrix& projectionMatrix,
+                                   const Vector3& size,
+                                   Program& program )
+{
+  for( const auto& block : program.GetUniformBlocks() )
+  {
+    // Members that are not mapped to anything are left as zero
+    mUniformBlockData.Resize( static_cast<uint32_t>( block.size ) );
+    memset( mUniformBlockData.Begin(), 0, mUniformBlockData.Size() );
+
+    for( const auto& member : block.members )
+    {
+      uint8_t* destination = mUniformBlockData.Begin() + member.offset;
+      switch( member.uniformIndex )
+      {
+        case Program::UNIFORM_MVP_MATRIX:
+        {
+          Matrix modelViewProjectionMatrix( false );
+          Matrix::Multiply( modelViewProjectionMatrix, modelViewMatrix, projectionMatrix );
+          WriteMatrixToBlock( destination, modelViewProjectionMatrix.AsFloat(), 4u, member.matrixStride );
+          break;
+        }
+        case Program::UNIFORM_MODELVIEW_MATRIX:
+        {
+          WriteMatrixToBlock( destination, modelViewMatrix.AsFloat(), 4u, member.matrixStride );
+          break;
+        }
+        case Program::UNIFORM_PROJECTION_MATRIX:
+        {
+          WriteMatrixToBlock( destination, projectionMatrix.AsFloat(), 4u, member.matrixStride );
+          break;
+        }
+        case Program::UNIFORM_MODEL_MATRIX:
+        {
+          WriteMatrixToBlock( destination, modelMatrix.AsFloat(), 4u, member.matrixStride );
+          break;
+        }
+        case Program::UNIFORM_VIEW_MATRIX:
+        {
+          WriteMatrixToBlock( destination, viewMatrix.AsFloat(), 4u, member.matrixStride );
+          break;
+        }
+        case Program::UNIFORM_NORMAL_MATRIX:
+        {
+          Matrix3 normalMatrix;
+          normalMatrix = modelViewMatrix;
+          normalMatrix.Invert();
+          normalMatrix.Transpose();
+          WriteMatrixToBlock( destination, normalMatrix.AsFloat(), 3u, member.matrixStride );
+          break;
+        }
+        case Program::UNIFORM_COLOR:
+        {
+          const Vector4& color = node.GetRenderColor( bufferIndex );
+          const float opacity = mRenderDataProvider->GetOpacity( bufferIndex );
+          Vector4 value( color.r, color.g, color.b, color.a * opacity );
+          if( mPremultipledAlphaEnabled )
+          {
+            value.r *= value.a;
+            value.g *= value.a;
+            value.b *= value.a;
+          }
+          memcpy( destination, value.AsFloat(), 4u * sizeof( float ) );
+          break;
+        }
+        case Program::UNIFORM_SIZE:
+        {
+          memcpy( destination, size.AsFloat(), 3u * sizeof( float ) );
+          break;
+        }
+        default:
+        {
+          for( const auto& map : mUniformIndexMap )
+          {
+            if( map.uniformIndex == member.uniformIndex )
+            {
+              WritePropertyToBlock( destination, member.matrixStride, bufferIndex, *map.propertyValue );
+              break;
+            }
+          }
+          break;
+        }
+      }
+    }
+
+    context.GetUniformBufferRing().WriteAndBind( block.binding, mUniformBlockData.Begin(), block.size );
+  }
+}
+
 bool Renderer::BindTextures( Context& context, Program& program, Vector<GLuint>& boundTextures )
 {
   uint32_t textureUnit = 0;
@@ -599,35 +1058,15 @@ void Renderer::Render( Context& context,
     return;
   }
 
-  //Set cull face  mode
-  const Dali::Internal::SceneGraph::Camera* cam = instruction.GetCamera();
-  if (cam->GetReflectionUsed())
+  if( program->IsCompileDeferred() )
   {
-    auto adjFaceCullingMode = mFaceCullingMode;
-    switch( mFaceCullingMode )
-    {
-      case FaceCullingMode::Type::FRONT:
-      {
-        adjFaceCullingMode = FaceCullingMode::Type::BACK;
-        break;
-      }
-      case FaceCullingMode::Type::BACK:
-      {
-        adjFaceCullingMode = FaceCullingMode::Type::FRONT;
-        break;
-      }
-      default:
-      {
-        // nothing to do, leave culling as it is
-      }
-    }
-    context.CullFace( adjFaceCullingMode );
-  }
-  else
-  {
-    context.CullFace( mFaceCullingMode );
+    // Not drawn until the program has been compiled, rather than stalling the frame to compile it now
+    return;
   }
 
+  //Set cull face  mode
+  SetFaceCulling( context, instruction );
+
   // Take the program into use so we can send uniforms to it
   program->Use();
 
@@ -655,6 +1094,7 @@ void Renderer::Render( Context& context,
     }
 
     SetUniforms( bufferIndex, node, size, *program );
+    WriteUniformBlocks( context, bufferIndex, node, modelMatrix, modelViewMatrix, viewMatrix, projectionMatrix, size, *program );
 
     if( mUpdateAttributesLocation || mGeometry->AttributesChanged() )
     {
@@ -694,6 +1134,316 @@ void Renderer::Render( Context& context,
   }
 }
 
+bool Renderer::IsInstanced() const
+{
+  return mDrawCommands.empty() && mRenderDataProvider->GetShader().HintEnabled( Dali::Shader::Hint::INSTANCED );
+}
+
+bool Renderer::IsInstanceCompatible( BufferIndex bufferIndex,
+                                     const SceneGraph::NodeDataProvider& node,
+                                     Renderer& other,
+                                     const SceneGraph::NodeDataProvider& otherNode )
+{
+  Program* program = mRenderDataProvider->GetShader().GetProgram();
+  if( !program ||
+      program != other.mRenderDataProvider->GetShader().GetProgram() ||
+      !other.IsInstanced() ||
+      mGeometry != other.mGeometry ||
+      mRenderDataProvider->GetTextures() != other.mRenderDataProvider->GetTextures() ||
+      mRenderDataProvider->GetSamplers() != other.mRenderDataProvider->GetSamplers() )
+  {
+    return false;
+  }
+
+  // The render state must be the same, as it is only set up for the first renderer
+  const Vector4* blendColor = mBlendingOptions.GetBlendColor();
+  const Vector4* otherBlendColor = other.mBlendingOptions.GetBlendColor();
+  if( mBlendingOptions.GetBitmask() != other.mBlendingOptions.GetBitmask() ||
+      ( blendColor == nullptr ) != ( otherBlendColor == nullptr ) ||
+      ( blendColor && *blendColor != *otherBlendColor ) ||
+      mPremultipledAlphaEnabled != other.mPremultipledAlphaEnabled ||
+      mFaceCullingMode != other.mFaceCullingMode ||
+      mDepthWriteMode != other.mDepthWriteMode ||
+      mDepthTestMode != other.mDepthTestMode ||
+      mDepthFunction != other.mDepthFunction ||
+      mIndexedDrawFirstElement != other.mIndexedDrawFirstElement ||
+      mIndexedDrawElementsCount != other.mIndexedDrawElementsCount ||
+      mStencilParameters.renderMode != other.mStencilParameters.renderMode ||
+      mStencilParameters.stencilFunction != other.mStencilParameters.stencilFunction ||
+      mStencilParameters.stencilFunctionMask != other.mStencilParameters.stencilFunctionMask ||
+      mStencilParameters.stencilFunctionReference != other.mStencilParameters.stencilFunctionReference ||
+      mStencilParameters.stencilMask != other.mStencilParameters.stencilMask ||
+      mStencilParameters.stencilOperationOnFail != other.mStencilParameters.stencilOperationOnFail ||
+      mStencilParameters.stencilOperationOnZFail != other.mStencilParameters.stencilOperationOnZFail ||
+      mStencilParameters.stencilOperationOnZPass != other.mStencilParameters.stencilOperationOnZPass )
+  {
+    return false;
+  }
+
+  // The uniforms are only set for the first renderer
+  if( !HaveSameUniforms( bufferIndex, mRenderDataProvider->GetUniformMap().GetUniformMap( bufferIndex ),
+                         other.mRenderDataProvider->GetUniformMap().GetUniformMap( bufferIndex ) ) )
+  {
+    return false;
+  }
+
+  // Node uniforms may differ if the shader reads them from per-instance attributes of the same name
+  const SceneGraph::CollectedUniformMap& uniformMapNode = node.GetUniformMap( bufferIndex );
+  const SceneGraph::CollectedUniformMap& otherUniformMapNode = otherNode.GetUniformMap( bufferIndex );
+  if( uniformMapNode.Count() != otherUniformMapNode.Count() )
+  {
+    return false;
+  }
+
+  for( uint32_t index = 0u; index < uniformMapNode.Count(); ++index )
+  {
+    const SceneGraph::UniformPropertyMapping& mapping = uniformMapNode[index];
+    const SceneGraph::UniformPropertyMapping& otherMapping = otherUniformMapNode[index];
+    if( mapping.uniformName != otherMapping.uniformName ||
+        mapping.propertyPtr->GetType() != otherMapping.propertyPtr->GetType() )
+    {
+      return false;
+    }
+
+    const bool isAttribute = GetInstanceAttributeComponentCount( mapping.propertyPtr->GetType() ) > 0u &&
+                             program->GetInstanceAttributeLocation( mapping.uniformName ) != Program::ATTRIB_UNKNOWN;
+    if( !isAttribute && !HaveSameValue( bufferIndex, *mapping.propertyPtr, *otherMapping.propertyPtr ) )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Renderer::RenderInstances( Context& context,
+                                BufferIndex bufferIndex,
+                                const SceneGraph::RenderList& renderList,
+                                uint32_t first,
+                                uint32_t count,
+                                const Matrix& viewMatrix,
+                                const Matrix& projectionMatrix,
+                                bool blend,
+                                Vector<GLuint>& boundTextures,
+                                const Dali::Internal::SceneGraph::RenderInstruction& instruction )
+{
+  // Get the program to use:
+  Program* program = mRenderDataProvider->GetShader().GetProgram();
+  if( !program )
+  {
+    DALI_LOG_ERROR( "Failed to get program for shader at address %p.\n", reinterpret_cast< void* >( &mRenderDataProvider->GetShader() ) );
+    return;
+  }
+
+  if( program->IsCompileDeferred() )
+  {
+    // Not drawn until the program has been compiled, rather than stalling the frame to compile it now
+    return;
+  }
+
+  SetFaceCulling( context, instruction );
+
+  // Take the program into use so we can send uniforms to it
+  program->Use();
+
+  if( DALI_UNLIKELY( !BindTextures( context, *program, boundTextures ) ) )
+  {
+    return;
+  }
+
+  // The uniforms are the same for every instance, so they are set from the first item
+  const SceneGraph::RenderItem& firstItem = renderList.GetItem( first );
+  SetMatrices( *program, firstItem.mModelMatrix, viewMatrix, projectionMatrix, firstItem.mModelViewMatrix );
+  SetUniforms( bufferIndex, *firstItem.mNode, firstItem.mSize, *program );
+  WriteUniformBlocks( context, bufferIndex, *firstItem.mNode, firstItem.mModelMatrix, firstItem.mModelViewMatrix, viewMatrix, projectionMatrix, firstItem.mSize, *program );
+
+  if( mUpdateAttributesLocation || mGeometry->AttributesChanged() )
+  {
+    mGeometry->GetAttributeLocationFromProgram( mAttributesLocation, *program, bufferIndex );
+    mUpdateAttributesLocation = false;
+  }
+
+  // Find the per-instance attributes read by the shader
+  mInstanceAttributes.Clear();
+  uint32_t componentCount = 0u;
+  const std::pair< Program::AttribType, uint32_t > standardAttributes[] =
+  {
+    { Program::ATTRIB_INSTANCE_MODEL_VIEW, INSTANCE_ATTRIBUTE_MODEL_VIEW },
+    { Program::ATTRIB_INSTANCE_COLOR,      INSTANCE_ATTRIBUTE_COLOR },
+    { Program::ATTRIB_INSTANCE_SIZE,       INSTANCE_ATTRIBUTE_SIZE }
+  };
+  const uint32_t standardComponentCounts[] = { 16u, 4u, 3u };
+  for( uint32_t index = 0u; index < 3u; ++index )
+  {
+    const GLint location = program->GetAttribLocation( standardAttributes[index].first );
+    if( location != Program::ATTRIB_UNKNOWN )
+    {
+      mInstanceAttributes.PushBack( { location, standardComponentCounts[index], standardAttributes[index].second } );
+      componentCount += standardComponentCounts[index];
+    }
+  }
+
+  const SceneGraph::NodeDataProvider& firstNode = *firstItem.mNode;
+  const SceneGraph::CollectedUniformMap& uniformMapNode = firstNode.GetUniformMap( bufferIndex );
+  for( uint32_t index = 0u; index < uniformMapNode.Count(); ++index )
+  {
+    const uint32_t attributeComponentCount = GetInstanceAttributeComponentCount( uniformMapNode[index].propertyPtr->GetType() );
+    if( attributeComponentCount > 0u )
+    {
+      const GLint location = program->GetInstanceAttributeLocation( uniformMapNode[index].uniformName );
+      if( location != Program::ATTRIB_UNKNOWN )
+      {
+        mInstanceAttributes.PushBack( { location, attributeComponentCount, index } );
+        componentCount += attributeComponentCount;
+      }
+    }
+  }
+
+  // Pack the attributes of every instance
+  mInstanceData.Resize( count * componentCount );
+  float* data = mInstanceData.Begin();
+  for( uint32_t instance = 0u; instance < count; ++instance )
+  {
+    const SceneGraph::RenderItem& item = renderList.GetItem( first + instance );
+    const SceneGraph::NodeDataProvider& node = *item.mNode;
+    for( const auto& attribute : mInstanceAttributes )
+    {
+      switch( attribute.nodeUniformIndex )
+      {
+        case INSTANCE_ATTRIBUTE_MODEL_VIEW:
+        {
+          memcpy( data, item.mModelViewMatrix.AsFloat(), 16u * sizeof( float ) );
+          break;
+        }
+        case INSTANCE_ATTRIBUTE_COLOR:
+        {
+          const Vector4& color = node.GetRenderColor( bufferIndex );
+          const float opacity = item.mRenderer->mRenderDataProvider->GetOpacity( bufferIndex );
+          if( mPremultipledAlphaEnabled )
+          {
+            const float alpha = color.a * opacity;
+            data[0] = color.r * alpha;
+            data[1] = color.g * alpha;
+            data[2] = color.b * alpha;
+            data[3] = alpha;
+          }
+          else
+          {
+            data[0] = color.r;
+            data[1] = color.g;
+            data[2] = color.b;
+            data[3] = color.a * opacity;
+          }
+          break;
+        }
+        case INSTANCE_ATTRIBUTE_SIZE:
+        {
+          memcpy( data, item.mSize.AsFloat(), 3u * sizeof( float ) );
+          break;
+        }
+        default:
+        {
+          const PropertyInputImpl& property = *node.GetUniformMap( bufferIndex )[attribute.nodeUniformIndex].propertyPtr;
+          switch( attribute.componentCount )
+          {
+            case 1u:
+            {
+              data[0] = property.GetFloat( bufferIndex );
+              break;
+            }
+            case 2u:
+            {
+              memcpy( data, property.GetVector2( bufferIndex ).AsFloat(), 2u * sizeof( float ) );
+              break;
+            }
+            case 3u:
+            {
+              memcpy( data, property.GetVector3( bufferIndex ).AsFloat(), 3u * sizeof( float ) );
+              break;
+            }
+            default:
+            {
+              memcpy( data, property.GetVector4( bufferIndex ).AsFloat(), 4u * sizeof( float ) );
+              break;
+            }
+          }
+          break;
+        }
+      }
+      data += attribute.componentCount;
+    }
+  }
+
+  if( mBlendingOptions.IsAdvancedBlendEquationApplied() && mPremultipledAlphaEnabled )
+  {
+    context.BlendBarrier();
+  }
+
+  SetBlending( context, blend );
+
+  if( context.CachedGlesMajorVersion() >= 3 && componentCount > 0u )
+  {
+    if( !mInstanceBuffer )
+    {
+      mInstanceBuffer = new GpuBuffer( context );
+    }
+    mInstanceBuffer->UpdateDataBuffer( context, static_cast<GLsizeiptr>( mInstanceData.Size() * sizeof( float ) ), mInstanceData.Begin(), GpuBuffer::STREAM_DRAW, GpuBuffer::ARRAY_BUFFER );
+
+    // Matrices take one attribute location per column
+    const GLsizei stride = static_cast<GLsizei>( componentCount * sizeof( float ) );
+    uintptr_t offset = 0u;
+    for( const auto& attribute : mInstanceAttributes )
+    {
+      for( uint32_t column = 0u; column * 4u < attribute.componentCount; ++column )
+      {
+        const GLuint location = static_cast<GLuint>( attribute.location ) + column;
+        const GLint size = static_cast<GLint>( std::min( attribute.componentCount - column * 4u, 4u ) );
+        context.VertexAttribPointer( location, size, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>( offset ) );
+        context.EnableVertexAttributeArray( location );
+        context.VertexAttribDivisor( location, 1u );
+        offset += static_cast<uintptr_t>( size ) * sizeof( float );
+      }
+    }
+
+    mGeometry->Draw( context, bufferIndex, mAttributesLocation, mIndexedDrawFirstElement, mIndexedDrawElementsCount, count );
+
+    for( const auto& attribute : mInstanceAttributes )
+    {
+      for( uint32_t column = 0u; column * 4u < attribute.componentCount; ++column )
+      {
+        const GLuint location = static_cast<GLuint>( attribute.location ) + column;
+        context.VertexAttribDivisor( location, 0u );
+        context.DisableVertexAttributeArray( location );
+      }
+    }
+  }
+  else
+  {
+    // Instancing is not supported by OpenGL ES 2.0, so draw the instances one by one with constant attribute values
+    data = mInstanceData.Begin();
+    for( uint32_t instance = 0u; instance < count; ++instance )
+    {
+      for( const auto& attribute : mInstanceAttributes )
+      {
+        for( uint32_t column = 0u; column * 4u < attribute.componentCount; ++column )
+        {
+          float value[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+          memcpy( value, data, std::min( attribute.componentCount - column * 4u, 4u ) * sizeof( float ) );
+          context.VertexAttrib4fv( static_cast<GLuint>( attribute.location ) + column, value );
+          data += std::min( attribute.componentCount - column * 4u, 4u );
+        }
+      }
+
+      mGeometry->Draw( context, bufferIndex, mAttributesLocation, mIndexedDrawFirstElement, mIndexedDrawElementsCount );
+    }
+  }
+
+  for( uint32_t instance = 0u; instance < count; ++instance )
+  {
+    renderList.GetItem( first + instance ).mRenderer->mUpdated = false;
+  }
+}
+
 void Renderer::SetSortAttributes( BufferIndex bufferIndex,
                                   SceneGraph::RenderInstructionProcessor::SortAttributes& sortAttributes ) const
 {
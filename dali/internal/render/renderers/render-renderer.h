@@ -40,6 +40,7 @@ namespace Internal
 class Context;
 class Texture;
 class Program;
+class GpuBuffer;
 
 namespace SceneGraph
 {
@@ -48,6 +49,7 @@ class Shader;
 class NodeDataProvider;
 
 class RenderInstruction; //for relfection effect
+class RenderList;
 }
 
 namespace Render
@@ -91,6 +93,36 @@ public:
     StencilOperation::Type stencilOperationOnZPass:4; ///< The stencil operation for depth test pass
   };
 
+  /**
+   * @brief The parts of the state which can be changed together with ApplyStateChanges().
+   *
+   * The changes are applied in the order of these values. The type of the value packed for each
+   * part is given in brackets; enumerations are packed as a uint8_t.
+   */
+  enum StateField : uint32_t
+  {
+    GEOMETRY                     = 1u << 0,  ///< (Render::Geometry*)
+    DRAW_COMMANDS                = 1u << 1,  ///< (Dali::DevelRenderer::DrawCommand*, uint32_t count)
+    FACE_CULLING_MODE            = 1u << 2,  ///< (FaceCullingMode::Type)
+    BLEND_BIT_MASK               = 1u << 3,  ///< (uint32_t)
+    BLEND_COLOR                  = 1u << 4,  ///< (Vector4)
+    PREMULTIPLIED_ALPHA          = 1u << 5,  ///< (bool, packed as a uint8_t)
+    INDEXED_DRAW_FIRST_ELEMENT   = 1u << 6,  ///< (uint32_t)
+    INDEXED_DRAW_ELEMENTS_COUNT  = 1u << 7,  ///< (uint32_t)
+    DEPTH_WRITE_MODE             = 1u << 8,  ///< (DepthWriteMode::Type)
+    DEPTH_TEST_MODE              = 1u << 9,  ///< (DepthTestMode::Type)
+    DEPTH_FUNCTION               = 1u << 10, ///< (DepthFunction::Type)
+    RENDER_MODE                  = 1u << 11, ///< (RenderMode::Type)
+    STENCIL_FUNCTION             = 1u << 12, ///< (StencilFunction::Type)
+    STENCIL_FUNCTION_MASK        = 1u << 13, ///< (int32_t)
+    STENCIL_FUNCTION_REFERENCE   = 1u << 14, ///< (int32_t)
+    STENCIL_MASK                 = 1u << 15, ///< (int32_t)
+    STENCIL_OPERATION_ON_FAIL    = 1u << 16, ///< (StencilOperation::Type)
+    STENCIL_OPERATION_ON_Z_FAIL  = 1u << 17, ///< (StencilOperation::Type)
+    STENCIL_OPERATION_ON_Z_PASS  = 1u << 18, ///< (StencilOperation::Type)
+    SHADER                       = 1u << 19, ///< Marks the shader as changed; no value is packed
+  };
+
   /**
    * @copydoc Dali::Internal::GlResourceOwner::GlContextDestroyed()
    */
@@ -157,6 +189,13 @@ public:
 
   void SetDrawCommands( Dali::DevelRenderer::DrawCommand* pDrawCommands, uint32_t size );
 
+  /**
+   * Changes several parts of the state at once.
+   * @param[in] changedFields A bitmask of the StateField values which have changed
+   * @param[in] values The new values of the changed parts, packed without padding in the order of the StateField values
+   */
+  void ApplyStateChanges( uint32_t changedFields, const uint8_t* values );
+
   /**
    * @brief Returns a reference to an array of draw commands
    * @return Valid array of draw commands (may be empty)
@@ -380,6 +419,53 @@ public:
                const Dali::Internal::SceneGraph::RenderInstruction& instruction,
                uint32_t queueIndex );
 
+  /**
+   * Query whether the renderer uses a shader with the INSTANCED hint, so it can be drawn with an instanced draw call.
+   * @return True if the renderer can be drawn instanced
+   */
+  bool IsInstanced() const;
+
+  /**
+   * Check whether another renderer can be drawn in the same instanced draw call as this one.
+   * The renderers must use the same program, geometry, textures and render state, and the uniforms which are not
+   * read from per-instance attributes must have the same values.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using this renderer
+   * @param[in] other The other renderer
+   * @param[in] otherNode The node using the other renderer
+   * @return True if both renderers can be drawn in the same instanced draw call
+   */
+  bool IsInstanceCompatible( BufferIndex bufferIndex,
+                             const SceneGraph::NodeDataProvider& node,
+                             Renderer& other,
+                             const SceneGraph::NodeDataProvider& otherNode );
+
+  /**
+   * Called to render a run of compatible render items with a single instanced draw call during RenderManager::Render().
+   * The model-view matrix, color, size and the node uniforms read by the shader as attributes are packed into an instance buffer.
+   * If instancing is not supported by the context, the items are drawn one by one with constant attribute values.
+   * @param[in] context The context used for rendering
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] renderList The render list containing the items, the first of which uses this renderer
+   * @param[in] first The index of the first item
+   * @param[in] count The number of items to draw
+   * @param[in] viewMatrix The view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @param[in] blend If true, blending is enabled
+   * @param[in] boundTextures The textures bound for rendering
+   * @param[in] instruction. for use case like reflection where CullFace needs to be adjusted
+   */
+  void RenderInstances( Context& context,
+                        BufferIndex bufferIndex,
+                        const SceneGraph::RenderList& renderList,
+                        uint32_t first,
+                        uint32_t count,
+                        const Matrix& viewMatrix,
+                        const Matrix& projectionMatrix,
+                        bool blend,
+                        Vector<GLuint>& boundTextures,
+                        const Dali::Internal::SceneGraph::RenderInstruction& instruction );
+
   /**
    * Write the renderer's sort attributes to the passed in reference
    *
@@ -413,6 +499,13 @@ private:
   // Undefined
   Renderer& operator=( const Renderer& rhs );
 
+  /**
+   * Sets the face culling mode, adjusted for reflections
+   * @param context to use
+   * @param instruction The render instruction
+   */
+  void SetFaceCulling( Context& context, const Dali::Internal::SceneGraph::RenderInstruction& instruction );
+
   /**
    * Sets blending options
    * @param context to use
@@ -437,6 +530,29 @@ private:
    */
   void SetUniformFromProperty( BufferIndex bufferIndex, Program& program, UniformIndexMap& map );
 
+  /**
+   * Write the uniforms declared in the program's uniform blocks to the context's uniform buffer ring and bind them.
+   * SetUniforms() must have been called first so that the uniform map is up to date.
+   * @param[in] context The GL context
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using the renderer
+   * @param[in] modelMatrix The model matrix
+   * @param[in] modelViewMatrix The model-view matrix
+   * @param[in] viewMatrix The view matrix
+   * @param[in] projectionMatrix The projection matrix
+   * @param[in] size The size of the renderer
+   * @param[in] program The shader program
+   */
+  void WriteUniformBlocks( Context& context,
+                           BufferIndex bufferIndex,
+                           const SceneGraph::NodeDataProvider& node,
+                           const Matrix& modelMatrix,
+                           const Matrix& modelViewMatrix,
+                           const Matrix& viewMatrix,
+                           const Matrix& projectionMatrix,
+                           const Vector3& size,
+                           Program& program );
+
   /**
    * Bind the textures and setup the samplers
    * @param[in] context The GL context
@@ -464,6 +580,18 @@ private:
   UniformIndexMappings         mUniformIndexMap;
   Vector<GLint>                mAttributesLocation;
 
+  struct InstanceAttribute
+  {
+    GLint                      location;                    ///< The location of the attribute in the Program
+    uint32_t                   componentCount;              ///< The number of floats in the attribute
+    uint32_t                   nodeUniformIndex;            ///< The index of the node uniform, for attributes replacing a uniform
+  };
+
+  Vector<InstanceAttribute>    mInstanceAttributes;         ///< The per-instance attributes of the last instanced draw call
+  Vector<float>                mInstanceData;               ///< The packed per-instance attributes
+  OwnerPointer< GpuBuffer >    mInstanceBuffer;             ///< The buffer the per-instance attributes are uploaded to
+  Vector<uint8_t>              mUniformBlockData;           ///< The values of a uniform block, before they are copied to the uniform buffer
+
   uint64_t                     mUniformsHash;
 
   StencilParameters            mStencilParameters;          ///< Struct containing all stencil related options
@@ -21,7 +21,7 @@
 #include <math.h>   //floor, log2
 
 // INTERNAL INCLUDES
-
+#include <dali/internal/common/pixel-conversion.h>
 
 namespace Dali
 {
@@ -672,7 +672,9 @@ Texture::Texture( Type type, Pixel::Format format, ImageDimensions size )
   mMaxMipMapLevel( 0 ),
   mType( type ),
   mHasAlpha( HasAlpha( format ) ),
-  mIsCompressed( IsCompressedFormat( format ) )
+  mIsCompressed( IsCompressedFormat( format ) ),
+  mRgbImageRequiresConversion( false ),
+  mRgbSubImageRequiresConversion( false )
 {
   PixelFormatToGl( format,
                    mGlFormat,
@@ -693,7 +695,9 @@ Texture::Texture( NativeImageInterfacePtr nativeImageInterface )
   mMaxMipMapLevel( 0 ),
   mType( TextureType::TEXTURE_2D ),
   mHasAlpha( nativeImageInterface->RequiresBlending() ),
-  mIsCompressed( false )
+  mIsCompressed( false ),
+  mRgbImageRequiresConversion( false ),
+  mRgbSubImageRequiresConversion( false )
 {
 }
 
@@ -789,6 +793,12 @@ void Texture::Initialize(Context& context)
   }
 }
 
+void Texture::CacheRgbaConversion( const Integration::GlAbstraction& glAbstraction )
+{
+  mRgbImageRequiresConversion = glAbstraction.TextureRequiresConverting( GL_RGB, mGlFormat, false );
+  mRgbSubImageRequiresConversion = glAbstraction.TextureRequiresConverting( GL_RGB, mGlFormat, true );
+}
+
 void Texture::Upload( Context& context, PixelDataPtr pixelData, const Internal::Texture::UploadParams& params  )
 {
   DALI_ASSERT_ALWAYS( mNativeImage == nullptr );
@@ -809,23 +819,15 @@ void Texture::Upload( Context& context, PixelDataPtr pixelData, const Internal::
   //necessary to upload all the mipmap levels
   mMaxMipMapLevel = ( mMaxMipMapLevel > params.mipmap ) ? mMaxMipMapLevel : params.mipmap;
 
-  const bool isSubImage = ( ( params.xOffset != 0 ) ||
-                            ( params.yOffset != 0 ) ||
-                            ( params.width  != ( mWidth  / ( 1 << params.mipmap ) ) ) ||
-                            ( params.height != ( mHeight / ( 1 << params.mipmap ) ) ) );
+  const bool isSubImage = IsSubImage( params );
 
   if( context.TextureRequiresConverting( glFormat, mGlFormat, isSubImage ) )
   {
+    //RGB data is normally expanded by the update thread already, see RequiresRgbaConversion()
     uint32_t dataSize = static_cast< uint32_t >( params.width ) * params.height;
     //reserve() does not allocate the memory on some systems so can crash if not populated using push_back
     tempBuffer.resize( dataSize * 4u );
-    for( uint32_t i = 0u; i < dataSize; ++i )
-    {
-      tempBuffer[i*4u]   = buffer[i*3u];
-      tempBuffer[i*4u+1] = buffer[i*3u+1];
-      tempBuffer[i*4u+2] = buffer[i*3u+2];
-      tempBuffer[i*4u+3] = 0xFF;
-    }
+    PixelConversion::ConvertRgbToRgba( &tempBuffer[0], buffer, dataSize );
 
     buffer = &tempBuffer[0];
     glFormat = mGlFormat; // Set the glFormat to GL_RGBA
@@ -145,8 +145,40 @@ public:
     return mNativeImage;
   }
 
+  /**
+   * Asks the GL abstraction whether RGB pixel data has to be expanded to RGBA before it is uploaded to the texture,
+   * as a whole image and as a sub-image, and caches the answers for RequiresRgbaConversion().
+   * Called in the event thread, before the texture is passed to the update thread.
+   * @param[in] glAbstraction The GL abstraction
+   */
+  void CacheRgbaConversion( const Integration::GlAbstraction& glAbstraction );
+
+  /**
+   * Check if pixel data of the given format has to be expanded to RGBA before it is uploaded to the texture
+   * @param[in] pixelFormat The format of the pixel data
+   * @param[in] params Upload parameters. See UploadParams
+   * @return true if the pixel data has to be expanded to RGBA
+   */
+  bool RequiresRgbaConversion( Pixel::Format pixelFormat, const Internal::Texture::UploadParams& params ) const
+  {
+    return ( pixelFormat == Pixel::RGB888 ) && ( IsSubImage( params ) ? mRgbSubImageRequiresConversion : mRgbImageRequiresConversion );
+  }
+
 private:
 
+  /**
+   * Helper method to check whether an upload only replaces part of a mipmap level
+   * @param[in] params Upload parameters. See UploadParams
+   * @return true if the upload is a sub-image
+   */
+  bool IsSubImage( const Internal::Texture::UploadParams& params ) const
+  {
+    return ( params.xOffset != 0 ) ||
+           ( params.yOffset != 0 ) ||
+           ( params.width  != ( mWidth  / ( 1 << params.mipmap ) ) ) ||
+           ( params.height != ( mHeight / ( 1 << params.mipmap ) ) );
+  }
+
   /**
    * Helper method to apply a sampler to the texture
    * @param[in] context The GL context
@@ -167,6 +199,8 @@ private:
   Type mType:3;                         ///< Type of the texture
   bool mHasAlpha : 1;                   ///< Whether the format has an alpha channel
   bool mIsCompressed : 1;               ///< Whether the format is compressed
+  bool mRgbImageRequiresConversion : 1;    ///< Whether RGB data is expanded to RGBA before it is uploaded as a whole image
+  bool mRgbSubImageRequiresConversion : 1; ///< Whether RGB data is expanded to RGBA before it is uploaded as a sub-image
 
 };
 
@@ -121,6 +121,7 @@ VertexBuffer::VertexBuffer()
  mData(nullptr),
  mGpuBuffer(nullptr),
  mSize(0),
+ mFormatVersion(0),
  mDataChanged(true)
 {
 }
@@ -130,6 +131,7 @@ VertexBuffer::~VertexBuffer() = default;
 void VertexBuffer::SetFormat( VertexBuffer::Format* format )
 {
   mFormat = format;
+  ++mFormatVersion;
   mDataChanged = true;
 }
 
@@ -186,12 +186,22 @@ public:
     return mFormat.Get();
   }
 
+  /**
+   * Get the number of times the format has been set, so users of the buffer can tell when the layout has changed
+   * @return The format version
+   */
+  inline uint32_t GetFormatVersion() const
+  {
+    return mFormatVersion;
+  }
+
 private:
   OwnerPointer< VertexBuffer::Format >  mFormat;    ///< Format of the buffer
   OwnerPointer< Dali::Vector< uint8_t > > mData;      ///< Data
   OwnerPointer< GpuBuffer >               mGpuBuffer; ///< Pointer to the GpuBuffer associated with this RenderVertexBuffer
 
   uint32_t mSize;       ///< Number of Elements in the buffer
+  uint32_t mFormatVersion; ///< Incremented every time the format is set
   bool mDataChanged;  ///< Flag to know if data has changed in a frame
 };
 
@@ -85,11 +85,21 @@ public: // API
    */
   virtual bool IsBinarySupported() = 0;
 
+  /**
+   * @return true if programs can declare uniform blocks, i.e. the context is OpenGL ES 3.0 or later
+   */
+  virtual bool IsUniformBlockSupported() = 0;
+
   /**
    * @return the binary format to use
    */
   virtual GLenum ProgramBinaryFormat() = 0;
 
+  /**
+   * @return an identifier of the driver and the binary format, binaries compiled with another identifier cannot be loaded
+   */
+  virtual std::size_t GetBinaryFormatId() = 0;
+
   /**
    * @param programData to store/save
    */
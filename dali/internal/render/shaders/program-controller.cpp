@@ -18,7 +18,11 @@
 // CLASS HEADER
 #include <dali/internal/render/shaders/program-controller.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
+#include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/gl-defines.h>
 #include <dali/internal/common/shader-saver.h>
 #include <dali/internal/render/gl-resources/gl-call-debug.h>
@@ -30,31 +34,49 @@ namespace Dali
 namespace Internal
 {
 
+namespace
+{
+const uint32_t DEFERRED_PROGRAMS_PER_FRAME = 1u; ///< The number of deferred programs compiled before rendering a frame
+} // unnamed namespace
+
 ProgramController::ProgramController( Integration::GlAbstraction& glAbstraction )
 : mShaderSaver( nullptr ),
   mGlAbstraction( glAbstraction ),
   mCurrentProgram( nullptr ),
   mProgramBinaryFormat( 0 ),
-  mNumberOfProgramBinaryFormats( 0 )
+  mNumberOfProgramBinaryFormats( 0 ),
+  mGlesMajorVersion( 2 ),
+  mUseCount( 1u ),
+  mFrameUseCount( 1u ),
+  mProgramBudget( 0u ),
+  mBinaryFormatId( 0u )
 {
   // we have 17 default programs so make room for those and a few custom ones as well
   mProgramCache.Reserve( 32 );
+  mProgramIndex.reserve( 32 );
 }
 
 ProgramController::~ProgramController() = default;
 
 void ProgramController::ResetProgramMatrices()
 {
-  const ProgramIterator end = mProgramCache.End();
-  for ( ProgramIterator iter = mProgramCache.Begin(); iter != end; ++iter )
+  // Only the programs which have been used since the last reset can have matrices set
+  for( auto&& program : mUsedPrograms )
   {
-    Program* program = (*iter)->GetProgram();
     program->SetProjectionMatrix( nullptr );
     program->SetViewMatrix( nullptr );
   }
+  mUsedPrograms.clear();
+  ++mUseCount;
+
+  // The current program can be used again without being set
+  if( mCurrentProgram )
+  {
+    MarkUsed( *mCurrentProgram );
+  }
 }
 
-void ProgramController::GlContextCreated()
+void ProgramController::GlContextCreated( GLint glesMajorVersion )
 {
   // reset any potential previous errors
   LOG_GL( "GetError()\n" );
@@ -72,13 +94,29 @@ void ProgramController::GlContextCreated()
     CHECK_GL( mGlAbstraction, mGlAbstraction.GetIntegerv(GL_PROGRAM_BINARY_FORMATS_OES, &programBinaryFormats[0] ) );
     LOG_GL("GetIntegerv(GL_PROGRAM_BINARY_FORMATS_OES) = %d\n", programBinaryFormats[0] );
     mProgramBinaryFormat = programBinaryFormats[0];
+
+    // Binaries saved by another driver cannot be loaded, so identify it along with the format
+    std::string driver = std::to_string( mProgramBinaryFormat );
+    for( GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION } )
+    {
+      const GLubyte* value = mGlAbstraction.GetString( name );
+      if( value )
+      {
+        driver.append( reinterpret_cast<const char*>( value ) );
+      }
+    }
+    mBinaryFormatId = CalculateHash( driver );
   }
+
+  mGlesMajorVersion = glesMajorVersion;
 }
 
 void ProgramController::GlContextDestroyed()
 {
   mNumberOfProgramBinaryFormats = 0;
   mProgramBinaryFormat = 0;
+  mBinaryFormatId = 0u;
+  mGlesMajorVersion = 2;
 
   SetCurrentProgram( nullptr );
   // Inform programs they are no longer valid
@@ -96,18 +134,8 @@ Integration::GlAbstraction& ProgramController::GetGlAbstraction()
 
 Program* ProgramController::GetProgram( size_t shaderHash )
 {
-  Program* program = nullptr;
-  const ProgramIterator end = mProgramCache.End();
-  for ( ProgramIterator iter = mProgramCache.Begin(); iter != end; ++iter )
-  {
-    size_t hash = (*iter)->GetHash();
-    if( shaderHash == hash )
-    {
-      program = (*iter)->GetProgram();
-      break;
-    }
-  }
-  return program;
+  auto iter = mProgramIndex.find( shaderHash );
+  return iter != mProgramIndex.end() ? iter->second : nullptr;
 }
 
 void ProgramController::AddProgram( size_t shaderHash, Program* program )
@@ -115,6 +143,8 @@ void ProgramController::AddProgram( size_t shaderHash, Program* program )
   // we expect unique hash values so its event thread sides job to guarantee that
   // AddProgram is only called after program checks that GetProgram returns NULL
   mProgramCache.PushBack( new ProgramPair( program, shaderHash ) );
+  mProgramIndex[ shaderHash ] = program;
+  mPendingPrograms.push_back( program );
 }
 
 Program* ProgramController::GetCurrentProgram()
@@ -125,6 +155,11 @@ Program* ProgramController::GetCurrentProgram()
 void ProgramController::SetCurrentProgram( Program* program )
 {
   mCurrentProgram = program;
+
+  if( program )
+  {
+    MarkUsed( *program );
+  }
 }
 
 bool ProgramController::IsBinarySupported()
@@ -132,11 +167,21 @@ bool ProgramController::IsBinarySupported()
   return mNumberOfProgramBinaryFormats > 0;
 }
 
+bool ProgramController::IsUniformBlockSupported()
+{
+  return mGlesMajorVersion >= 3;
+}
+
 GLenum ProgramController::ProgramBinaryFormat()
 {
   return mProgramBinaryFormat;
 }
 
+std::size_t ProgramController::GetBinaryFormatId()
+{
+  return mBinaryFormatId;
+}
+
 void ProgramController::StoreBinary( Internal::ShaderDataPtr programData )
 {
   DALI_ASSERT_DEBUG( programData->GetBufferSize() > 0 );
@@ -158,6 +203,95 @@ void ProgramController::ClearCurrentProgram()
   SetCurrentProgram( nullptr );
 }
 
+void ProgramController::SetProgramBudget( uint32_t programCount )
+{
+  mProgramBudget = programCount;
+}
+
+void ProgramController::UnloadLeastRecentlyUsedPrograms()
+{
+  if( mProgramBudget > 0u && mProgramCache.Count() > mProgramBudget )
+  {
+    uint32_t loadedCount = 0u;
+    std::vector<Program*> unusedPrograms;
+    for( auto&& programPair : mProgramCache )
+    {
+      Program* program = programPair->GetProgram();
+      if( program->IsLoaded() )
+      {
+        ++loadedCount;
+        if( program->GetLastUsed() < mFrameUseCount )
+        {
+          unusedPrograms.push_back( program );
+        }
+      }
+    }
+
+    if( loadedCount > mProgramBudget )
+    {
+      // Programs used in this frame are kept even if that exceeds the budget
+      const uint32_t unloadCount = std::min( loadedCount - mProgramBudget, static_cast<uint32_t>( unusedPrograms.size() ) );
+      std::partial_sort( unusedPrograms.begin(), unusedPrograms.begin() + unloadCount, unusedPrograms.end(),
+                         []( const Program* lhs, const Program* rhs ) { return lhs->GetLastUsed() < rhs->GetLastUsed(); } );
+      for( uint32_t i = 0u; i < unloadCount; ++i )
+      {
+        unusedPrograms[i]->Evict();
+      }
+    }
+  }
+
+  ++mUseCount;
+  mFrameUseCount = mUseCount;
+  if( mCurrentProgram )
+  {
+    MarkUsed( *mCurrentProgram );
+  }
+}
+
+void ProgramController::Precompile( Program& program )
+{
+  // A program evicted by the budget is loaded again when it is next used, deferring it would stop drawing its renderers
+  if( !program.HasBeenLoaded() && !program.IsCompileDeferred() )
+  {
+    program.SetCompileDeferred( true );
+    mDeferredPrograms.push_back( &program );
+  }
+}
+
+void ProgramController::LoadPendingPrograms()
+{
+  for( auto&& program : mPendingPrograms )
+  {
+    if( !program->IsCompileDeferred() && program->IsLoadRequired() )
+    {
+      program->LoadIfRequired();
+
+      // Count a new program as used so that the budget does not unload it before it is drawn
+      MarkUsed( *program );
+    }
+  }
+  mPendingPrograms.clear();
+
+  for( uint32_t i = 0u; i < DEFERRED_PROGRAMS_PER_FRAME && !mDeferredPrograms.empty(); ++i )
+  {
+    Program* program = mDeferredPrograms.front();
+    mDeferredPrograms.pop_front();
+
+    program->SetCompileDeferred( false );
+    program->LoadIfRequired();
+    MarkUsed( *program );
+  }
+}
+
+void ProgramController::MarkUsed( Program& program )
+{
+  if( program.GetLastUsed() != mUseCount )
+  {
+    program.SetLastUsed( mUseCount );
+    mUsedPrograms.push_back( &program );
+  }
+}
+
 } // namespace Internal
 
 } // namespace Dali
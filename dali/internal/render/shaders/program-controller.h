@@ -18,6 +18,11 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/owner-container.h>
 #include <dali/internal/common/shader-data.h>
@@ -110,8 +115,9 @@ public: // API
 
   /**
    * Notifies the cache that context is (re)created
+   * @param[in] glesMajorVersion The major version of the context, as cached by the Context
    */
-  void GlContextCreated();
+  void GlContextCreated( GLint glesMajorVersion );
 
   /**
    * Notifies cache that context is lost
@@ -129,6 +135,47 @@ public: // API
    */
   void ClearCurrentProgram();
 
+  /**
+   * Set the maximum number of GL programs to keep loaded.
+   * @param[in] programCount The number of programs, or 0 for no limit
+   */
+  void SetProgramBudget( uint32_t programCount );
+
+  /**
+   * Unloads the least recently used GL programs which were not used in the last frame until
+   * the number of loaded programs is within the budget. Must be called at the end of every frame
+   */
+  void UnloadLeastRecentlyUsedPrograms();
+
+  /**
+   * Defers the compilation of a program which has not been loaded yet. Deferred programs are
+   * compiled a few at a time by LoadPendingPrograms() and renderers using them are not drawn until then.
+   * @param[in] program The program
+   */
+  void Precompile( Program& program );
+
+  /**
+   * Loads the programs added to the cache since the last call and compiles the next deferred programs.
+   * Must be called before rendering every frame
+   */
+  void LoadPendingPrograms();
+
+  /**
+   * @return true if there are deferred programs waiting to be compiled
+   */
+  bool HasDeferredPrograms() const
+  {
+    return !mDeferredPrograms.empty();
+  }
+
+private:
+
+  /**
+   * Records that a program is used since the last ResetProgramMatrices()
+   * @param[in] program The program
+   */
+  void MarkUsed( Program& program );
+
 private: // From ProgramCache
 
   /**
@@ -161,11 +208,21 @@ private: // From ProgramCache
    */
   bool IsBinarySupported() override;
 
+  /**
+   * @copydoc ProgramCache::IsUniformBlockSupported
+   */
+  bool IsUniformBlockSupported() override;
+
   /**
    * @copydoc ProgramCache::ProgramBinaryFormat
    */
   GLenum ProgramBinaryFormat() override;
 
+  /**
+   * @copydoc ProgramCache::GetBinaryFormatId
+   */
+  std::size_t GetBinaryFormatId() override;
+
   /**
    * @copydoc ProgramCache::StoreBinary
    */
@@ -188,6 +245,16 @@ private: // Data
 
   GLint mProgramBinaryFormat;
   GLint mNumberOfProgramBinaryFormats;
+  GLint mGlesMajorVersion;
+
+  std::unordered_map<size_t, Program*> mProgramIndex; ///< The programs of mProgramCache by shader hash
+  std::vector<Program*> mUsedPrograms;                ///< The programs used since the last ResetProgramMatrices()
+  uint32_t mUseCount;                                 ///< Incremented by every ResetProgramMatrices(), programs record it when used
+  uint32_t mFrameUseCount;                            ///< The use count at the start of the current frame
+  uint32_t mProgramBudget;                            ///< The maximum number of loaded programs, 0 for no limit
+  std::vector<Program*> mPendingPrograms;             ///< The programs added since the last LoadPendingPrograms()
+  std::deque<Program*> mDeferredPrograms;             ///< The programs waiting to be compiled, in the order of the requests
+  std::size_t mBinaryFormatId;                        ///< Identifies the driver and the binary format, 0 if binaries are not supported
 
 };
 
@@ -79,8 +79,11 @@ namespace
 
 const char* const gStdAttribs[ Program::ATTRIB_TYPE_LAST ] =
 {
-  "aPosition",    // ATTRIB_POSITION
-  "aTexCoord",    // ATTRIB_TEXCOORD
+  "aPosition",          // ATTRIB_POSITION
+  "aTexCoord",          // ATTRIB_TEXCOORD
+  "aInstanceModelView", // ATTRIB_INSTANCE_MODEL_VIEW
+  "aInstanceColor",     // ATTRIB_INSTANCE_COLOR
+  "aInstanceSize",      // ATTRIB_INSTANCE_SIZE
 };
 
 const char* const gStdUniforms[ Program::UNIFORM_TYPE_LAST ] =
@@ -111,7 +114,6 @@ Program* Program::New( ProgramCache& cache, Internal::ShaderDataPtr shaderData,
   {
     // program not found so create it
     program = new Program( cache, shaderData, modifiesGeometry );
-    program->Load();
     cache.AddProgram( shaderHash, program );
   }
 
@@ -120,6 +122,8 @@ Program* Program::New( ProgramCache& cache, Internal::ShaderDataPtr shaderData,
 
 void Program::Use()
 {
+  LoadIfRequired();
+
   if ( mLinked )
   {
     if ( this != mCache.GetCurrentProgram() )
@@ -180,6 +184,18 @@ GLint Program::GetCustomAttributeLocation( uint32_t attributeIndex )
   return location;
 }
 
+GLint Program::GetInstanceAttributeLocation( ConstString name )
+{
+  auto iter = mInstanceAttributeLocations.find( name.GetCString() );
+  if( iter != mInstanceAttributeLocations.end() )
+  {
+    return iter->second;
+  }
+
+  const GLint location = GetCustomAttributeLocation( RegisterCustomAttribute( name ) );
+  mInstanceAttributeLocations.emplace( name.GetCString(), location );
+  return location;
+}
 
 uint32_t Program::RegisterUniform( ConstString name )
 {
@@ -365,6 +381,79 @@ void Program::GetActiveSamplerUniforms()
   }
 }
 
+void Program::GetActiveUniformBlocks()
+{
+  mUniformBlocks.clear();
+
+  if( !mLinked || !mCache.IsUniformBlockSupported() )
+  {
+    return;
+  }
+
+  GLint numberOfBlocks = 0;
+  CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv( mProgramId, GL_ACTIVE_UNIFORM_BLOCKS, &numberOfBlocks ) );
+  if( numberOfBlocks <= 0 )
+  {
+    return;
+  }
+
+  GLint uniformMaxNameLength = 0;
+  CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv( mProgramId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &uniformMaxNameLength ) );
+  std::vector< char > name( uniformMaxNameLength + 1 ); // Allow for null terminator
+
+  mUniformBlocks.resize( numberOfBlocks );
+  for( GLuint blockIndex = 0; blockIndex < static_cast<GLuint>( numberOfBlocks ); ++blockIndex )
+  {
+    UniformBlock& block = mUniformBlocks[ blockIndex ];
+    block.binding = blockIndex;
+    block.size = 0;
+
+    GLint memberCount = 0;
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &block.size ) );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &memberCount ) );
+
+    if( memberCount > 0 )
+    {
+      std::vector< GLint > indices( memberCount );
+      std::vector< GLint > offsets( memberCount );
+      std::vector< GLint > matrixStrides( memberCount );
+      CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, indices.data() ) );
+
+      std::vector< GLuint > uniformIndices( indices.begin(), indices.end() );
+      CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformsiv( mProgramId, memberCount, uniformIndices.data(), GL_UNIFORM_OFFSET, offsets.data() ) );
+      CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformsiv( mProgramId, memberCount, uniformIndices.data(), GL_UNIFORM_MATRIX_STRIDE, matrixStrides.data() ) );
+
+      block.members.reserve( memberCount );
+      for( GLint i = 0; i < memberCount; ++i )
+      {
+        GLsizei nameLength = 0;
+        GLint number = 0;
+        GLenum type = GL_ZERO;
+        name[0] = '\0';
+        CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniform( mProgramId, uniformIndices[ i ], uniformMaxNameLength, &nameLength, &number, &type, name.data() ) );
+
+        // Members of a named block instance are reported as "Block.member", and arrays as "member[0]"
+        char* memberName = strrchr( name.data(), '.' );
+        memberName = memberName ? memberName + 1 : name.data();
+        char* arraySubscript = strchr( memberName, '[' );
+        if( arraySubscript )
+        {
+          *arraySubscript = '\0';
+        }
+
+        const uint32_t uniformIndex = RegisterUniform( ConstString( memberName ) );
+
+        // The value is set through the uniform buffer, there is no location to query
+        mUniformLocations[ uniformIndex ].second = UNIFORM_UNKNOWN;
+
+        block.members.push_back( UniformBlockMember{ uniformIndex, offsets[ i ], matrixStrides[ i ] } );
+      }
+    }
+
+    CHECK_GL( mGlAbstraction, mGlAbstraction.UniformBlockBinding( mProgramId, blockIndex, block.binding ) );
+  }
+}
+
 bool Program::GetSamplerUniformLocation( uint32_t index, GLint& location  )
 {
   bool result = false;
@@ -624,6 +713,23 @@ void Program::GlContextDestroyed()
   ResetAttribsUniformCache();
 }
 
+void Program::Evict()
+{
+  Unload();
+  ResetAttribsUniformCache();
+  mLoadRequired = true;
+}
+
+void Program::LoadIfRequired()
+{
+  if( mLoadRequired )
+  {
+    mLoadRequired = false;
+    mHasBeenLoaded = true;
+    Load();
+  }
+}
+
 bool Program::ModifiesGeometry()
 {
   return mModifiesGeometry;
@@ -639,6 +745,10 @@ Program::Program( ProgramCache& cache, Internal::ShaderDataPtr shaderData, bool
   mFragmentShaderId( 0 ),
   mProgramId( 0 ),
   mProgramData(shaderData),
+  mLastUsed( 0u ),
+  mLoadRequired( true ),
+  mCompileDeferred( false ),
+  mHasBeenLoaded( false ),
   mModifiesGeometry( modifiesGeometry )
 {
   // reserve space for standard attributes
@@ -677,8 +787,8 @@ void Program::Load()
 
   const bool binariesSupported = mCache.IsBinarySupported();
 
-  // if shader binaries are supported and ShaderData contains compiled bytecode?
-  if( binariesSupported && mProgramData->HasBinary() )
+  // if shader binaries are supported and ShaderData contains bytecode compiled by this driver?
+  if( binariesSupported && mProgramData->HasBinary() && mProgramData->GetBinaryFormatId() == mCache.GetBinaryFormatId() )
   {
     DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Using Compiled Shader, Size = %d\n", mProgramData->GetBufferSize());
 
@@ -738,6 +848,7 @@ void Program::Load()
             mProgramData->AllocateBuffer(binaryLength);
             // Copy the bytecode to ShaderData
             CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramBinary(mProgramId, binaryLength, nullptr, &binaryFormat, mProgramData->GetBufferData()) );
+            mProgramData->SetBinaryFormatId( mCache.GetBinaryFormatId() );
             mCache.StoreBinary( mProgramData );
             DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Saved binary.\n" );
           }
@@ -747,6 +858,7 @@ void Program::Load()
   }
 
   GetActiveSamplerUniforms();
+  GetActiveUniformBlocks();
 
   // No longer needed
   FreeShaders();
@@ -870,6 +982,7 @@ void Program::ResetAttribsUniformCache()
   {
     mAttributeLocations[ i ].second = ATTRIB_UNKNOWN;
   }
+  mInstanceAttributeLocations.clear();
 
   // reset all gl uniform locations
   for( uint32_t i = 0; i < mUniformLocations.size(); ++i )
@@ -879,6 +992,7 @@ void Program::ResetAttribsUniformCache()
   }
 
   mSamplerUniformLocations.clear();
+  mUniformBlocks.clear();
 
   // reset uniform caches
   mSizeUniformCache.x = mSizeUniformCache.y = mSizeUniformCache.z = 0.f;
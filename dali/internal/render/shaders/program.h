@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <string>
 #include <cstdint> // int32_t, uint32_t
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/vector-wrapper.h>
@@ -74,6 +75,9 @@ public:
     ATTRIB_UNKNOWN = -1,
     ATTRIB_POSITION,
     ATTRIB_TEXCOORD,
+    ATTRIB_INSTANCE_MODEL_VIEW,
+    ATTRIB_INSTANCE_COLOR,
+    ATTRIB_INSTANCE_SIZE,
     ATTRIB_TYPE_LAST
   };
 
@@ -100,7 +104,28 @@ public:
   };
 
   /**
-   * Creates a new program, or returns a copy of an existing program in the program cache
+   * A uniform declared in a uniform block
+   */
+  struct UniformBlockMember
+  {
+    uint32_t uniformIndex; ///< The index of the uniform name in the local cache
+    GLint    offset;       ///< The offset of the value from the start of the block, in bytes
+    GLint    matrixStride; ///< The stride between the columns of a matrix, in bytes
+  };
+
+  /**
+   * A uniform block declared by the program
+   */
+  struct UniformBlock
+  {
+    std::vector<UniformBlockMember> members; ///< The active uniforms of the block
+    GLuint binding;                          ///< The uniform buffer binding point of the block
+    GLint  size;                             ///< The size of the block, in bytes
+  };
+
+  /**
+   * Creates a new program, or returns a copy of an existing program in the program cache.
+   * A new program is loaded by the program cache before the next frame is rendered.
    * @param[in] cache where the programs are stored
    * @param[in] shaderData  A pointer to a data structure containing the program source
    *                        and optionally precompiled binary. If the binary is empty the program bytecode
@@ -140,6 +165,15 @@ public:
    */
   GLint GetCustomAttributeLocation( uint32_t attributeIndex );
 
+  /**
+   * Gets the location of an attribute that may be set per instance, registering it if required.
+   * The location is cached by name, also when the program does not have the attribute,
+   * so it is queried from GL only once per context
+   * @param [in] name attribute name
+   * @return the location of the attribute in the GL program, or ATTRIB_UNKNOWN
+   */
+  GLint GetInstanceAttributeLocation( ConstString name );
+
   /**
    * Register a uniform name in our local cache
    * @param [in] name uniform name
@@ -160,6 +194,21 @@ public:
    */
   void GetActiveSamplerUniforms();
 
+  /**
+   * Introspect the newly loaded shader to get the layout of its uniform blocks.
+   * Uniforms declared in a block have no location, their values have to be written to a uniform buffer.
+   */
+  void GetActiveUniformBlocks();
+
+  /**
+   * Get the uniform blocks of the program, only introspected if the context supports them
+   * @return The uniform blocks, empty if the program does not declare any
+   */
+  const std::vector<UniformBlock>& GetUniformBlocks() const
+  {
+    return mUniformBlocks;
+  }
+
   /**
    * Gets the uniform location for a sampler
    * @param [in] index The index of the active sampler
@@ -263,6 +312,74 @@ public:
    */
   void GlContextDestroyed();
 
+  /**
+   * Unloads the GL program to release its memory; it is loaded again the next time it is used
+   */
+  void Evict();
+
+  /**
+   * @return true if the GL program has been created and not evicted or lost with the context since
+   */
+  bool IsLoaded() const
+  {
+    return mProgramId != 0;
+  }
+
+  /**
+   * Loads the program if it has not been loaded since it was created or evicted
+   */
+  void LoadIfRequired();
+
+  /**
+   * @return true if the program has to be loaded before it is used
+   */
+  bool IsLoadRequired() const
+  {
+    return mLoadRequired;
+  }
+
+  /**
+   * @return true if the program has been loaded since it was created, so renderers may already have been drawn with it
+   */
+  bool HasBeenLoaded() const
+  {
+    return mHasBeenLoaded;
+  }
+
+  /**
+   * Set whether the program is waiting for the program cache to compile it; renderers using it are not drawn meanwhile
+   * @param[in] deferred True if the compilation is deferred
+   */
+  void SetCompileDeferred( bool deferred )
+  {
+    mCompileDeferred = deferred;
+  }
+
+  /**
+   * @return true if the program is waiting for the program cache to compile it
+   */
+  bool IsCompileDeferred() const
+  {
+    return mCompileDeferred;
+  }
+
+  /**
+   * Set when the program was last used, this is up to the program cache
+   * @param[in] useCount The use count of the program cache
+   */
+  void SetLastUsed( uint32_t useCount )
+  {
+    mLastUsed = useCount;
+  }
+
+  /**
+   * @return when the program was last used
+   */
+  uint32_t GetLastUsed() const
+  {
+    return mLastUsed;
+  }
+
   /**
    * @return true if this program modifies geometry
    */
@@ -372,14 +489,20 @@ private:  // Data
   GLuint mFragmentShaderId;                   ///< GL identifier for fragment shader
   GLuint mProgramId;                          ///< GL identifier for program
   Internal::ShaderDataPtr mProgramData;       ///< Shader program source and binary (when compiled & linked or loaded)
+  uint32_t mLastUsed;                         ///< The use count of the program cache when the program was last used
+  bool mLoadRequired;                         ///< whether the program has to be loaded before it is used
+  bool mCompileDeferred;                      ///< whether the program is waiting for the program cache to compile it
+  bool mHasBeenLoaded;                        ///< whether the program has been loaded since it was created, even if it was evicted since
 
   // location caches
   using NameLocationPair = std::pair<ConstString, GLint>;
   using Locations        = std::vector<NameLocationPair>;
 
   Locations mAttributeLocations;      ///< attribute location cache
+  std::unordered_map<const char*, GLint> mInstanceAttributeLocations; ///< per-instance attribute location cache, by interned name
   Locations mUniformLocations;        ///< uniform location cache
   std::vector<GLint> mSamplerUniformLocations; ///< sampler uniform location cache
+  std::vector<UniformBlock> mUniformBlocks;    ///< uniform block layout cache
 
   // uniform value caching
   GLint mUniformCacheInt[ MAX_UNIFORM_CACHE_SIZE ];         ///< Value cache for uniforms of single int
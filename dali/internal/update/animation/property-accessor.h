@@ -199,6 +199,15 @@ public:
     mProperty->Bake( bufferIndex, value );
   }
 
+  /**
+   * Retrieve the property.
+   * @return The property
+   */
+  const SceneGraph::TransformManagerPropertyHandler<T>* GetProperty() const
+  {
+    return mProperty;
+  }
+
 private:
 
   // Undefined
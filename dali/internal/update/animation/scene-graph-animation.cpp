@@ -19,7 +19,10 @@
 #include <dali/internal/update/animation/scene-graph-animation.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cmath> // fmod
+#include <limits>
+#include <unordered_set>
 
 // INTERNAL INCLUDES
 #include <dali/internal/common/memory-pool-object-allocator.h>
@@ -42,6 +45,8 @@ inline void WrapInPlayRange( float& elapsed, const float& playRangeStartSeconds,
   }
 }
 
+const uint32_t NO_TRANSFORM_BATCH = std::numeric_limits< uint32_t >::max(); ///< The batch index of animators which are not updated in a transform batch
+
 /// Compares the end times of the animators and if the end time is less, then it is moved earlier in the list. If end times are the same, then no change.
 bool CompareAnimatorEndTimes( const Dali::Internal::SceneGraph::AnimatorBase* lhs, const Dali::Internal::SceneGraph::AnimatorBase* rhs )
 {
@@ -79,7 +84,15 @@ Animation::Animation( float durationSeconds, float speedFactor, const Vector2& p
   mState(Stopped),
   mProgressReachedSignalRequired( false ),
   mAutoReverseEnabled( false ),
-  mIsActive{ false }
+  mIsActive{ false },
+  mAnimatorsByStartTime(),
+  mStartTimes(),
+  mStartedAnimators(),
+  mStartedCount( 0u ),
+  mTransformBatches(),
+  mTransformTargets(),
+  mTransformBatchIndices(),
+  mAnimatorsChanged( true )
 {
 }
 
@@ -90,6 +103,11 @@ void Animation::operator delete( void* ptr )
   gAnimationMemoryPool.FreeThreadSafe( static_cast<Animation*>( ptr ) );
 }
 
+uint32_t Animation::TrimMemoryPool()
+{
+  return gAnimationMemoryPool.Trim();
+}
+
 void Animation::SetDuration(float durationSeconds)
 {
   mDurationSeconds = durationSeconds;
@@ -152,6 +170,7 @@ void Animation::Play()
 {
   // Sort according to end time with earlier end times coming first, if the end time is the same, then the animators are not moved
   std::stable_sort( mAnimators.Begin(), mAnimators.End(), CompareAnimatorEndTimes );
+  mAnimatorsChanged = true;
 
   mState = Playing;
 
@@ -299,6 +318,7 @@ void Animation::AddAnimator( OwnerPointer<AnimatorBase>& animator )
   animator->SetDisconnectAction( mDisconnectAction );
 
   mAnimators.PushBack( animator.Release() );
+  mAnimatorsChanged = true;
 }
 
 void Animation::Update( BufferIndex bufferIndex, float elapsedSeconds, bool& looped, bool& finished, bool& progressReached )
@@ -430,64 +450,220 @@ void Animation::UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animat
   const Vector2 playRange( mPlayRange * mDurationSeconds );
   float elapsedSecondsClamped = Clamp( mElapsedSeconds, playRange.x, playRange.y );
 
+  if( mAnimatorsChanged )
+  {
+    BuildSchedule();
+    BuildTransformBatches();
+    mAnimatorsChanged = false;
+  }
+
+  mUpdatedAnimators.clear();
+
   bool cleanup = false;
 
-  //Loop through all animators
-  for(auto& animator : mAnimators)
+  // Animators which have not started yet are not visited
+  for( uint32_t index : GetStartedAnimators( elapsedSecondsClamped ) )
   {
+    AnimatorBase* animator = mAnimators[index];
     if(animator->Orphan())
     {
       cleanup = true;
       continue;
     }
 
-    bool applied(true);
     if(animator->IsEnabled())
     {
       const float intervalDelay(animator->GetIntervalDelay());
 
-      if(elapsedSecondsClamped >= intervalDelay)
+      // Calculate a progress specific to each individual animator
+      float       progress(1.0f);
+      const float animatorDuration = animator->GetDuration();
+      if(animatorDuration > 0.0f) // animators can be "immediate"
       {
-        // Calculate a progress specific to each individual animator
-        float       progress(1.0f);
-        const float animatorDuration = animator->GetDuration();
-        if(animatorDuration > 0.0f) // animators can be "immediate"
-        {
-          progress = Clamp((elapsedSecondsClamped - intervalDelay) / animatorDuration, 0.0f, 1.0f);
-        }
-        animator->Update(bufferIndex, progress, bake);
+        progress = Clamp((elapsedSecondsClamped - intervalDelay) / animatorDuration, 0.0f, 1.0f);
+      }
+      mUpdatedAnimators.push_back( UpdatedAnimator{ index, animator->PrepareUpdate( progress ) } );
 
-        if (animatorDuration > 0.0f && (elapsedSecondsClamped - intervalDelay) <= animatorDuration)
-        {
-          mIsActive[bufferIndex] = true;
-        }
+      if (animatorDuration > 0.0f && (elapsedSecondsClamped - intervalDelay) <= animatorDuration)
+      {
+        mIsActive[bufferIndex] = true;
       }
-      applied = true;
+
+      INCREASE_COUNTER(PerformanceMonitor::ANIMATORS_APPLIED);
     }
-    else
+  }
+
+  if(animationFinished)
+  {
+    for(auto&& animator : mAnimators)
     {
-      applied = false;
+      animator->SetActive(false);
+      cleanup = cleanup || animator->Orphan();
     }
+  }
+
+  ApplyAlphaFunctions();
 
-    if(animationFinished)
+  for( auto&& updated : mUpdatedAnimators )
+  {
+    const uint32_t batchIndex = mTransformBatchIndices[ updated.index ];
+    if( batchIndex == NO_TRANSFORM_BATCH )
     {
-      animator->SetActive(false);
+      mAnimators[ updated.index ]->DoUpdate( bufferIndex, bake, updated.alpha );
+    }
+    else
+    {
+      const AnimatorBase::LinearTransformTarget& target = mTransformTargets[ updated.index ];
+      TransformBatch& batch = mTransformBatches[ batchIndex ];
+      batch.ids.push_back( target.id );
+      batch.values.push_back( target.value );
+      batch.relative.push_back( target.relative ? 1u : 0u );
+      batch.alphas.push_back( updated.alpha );
     }
+  }
 
-    if(applied)
+  for( auto&& batch : mTransformBatches )
+  {
+    if( !batch.ids.empty() )
     {
-      INCREASE_COUNTER(PerformanceMonitor::ANIMATORS_APPLIED);
+      batch.transformManager->AnimateVector3Property( batch.property, batch.ids.data(), batch.values.data(), batch.relative.data(), batch.alphas.data(), static_cast< uint32_t >( batch.ids.size() ), bake );
+
+      batch.ids.clear();
+      batch.values.clear();
+      batch.relative.clear();
+      batch.alphas.clear();
     }
   }
 
   if(cleanup)
   {
     //Remove animators whose PropertyOwner has been destroyed
-    mAnimators.Erase(std::remove_if(mAnimators.begin(),
-                                    mAnimators.end(),
-                                    [](auto& animator) { return animator->Orphan(); }),
+    //The orphans are partitioned to the end rather than removed, so Erase deletes them and not the animators which are kept
+    mAnimators.Erase(std::stable_partition(mAnimators.begin(),
+                                           mAnimators.end(),
+                                           [](auto animator) { return !animator->Orphan(); }),
                      mAnimators.end());
+    mAnimatorsChanged = true;
+  }
+}
+
+void Animation::ApplyAlphaFunctions()
+{
+  for( auto&& updated : mUpdatedAnimators )
+  {
+    const AnimatorBase& animator = *mAnimators[ updated.index ];
+    const AlphaFunction alphaFunction = animator.GetAlphaFunction();
+    if( alphaFunction.GetMode() == AlphaFunction::BUILTIN_FUNCTION )
+    {
+      const AlphaFunction::BuiltinFunction function = alphaFunction.GetBuiltinFunction();
+      if( function != AlphaFunction::DEFAULT && function != AlphaFunction::LINEAR && function != AlphaFunction::COUNT )
+      {
+        mBuiltinAlphaAnimators[ function ].push_back( &updated );
+      }
+    }
+    else
+    {
+      updated.alpha = animator.ApplyAlphaFunction( updated.alpha );
+    }
+  }
+
+  for( uint32_t function = 0u; function < AlphaFunction::COUNT; ++function )
+  {
+    std::vector< UpdatedAnimator* >& animators = mBuiltinAlphaAnimators[ function ];
+    if( !animators.empty() )
+    {
+      mAlphaValues.resize( animators.size() );
+      for( std::size_t i = 0u; i < animators.size(); ++i )
+      {
+        mAlphaValues[i] = animators[i]->alpha;
+      }
+
+      AnimatorBase::ApplyBuiltinAlphaFunction( static_cast< AlphaFunction::BuiltinFunction >( function ), mAlphaValues.data(), static_cast< uint32_t >( mAlphaValues.size() ) );
+
+      for( std::size_t i = 0u; i < animators.size(); ++i )
+      {
+        animators[i]->alpha = mAlphaValues[i];
+      }
+      animators.clear();
+    }
+  }
+}
+
+void Animation::BuildTransformBatches()
+{
+  mTransformBatches.clear();
+
+  const uint32_t animatorCount = static_cast< uint32_t >( mAnimators.Count() );
+  mTransformTargets.resize( animatorCount );
+  mTransformBatchIndices.assign( animatorCount, NO_TRANSFORM_BATCH );
+
+  std::vector< uint8_t > batchable( animatorCount, 0u );
+  std::unordered_set< const PropertyOwner* > unbatchedOwners;
+  for( uint32_t index = 0u; index < animatorCount; ++index )
+  {
+    AnimatorBase* animator = mAnimators[index];
+    if( !animator->Orphan() )
+    {
+      if( animator->GetLinearTransformTarget( mTransformTargets[index] ) && mTransformTargets[index].id != INVALID_TRANSFORM_ID )
+      {
+        batchable[index] = 1u;
+      }
+      else
+      {
+        unbatchedOwners.insert( animator->GetPropertyOwner() );
+      }
+    }
+  }
+
+  for( uint32_t index = 0u; index < animatorCount; ++index )
+  {
+    if( batchable[index] && !unbatchedOwners.count( mAnimators[index]->GetPropertyOwner() ) )
+    {
+      const AnimatorBase::LinearTransformTarget& target = mTransformTargets[index];
+      auto batch = std::find_if( mTransformBatches.begin(), mTransformBatches.end(),
+                                 [&target]( const TransformBatch& batch ) { return batch.transformManager == target.transformManager && batch.property == target.property; } );
+      if( batch == mTransformBatches.end() )
+      {
+        batch = mTransformBatches.insert( mTransformBatches.end(), TransformBatch{ target.transformManager, target.property, {}, {}, {}, {} } );
+      }
+      mTransformBatchIndices[index] = static_cast< uint32_t >( batch - mTransformBatches.begin() );
+    }
+  }
+}
+
+void Animation::BuildSchedule()
+{
+  const uint32_t animatorCount = static_cast< uint32_t >( mAnimators.Count() );
+  mAnimatorsByStartTime.resize( animatorCount );
+  for( uint32_t index = 0u; index < animatorCount; ++index )
+  {
+    mAnimatorsByStartTime[index] = index;
+  }
+  std::stable_sort( mAnimatorsByStartTime.begin(), mAnimatorsByStartTime.end(),
+                    [this]( uint32_t lhs, uint32_t rhs ) { return mAnimators[lhs]->GetIntervalDelay() < mAnimators[rhs]->GetIntervalDelay(); } );
+
+  mStartTimes.resize( animatorCount );
+  for( uint32_t i = 0u; i < animatorCount; ++i )
+  {
+    mStartTimes[i] = mAnimators[ mAnimatorsByStartTime[i] ]->GetIntervalDelay();
+  }
+
+  // Rebuilt by the next GetStartedAnimators()
+  mStartedAnimators.clear();
+  mStartedCount = std::numeric_limits< uint32_t >::max();
+}
+
+const std::vector< uint32_t >& Animation::GetStartedAnimators( float elapsedSeconds )
+{
+  const uint32_t startedCount = static_cast< uint32_t >( std::upper_bound( mStartTimes.begin(), mStartTimes.end(), elapsedSeconds ) - mStartTimes.begin() );
+  if( startedCount != mStartedCount )
+  {
+    // The animators are updated in the order of mAnimators, as their end times decide which one wins
+    mStartedAnimators.assign( mAnimatorsByStartTime.begin(), mAnimatorsByStartTime.begin() + startedCount );
+    std::sort( mStartedAnimators.begin(), mStartedAnimators.end() );
+    mStartedCount = startedCount;
   }
+  return mStartedAnimators;
 }
 
 } // namespace SceneGraph
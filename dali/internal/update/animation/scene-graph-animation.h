@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/animation/animation.h>
 
@@ -77,6 +80,12 @@ public:
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the memory of the animation memory pool which no animation is using.
+   * @return The number of bytes released
+   */
+  static uint32_t TrimMemoryPool();
+
   /**
    * Set the duration of an animation.
    * @pre durationSeconds must be greater than zero.
@@ -307,6 +316,15 @@ protected:
 
 private:
 
+  /**
+   * An animator which has been updated in the current frame
+   */
+  struct UpdatedAnimator
+  {
+    uint32_t index; ///< The index of the animator in mAnimators
+    float    alpha; ///< The progress of the animator, and then its alpha value
+  };
+
   /**
    * Helper for Update, also used to bake when the animation is stopped or destroyed.
    * @param[in] bufferIndex The buffer to update.
@@ -315,6 +333,32 @@ private:
    */
   void UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animationFinished );
 
+  /**
+   * Helper for UpdateAnimators, applies the alpha function of each animator in mUpdatedAnimators,
+   * replacing its progress by the alpha value. Animators with the same builtin alpha function are done together.
+   */
+  void ApplyAlphaFunctions();
+
+  /**
+   * Groups the animators which move a transform manager property linearly by property, see
+   * AnimatorBase::GetLinearTransformTarget(). Animators of a property owner which also has other
+   * animators are left out, so that every property owner's animators are still updated in order.
+   */
+  void BuildTransformBatches();
+
+  /**
+   * Sorts the animators by their interval delay, so that the ones which have not started yet
+   * need not be visited by UpdateAnimators.
+   */
+  void BuildSchedule();
+
+  /**
+   * Retrieves the animators which have started at a time, in the order of mAnimators.
+   * @param[in] elapsedSeconds The time
+   * @return The indices of the animators
+   */
+  const std::vector< uint32_t >& GetStartedAnimators( float elapsedSeconds );
+
   /**
    * Helper function to bake the result of the animation when it is stopped or
    * destroyed.
@@ -360,6 +404,36 @@ protected:
   bool mProgressReachedSignalRequired;  // Flag to indicate the progress marker was hit
   bool mAutoReverseEnabled;             // Flag to identify that the looping mode is auto reverse.
   bool mIsActive[2];                    // Flag to indicate whether the animation is active in the current frame (which is double buffered)
+
+private:
+
+  /**
+   * Animators of one transform manager property, which are updated with a single call
+   */
+  struct TransformBatch
+  {
+    TransformManager*          transformManager;
+    TransformManagerProperty   property;
+    std::vector< TransformId > ids;      ///< The components of the animators updated in the current frame
+    std::vector< Vector3 >     values;   ///< The target or relative value of each of those animators
+    std::vector< uint8_t >     relative; ///< Whether each value is relative
+    std::vector< float >       alphas;   ///< The alpha value of each of those animators
+  };
+
+  std::vector< uint32_t > mAnimatorsByStartTime;      // The indices of the animators, in order of their interval delay
+  std::vector< float > mStartTimes;                   // The interval delays of mAnimatorsByStartTime
+  std::vector< uint32_t > mStartedAnimators;          // The indices of the animators started at mStartedCount, in order
+  uint32_t mStartedCount;                             // The number of animators started when mStartedAnimators was built
+
+  std::vector< TransformBatch > mTransformBatches;
+  std::vector< AnimatorBase::LinearTransformTarget > mTransformTargets; // The target of each animator in one of mTransformBatches
+  std::vector< uint32_t > mTransformBatchIndices;     // The index of the batch of each animator, or NO_TRANSFORM_BATCH
+
+  std::vector< UpdatedAnimator > mUpdatedAnimators;   // The animators updated in the current frame, kept to avoid allocating every frame
+  std::vector< UpdatedAnimator* > mBuiltinAlphaAnimators[ AlphaFunction::COUNT ]; // The updated animators of each builtin alpha function
+  std::vector< float > mAlphaValues;                  // The values one builtin alpha function is applied to
+
+  bool mAnimatorsChanged;                             // Whether the animators have changed since the schedule and batches were built
 };
 
 }; //namespace SceneGraph
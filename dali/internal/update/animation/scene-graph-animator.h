@@ -46,6 +46,9 @@ namespace Internal
 
 using Interpolation = Dali::Animation::Interpolation;
 
+struct AnimateToVector3;
+struct AnimateByVector3;
+
 
 namespace SceneGraph
 {
@@ -60,6 +63,18 @@ public:
 
   using AlphaFunc = float (*)(float progress); ///< Definition of an alpha function
 
+  /**
+   * A transform manager Vector3 property moved linearly towards, or by, a value
+   */
+  struct LinearTransformTarget
+  {
+    TransformManager*        transformManager; ///< The transform manager owning the property
+    TransformId              id;               ///< The transform component
+    TransformManagerProperty property;         ///< The property
+    Vector3                  value;            ///< The target value, or the relative value
+    bool                     relative;         ///< Whether value is relative to the current value
+  };
+
   /**
    * Observer to determine when the animator is no longer present
    */
@@ -275,80 +290,7 @@ public:
     AlphaFunction::Mode alphaFunctionMode( mAlphaFunction.GetMode() );
     if( alphaFunctionMode == AlphaFunction::BUILTIN_FUNCTION )
     {
-      switch(mAlphaFunction.GetBuiltinFunction())
-      {
-        case AlphaFunction::DEFAULT:
-        case AlphaFunction::LINEAR:
-        {
-          break;
-        }
-        case AlphaFunction::REVERSE:
-        {
-          result = 1.0f-progress;
-          break;
-        }
-        case AlphaFunction::EASE_IN_SQUARE:
-        {
-          result = progress * progress;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_SQUARE:
-        {
-          result = 1.0f - (1.0f-progress) * (1.0f-progress);
-          break;
-        }
-        case AlphaFunction::EASE_IN:
-        {
-          result = progress * progress * progress;
-          break;
-        }
-        case AlphaFunction::EASE_OUT:
-        {
-          result = (progress-1.0f) * (progress-1.0f) * (progress-1.0f) + 1.0f;
-          break;
-        }
-        case AlphaFunction::EASE_IN_OUT:
-        {
-          result = progress*progress*(3.0f-2.0f*progress);
-          break;
-        }
-        case AlphaFunction::EASE_IN_SINE:
-        {
-          result = -1.0f * cosf(progress * Math::PI_2) + 1.0f;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_SINE:
-        {
-          result = sinf(progress * Math::PI_2);
-          break;
-        }
-        case AlphaFunction::EASE_IN_OUT_SINE:
-        {
-          result = -0.5f * (cosf(Math::PI * progress) - 1.0f);
-          break;
-        }
-        case AlphaFunction::BOUNCE:
-        {
-          result = sinf(progress * Math::PI);
-          break;
-        }
-        case AlphaFunction::SIN:
-        {
-          result = 0.5f - cosf(progress * 2.0f * Math::PI) * 0.5f;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_BACK:
-        {
-          const float sqrt2 = 1.70158f;
-          progress -= 1.0f;
-          result = 1.0f + progress * progress * ( ( sqrt2 + 1.0f ) * progress + sqrt2 );
-          break;
-        }
-        case AlphaFunction::COUNT:
-        {
-          break;
-        }
-      }
+      ApplyBuiltinAlphaFunction( mAlphaFunction.GetBuiltinFunction(), &result, 1u );
     }
     else if(  alphaFunctionMode == AlphaFunction::CUSTOM_FUNCTION )
     {
@@ -393,6 +335,90 @@ public:
     return result;
   }
 
+  /**
+   * Applies a builtin alpha function to many progress values at once
+   * @param[in] function The builtin alpha function
+   * @param[in,out] values The progress values, replaced by the results
+   * @param[in] count The number of values
+   */
+  static void ApplyBuiltinAlphaFunction( AlphaFunction::BuiltinFunction function, float* values, uint32_t count )
+  {
+    switch( function )
+    {
+      case AlphaFunction::DEFAULT:
+      case AlphaFunction::LINEAR:
+      case AlphaFunction::COUNT:
+      {
+        break;
+      }
+      case AlphaFunction::REVERSE:
+      {
+        ApplyToEach( values, count, []( float progress ) { return 1.0f-progress; } );
+        break;
+      }
+      case AlphaFunction::EASE_IN_SQUARE:
+      {
+        ApplyToEach( values, count, []( float progress ) { return progress * progress; } );
+        break;
+      }
+      case AlphaFunction::EASE_OUT_SQUARE:
+      {
+        ApplyToEach( values, count, []( float progress ) { return 1.0f - (1.0f-progress) * (1.0f-progress); } );
+        break;
+      }
+      case AlphaFunction::EASE_IN:
+      {
+        ApplyToEach( values, count, []( float progress ) { return progress * progress * progress; } );
+        break;
+      }
+      case AlphaFunction::EASE_OUT:
+      {
+        ApplyToEach( values, count, []( float progress ) { return (progress-1.0f) * (progress-1.0f) * (progress-1.0f) + 1.0f; } );
+        break;
+      }
+      case AlphaFunction::EASE_IN_OUT:
+      {
+        ApplyToEach( values, count, []( float progress ) { return progress*progress*(3.0f-2.0f*progress); } );
+        break;
+      }
+      case AlphaFunction::EASE_IN_SINE:
+      {
+        ApplyToEach( values, count, []( float progress ) { return -1.0f * cosf(progress * Math::PI_2) + 1.0f; } );
+        break;
+      }
+      case AlphaFunction::EASE_OUT_SINE:
+      {
+        ApplyToEach( values, count, []( float progress ) { return sinf(progress * Math::PI_2); } );
+        break;
+      }
+      case AlphaFunction::EASE_IN_OUT_SINE:
+      {
+        ApplyToEach( values, count, []( float progress ) { return -0.5f * (cosf(Math::PI * progress) - 1.0f); } );
+        break;
+      }
+      case AlphaFunction::BOUNCE:
+      {
+        ApplyToEach( values, count, []( float progress ) { return sinf(progress * Math::PI); } );
+        break;
+      }
+      case AlphaFunction::SIN:
+      {
+        ApplyToEach( values, count, []( float progress ) { return 0.5f - cosf(progress * 2.0f * Math::PI) * 0.5f; } );
+        break;
+      }
+      case AlphaFunction::EASE_OUT_BACK:
+      {
+        ApplyToEach( values, count, []( float progress )
+        {
+          const float sqrt2 = 1.70158f;
+          progress -= 1.0f;
+          return 1.0f + progress * progress * ( ( sqrt2 + 1.0f ) * progress + sqrt2 );
+        } );
+        break;
+      }
+    }
+  }
+
   /**
    * Whether to bake the animation if attached property owner is disconnected.
    * Property is only baked if the animator is active.
@@ -459,6 +485,19 @@ public:
    * @param[in] bake Bake.
    */
   void Update( BufferIndex bufferIndex, float progress, bool bake )
+  {
+    float alpha = ApplyAlphaFunction( PrepareUpdate( progress ) );
+
+    // PropertyType specific part
+    DoUpdate( bufferIndex, bake, alpha );
+  }
+
+  /**
+   * The part of Update() before the alpha function is applied, for updating many animators together.
+   * @param[in] progress A value from 0 to 1, where 0 is the start of the animation, and 1 is the end point.
+   * @return The progress to apply the alpha function to
+   */
+  float PrepareUpdate( float progress )
   {
     if( mLoopCount >= 0 )
     {
@@ -471,12 +510,29 @@ public:
       mPropertyOwner->SetUpdated( true );
     }
 
-    float alpha = ApplyAlphaFunction( progress );
+    mCurrentProgress = progress;
+    return progress;
+  }
 
-    // PropertyType specific part
-    DoUpdate( bufferIndex, bake, alpha );
+  /**
+   * Retrieve the target of an animator which moves a transform manager Vector3 property linearly.
+   * Such animators of an animation are updated together with TransformManager::AnimateVector3Property()
+   * instead of DoUpdate().
+   * @param[out] target The target
+   * @return False if the animator is of another kind
+   */
+  virtual bool GetLinearTransformTarget( LinearTransformTarget& target ) const
+  {
+    return false;
+  }
 
-    mCurrentProgress = progress;
+  /**
+   * Retrieve the property owner of the animator
+   * @return The property owner, or nullptr if it has been destroyed
+   */
+  PropertyOwner* GetPropertyOwner() const
+  {
+    return mPropertyOwner;
   }
 
   /**
@@ -489,6 +545,18 @@ public:
 
 protected:
 
+  /**
+   * Helper to apply a function to every value of an array, in a loop the compiler can vectorize
+   */
+  template< typename Function >
+  static void ApplyToEach( float* values, uint32_t count, Function function )
+  {
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      values[i] = function( values[i] );
+    }
+  }
+
   /**
    * Helper function to evaluate a cubic bezier curve assuming first point is at 0.0 and last point is at 1.0
    * @param[in] p0 First control point of the bezier curve
@@ -661,6 +729,34 @@ public:
     }
   }
 
+  /**
+   * @copydoc AnimatorBase::GetLinearTransformTarget()
+   */
+  bool GetLinearTransformTarget( LinearTransformTarget& target ) const final
+  {
+    if constexpr( std::is_same< PropertyAccessorType, TransformManagerPropertyAccessor< Vector3 > >::value )
+    {
+      // Only the whole value animated with AnimateTo() or AnimateBy(), of the properties which have a base value
+      const auto* property = static_cast< const TransformManagerPropertyVector3* >( mPropertyAccessor.GetProperty() );
+      if( property->mProperty != TRANSFORM_PROPERTY_POSITION && property->mProperty != TRANSFORM_PROPERTY_SCALE && property->mProperty != TRANSFORM_PROPERTY_SIZE )
+      {
+        return false;
+      }
+
+      if( const auto* animateTo = mAnimatorFunction.template target< AnimateToVector3 >() )
+      {
+        target = LinearTransformTarget{ property->mTxManager, property->mId, property->mProperty, animateTo->mTarget, false };
+        return true;
+      }
+      if( const auto* animateBy = mAnimatorFunction.template target< AnimateByVector3 >() )
+      {
+        target = LinearTransformTarget{ property->mTxManager, property->mId, property->mProperty, animateBy->mRelative, true };
+        return true;
+      }
+    }
+    return false;
+  }
+
 private:
 
   /**
@@ -976,6 +1072,10 @@ struct KeyFrameIntegerFunctor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    if(mInterpolation == Dali::Animation::CUBIC)
+    {
+      mKeyFrames.PrepareCubicInterpolation();
+    }
   }
 
   float operator()(float progress, const int32_t& property)
@@ -997,6 +1097,10 @@ struct KeyFrameNumberFunctor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    if(mInterpolation == Dali::Animation::CUBIC)
+    {
+      mKeyFrames.PrepareCubicInterpolation();
+    }
   }
 
   float operator()(float progress, const float& property)
@@ -1018,6 +1122,10 @@ struct KeyFrameVector2Functor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    if(mInterpolation == Dali::Animation::CUBIC)
+    {
+      mKeyFrames.PrepareCubicInterpolation();
+    }
   }
 
   Vector2 operator()(float progress, const Vector2& property)
@@ -1039,6 +1147,10 @@ struct KeyFrameVector3Functor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    if(mInterpolation == Dali::Animation::CUBIC)
+    {
+      mKeyFrames.PrepareCubicInterpolation();
+    }
   }
 
   Vector3 operator()(float progress, const Vector3& property)
@@ -1060,6 +1172,10 @@ struct KeyFrameVector4Functor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    if(mInterpolation == Dali::Animation::CUBIC)
+    {
+      mKeyFrames.PrepareCubicInterpolation();
+    }
   }
 
   Vector4 operator()(float progress, const Vector4& property)
@@ -2117,8 +2117,8 @@ void BakeMessage( EventThreadServices& eventThreadServices,
 {
   using LocalType = MessageDoubleBuffered1<SceneGraph::AnimatableProperty<T>, T>;
 
-  // Reserve some memory inside the message queue
-  uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+  // Reserve some memory inside the message queue; this supersedes any previous bake of the property
+  uint32_t* slot = eventThreadServices.ReservePropertyMessageSlot( sizeof( LocalType ), &property );
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new (slot) LocalType( &property,
@@ -90,7 +90,9 @@ public:
                     typename ParameterType< P >::PassingType value )
   {
     // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyMessage ) );
+    // Baking the whole value supersedes any previous bake of the property
+    uint32_t* slot = ( member == &AnimatableProperty<P>::Bake ) ? eventThreadServices.ReservePropertyMessageSlot( sizeof( AnimatablePropertyMessage ), property )
+                                                                 : eventThreadServices.ReserveMessageSlot( sizeof( AnimatablePropertyMessage ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) AnimatablePropertyMessage( sceneObject, property, member, value );
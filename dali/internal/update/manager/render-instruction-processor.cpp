@@ -18,8 +18,14 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/render-instruction-processor.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/layer.h>
+#include <dali/devel-api/threading/thread-pool.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/event/actors/layer-impl.h> // for the default sorting function
 #include <dali/internal/update/manager/sorted-layers.h>
@@ -52,6 +58,61 @@ namespace SceneGraph
 namespace
 {
 
+// Frames with fewer renderables than this have their render lists built serially
+const uint32_t MINIMUM_RENDERABLE_COUNT_FOR_PARALLEL_PREPARE = 256u;
+
+// The shader, texture set and geometry of an item are each given an id of this many bits in its sort key
+const uint32_t SORT_ID_BITS = 21u;
+const uint32_t MAXIMUM_SORT_ID = ( 1u << SORT_ID_BITS ) - 1u;
+
+// The clipping sort modifier shares the primary sort key with the opacity and the z value
+const uint32_t MAXIMUM_CLIPPING_SORT_MODIFIER = 0x7FFFFFFFu;
+
+/**
+ * @brief Gets the bits of a float as an unsigned integer which sorts in the same order as the float.
+ * @param[in] value The float
+ * @return The sortable bits
+ */
+inline uint32_t GetSortableBits( float value )
+{
+  value += 0.0f; // -0.0f and 0.0f compare equal, so give them the same bits
+  uint32_t bits;
+  memcpy( &bits, &value, sizeof( bits ) );
+
+  // Negative floats sort in reverse order of their bits
+  return ( bits & 0x80000000u ) ? ~bits : ( bits | 0x80000000u );
+}
+
+/**
+ * @brief Gets a small id for a pointer, which is smaller for the pointers seen first.
+ * Sorting by ids instead of pointers groups the same items together, without depending on where they are allocated.
+ * @param[in,out] ids Hash table of the ids given so far, with a power of two size
+ * @param[in,out] nextId The id to give to the next new pointer
+ * @param[in] pointer The pointer, which has id 0 if it is null
+ * @return The id of the pointer
+ */
+inline uint32_t GetSortId( std::vector< std::pair< const void*, uint32_t > >& ids, uint32_t& nextId, const void* pointer )
+{
+  if( !pointer )
+  {
+    return 0u;
+  }
+
+  const std::size_t mask = ids.size() - 1u;
+  std::size_t slot = static_cast<std::size_t>( ( reinterpret_cast<uintptr_t>( pointer ) >> 3u ) * 2654435761u ) & mask;
+  while( ids[ slot ].first && ids[ slot ].first != pointer )
+  {
+    slot = ( slot + 1u ) & mask;
+  }
+
+  if( !ids[ slot ].first )
+  {
+    ids[ slot ].first = pointer;
+    ids[ slot ].second = nextId++;
+  }
+  return ids[ slot ].second;
+}
+
 /**
  * Function which compares render items by shader/textureSet/geometry
  * @param[in] lhs Left hand side item
@@ -81,8 +142,6 @@ inline bool PartialCompareItems( const RenderInstructionProcessor::SortAttribute
  */
 bool CompareItems( const RenderInstructionProcessor::SortAttributes& lhs, const RenderInstructionProcessor::SortAttributes& rhs )
 {
-  // @todo Consider replacing all these sortAttributes with a single long int that
-  // encapsulates the same data (e.g. the middle-order bits of the ptrs).
   if( lhs.renderItem->mDepthIndex == rhs.renderItem->mDepthIndex )
   {
     return PartialCompareItems( lhs, rhs );
@@ -335,7 +394,9 @@ inline bool SetupRenderList( RenderableContainer& renderables,
 
 
 RenderInstructionProcessor::RenderInstructionProcessor()
-: mSortingHelper()
+: mSortingHelpers( 1u ),
+  mRenderListJobs(),
+  mThreadPool( nullptr )
 {
   // Set up a container of comparators for fast run-time selection.
   mSortComparitors.Reserve( 3u );
@@ -347,23 +408,32 @@ RenderInstructionProcessor::RenderInstructionProcessor()
 
 RenderInstructionProcessor::~RenderInstructionProcessor() = default;
 
-inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder )
+void RenderInstructionProcessor::SetThreadPool( ThreadPool* threadPool )
+{
+  mThreadPool = threadPool;
+
+  // One sorting helper for the calling thread and one for each worker thread
+  mSortingHelpers.resize( threadPool ? threadPool->GetWorkerCount() + 1u : 1u );
+}
+
+inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder, SortingHelper& sortingHelper )
 {
   const uint32_t renderableCount = static_cast<uint32_t>( renderList.Count() );
+  std::vector< SortAttributes >& attributes = sortingHelper.attributes;
   // Reserve space if needed.
-  const uint32_t oldcapacity = static_cast<uint32_t>( mSortingHelper.size() );
+  const uint32_t oldcapacity = static_cast<uint32_t>( attributes.size() );
   if( oldcapacity < renderableCount )
   {
-    mSortingHelper.reserve( renderableCount );
+    attributes.reserve( renderableCount );
     // Add real objects (reserve does not construct objects).
-    mSortingHelper.insert( mSortingHelper.begin() + oldcapacity,
+    attributes.insert( attributes.begin() + oldcapacity,
                           (renderableCount - oldcapacity),
                           RenderInstructionProcessor::SortAttributes() );
   }
   else
   {
     // Clear extra elements from helper, does not decrease capability.
-    mSortingHelper.resize( renderableCount );
+    attributes.resize( renderableCount );
   }
 
   // Calculate the sorting value, once per item by calling the layers sort function.
@@ -376,17 +446,17 @@ inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex
 
       if( item.mRenderer )
       {
-        item.mRenderer->SetSortAttributes( bufferIndex, mSortingHelper[ index ] );
+        item.mRenderer->SetSortAttributes( bufferIndex, attributes[ index ] );
       }
 
       // texture set
-      mSortingHelper[ index ].textureSet = item.mTextureSet;
+      attributes[ index ].textureSet = item.mTextureSet;
 
       // The default sorting function should get inlined here.
-      mSortingHelper[ index ].zValue = Internal::Layer::ZValue( item.mModelViewMatrix.GetTranslation3() ) - static_cast<float>( item.mDepthIndex );
+      attributes[ index ].zValue = Internal::Layer::ZValue( item.mModelViewMatrix.GetTranslation3() ) - static_cast<float>( item.mDepthIndex );
 
       // Keep the renderitem pointer in the helper so we can quickly reorder items after sort.
-      mSortingHelper[ index ].renderItem = &item;
+      attributes[ index ].renderItem = &item;
     }
   }
   else
@@ -396,16 +466,16 @@ inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex
     {
       RenderItem& item = renderList.GetItem( index );
 
-      item.mRenderer->SetSortAttributes( bufferIndex, mSortingHelper[ index ] );
+      item.mRenderer->SetSortAttributes( bufferIndex, attributes[ index ] );
 
       // texture set
-      mSortingHelper[ index ].textureSet = item.mTextureSet;
+      attributes[ index ].textureSet = item.mTextureSet;
 
 
-      mSortingHelper[ index ].zValue = (*sortFunction)( item.mModelViewMatrix.GetTranslation3() ) - static_cast<float>( item.mDepthIndex );
+      attributes[ index ].zValue = (*sortFunction)( item.mModelViewMatrix.GetTranslation3() ) - static_cast<float>( item.mDepthIndex );
 
       // Keep the RenderItem pointer in the helper so we can quickly reorder items after sort.
-      mSortingHelper[ index ].renderItem = &item;
+      attributes[ index ].renderItem = &item;
     }
   }
 
@@ -415,16 +485,99 @@ inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex
   //   2 is LAYER_3D + Clipping
   const unsigned int comparitorIndex = layer.GetBehavior() == Dali::Layer::LAYER_3D ? respectClippingOrder ? 2u : 1u : 0u;
 
-  std::stable_sort( mSortingHelper.begin(), mSortingHelper.end(), mSortComparitors[ comparitorIndex ] );
-
   // Reorder / re-populate the RenderItems in the RenderList to correct order based on the sortinghelper.
   DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "Sorted Transparent List:\n");
   RenderItemContainer::Iterator renderListIter = renderList.GetContainer().Begin();
-  for( uint32_t index = 0; index < renderableCount; ++index, ++renderListIter )
+  if( RadixSortRenderItems( sortingHelper, comparitorIndex ) )
+  {
+    for( uint32_t index = 0; index < renderableCount; ++index, ++renderListIter )
+    {
+      *renderListIter = attributes[ sortingHelper.keys[ index ].index ].renderItem;
+      DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, ( *renderListIter )->mRenderer );
+    }
+  }
+  else
+  {
+    std::stable_sort( attributes.begin(), attributes.end(), mSortComparitors[ comparitorIndex ] );
+
+    for( uint32_t index = 0; index < renderableCount; ++index, ++renderListIter )
+    {
+      *renderListIter = attributes[ index ].renderItem;
+      DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, attributes[ index ].renderItem->mRenderer);
+    }
+  }
+}
+
+bool RenderInstructionProcessor::RadixSortRenderItems( SortingHelper& sortingHelper, uint32_t comparitorIndex )
+{
+  const std::vector< SortAttributes >& attributes = sortingHelper.attributes;
+  const uint32_t renderableCount = static_cast<uint32_t>( attributes.size() );
+
+  // Each item can add three pointers to the table, which needs to stay sparse
+  if( 3u * renderableCount > MAXIMUM_SORT_ID )
+  {
+    return false;
+  }
+  uint32_t tableSize = 16u;
+  while( tableSize < 6u * renderableCount )
+  {
+    tableSize <<= 1u;
+  }
+  sortingHelper.ids.assign( tableSize, std::pair< const void*, uint32_t >( nullptr, 0u ) );
+  uint32_t nextId = 1u;
+
+  std::vector< RadixSortItem >& keys = sortingHelper.keys;
+  keys.resize( renderableCount );
+  for( uint32_t index = 0; index < renderableCount; ++index )
   {
-    *renderListIter = mSortingHelper[ index ].renderItem;
-    DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, mSortingHelper[ index ].renderItem->mRenderer);
+    const SortAttributes& itemAttributes = attributes[ index ];
+    const RenderItem& item = *itemAttributes.renderItem;
+
+    // The primary key holds what the comparitor sorts by before the shader, texture set and geometry
+    uint64_t primaryKey;
+    if( comparitorIndex == 0u )
+    {
+      // Depth index, which is signed
+      primaryKey = static_cast<uint32_t>( item.mDepthIndex ) ^ 0x80000000u;
+    }
+    else
+    {
+      // Opaque items first, then transparent items from back to front
+      primaryKey = item.mIsOpaque ? 0u : ( uint64_t( 1u ) << 32u ) | ~GetSortableBits( itemAttributes.zValue );
+
+      if( comparitorIndex == 2u )
+      {
+        const uint32_t clippingSortModifier = item.mNode->mClippingSortModifier;
+        if( clippingSortModifier > MAXIMUM_CLIPPING_SORT_MODIFIER )
+        {
+          return false;
+        }
+        primaryKey |= uint64_t( clippingSortModifier ) << 33u;
+      }
+    }
+
+    keys[ index ].primaryKey = primaryKey;
+    keys[ index ].secondaryKey = ( uint64_t( GetSortId( sortingHelper.ids, nextId, itemAttributes.shader ) ) << ( 2u * SORT_ID_BITS ) ) |
+                                 ( uint64_t( GetSortId( sortingHelper.ids, nextId, itemAttributes.textureSet ) ) << SORT_ID_BITS ) |
+                                 uint64_t( GetSortId( sortingHelper.ids, nextId, itemAttributes.geometry ) );
+    keys[ index ].index = index;
   }
+
+  RadixSort( keys, sortingHelper.keyBuffer );
+  return true;
+}
+
+void RenderInstructionProcessor::ProcessRenderListJob( BufferIndex updateBufferIndex, const RenderListJob& job, const Matrix& viewMatrix, Camera& camera, bool cull, SortingHelper& sortingHelper )
+{
+  AddRenderersToRenderList( updateBufferIndex,
+                            *job.renderList,
+                            job.isOverlay ? job.layer->overlayRenderables : job.layer->colorRenderables,
+                            viewMatrix,
+                            camera,
+                            job.layer->GetBehavior() == Dali::Layer::LAYER_3D,
+                            cull );
+
+  SortRenderItems( updateBufferIndex, *job.renderList, *job.layer, job.respectClippingOrder, sortingHelper );
 }
 
 void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
@@ -444,12 +597,16 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
   const Matrix& viewMatrix = renderTask.GetViewMatrix( updateBufferIndex );
   SceneGraph::Camera& camera = renderTask.GetCamera();
 
+  // Set up the render lists of every layer first, so the order of the render lists does not depend on
+  // the order they are built in
+  mRenderListJobs.clear();
+  uint32_t renderableCount = 0u;
+
   const SortedLayersIter endIter = sortedLayers.end();
   for( SortedLayersIter iter = sortedLayers.begin(); iter != endIter; ++iter )
   {
     Layer& layer = **iter;
     const bool tryReuseRenderList( viewMatrixHasNotChanged && layer.CanReuseRenderers( &renderTask.GetCamera() ) );
-    const bool isLayer3D = layer.GetBehavior() == Dali::Layer::LAYER_3D;
     RenderList* renderList = nullptr;
 
     if( layer.IsRoot() && ( layer.GetDirtyFlags() != NodePropertyFlags::NOTHING ) )
@@ -465,16 +622,10 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
       if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, &renderList ) )
       {
         renderList->SetHasColorRenderItems( true );
-        AddRenderersToRenderList( updateBufferIndex,
-                                  *renderList,
-                                  renderables,
-                                  viewMatrix,
-                                  camera,
-                                  isLayer3D,
-                                  cull );
 
         // We only use the clipping version of the sort comparitor if any clipping nodes exist within the RenderList.
-        SortRenderItems( updateBufferIndex, *renderList, layer, hasClippingNodes );
+        mRenderListJobs.push_back( { renderList, &layer, false, hasClippingNodes } );
+        renderableCount += static_cast<uint32_t>( renderables.Size() );
       }
 
       isRenderListAdded = true;
@@ -487,22 +638,62 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
       if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, &renderList ) )
       {
         renderList->SetHasColorRenderItems( false );
-        AddRenderersToRenderList( updateBufferIndex,
-                                  *renderList,
-                                  renderables,
-                                  viewMatrix,
-                                  camera,
-                                  isLayer3D,
-                                  cull );
 
         // Clipping hierarchy is irrelevant when sorting overlay items, so we specify using the non-clipping version of the sort comparitor.
-        SortRenderItems( updateBufferIndex, *renderList, layer, false );
+        mRenderListJobs.push_back( { renderList, &layer, true, false } );
+        renderableCount += static_cast<uint32_t>( renderables.Size() );
       }
 
       isRenderListAdded = true;
     }
   }
 
+  const uint32_t jobCount = static_cast<uint32_t>( mRenderListJobs.size() );
+  const uint32_t taskCount = mThreadPool ? std::min( static_cast<uint32_t>( mSortingHelpers.size() ), jobCount ) : 1u;
+  if( taskCount < 2u || renderableCount < MINIMUM_RENDERABLE_COUNT_FOR_PARALLEL_PREPARE )
+  {
+    for( auto&& job : mRenderListJobs )
+    {
+      ProcessRenderListJob( updateBufferIndex, job, viewMatrix, camera, cull, mSortingHelpers[0] );
+    }
+  }
+  else
+  {
+    // Render items are allocated from a pool shared by all the render lists, so allocate them before going parallel
+    for( auto&& job : mRenderListJobs )
+    {
+      RenderableContainer& renderables = job.isOverlay ? job.layer->overlayRenderables : job.layer->colorRenderables;
+      job.renderList->ReserveFreeItems( static_cast<uint32_t>( renderables.Size() ) );
+    }
+
+    // Each render list is built by a single thread; the threads take the next unprocessed list until there is none left
+    std::atomic<uint32_t> nextJob( 0u );
+    auto processJobs = [this, updateBufferIndex, &viewMatrix, &camera, cull, jobCount, &nextJob]( uint32_t sortingHelperIndex )
+    {
+      for( uint32_t job = nextJob++; job < jobCount; job = nextJob++ )
+      {
+        ProcessRenderListJob( updateBufferIndex, mRenderListJobs[job], viewMatrix, camera, cull, mSortingHelpers[sortingHelperIndex] );
+      }
+    };
+
+    std::vector<SharedFuture> futures;
+    futures.reserve( taskCount - 1u );
+    for( uint32_t task = 1u; task < taskCount; ++task )
+    {
+      futures.push_back( mThreadPool->SubmitTask( task - 1u, [&processJobs, task]( uint32_t )
+      {
+        processJobs( task );
+      } ) );
+    }
+
+    processJobs( 0u );
+
+    for( auto&& future : futures )
+    {
+      future->Wait();
+    }
+  }
+
   // Inform the render instruction that all renderers have been added and this frame is complete.
   instruction.UpdateCompleted();
 
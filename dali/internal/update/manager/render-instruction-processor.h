@@ -18,14 +18,22 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <utility>
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/buffer-index.h>
+#include <dali/internal/common/radix-sort.h>
 #include <dali/internal/update/manager/sorted-layers.h>
 #include <dali/public-api/common/dali-vector.h>
 
 namespace Dali
 {
 
+class Matrix;
+class ThreadPool;
+
 namespace Internal
 {
 
@@ -38,6 +46,7 @@ namespace SceneGraph
 {
 
 class RenderTracker;
+class Camera;
 struct RenderItem;
 class Shader;
 struct RenderList;
@@ -109,6 +118,14 @@ public:
                 bool hasClippingNodes,
                 RenderInstructionContainer& instructions );
 
+  /**
+   * @brief Sets the thread pool used to build the render lists of several layers concurrently.
+   * The render lists are built on the calling thread if there is no thread pool.
+   * The contents and order of the render instructions do not depend on the thread pool.
+   * @param[in] threadPool The thread pool to use, or nullptr. It is not owned
+   */
+  void SetThreadPool( ThreadPool* threadPool );
+
 private:
 
   /**
@@ -119,22 +136,64 @@ private:
 
 private:
 
+  /**
+   * @brief Scratch buffers used to sort the items of a render list
+   */
+  struct SortingHelper
+  {
+    std::vector< SortAttributes > attributes;              ///< The sort attributes of each item
+    std::vector< RadixSortItem > keys;                     ///< The sort key of each item
+    std::vector< RadixSortItem > keyBuffer;                ///< Scratch storage for the radix sort
+    std::vector< std::pair< const void*, uint32_t > > ids; ///< Hash table giving small ids to the shaders, texture sets and geometries
+  };
+
+  /**
+   * @brief A render list whose items have to be added and sorted
+   */
+  struct RenderListJob
+  {
+    RenderList* renderList;           ///< The render list to fill
+    Layer*      layer;                ///< The layer the renderables belong to
+    bool        isOverlay;            ///< Whether to add the overlay renderables of the layer instead of the color ones
+    bool        respectClippingOrder; ///< Whether to sort with the correct clipping hierarchy
+  };
+
   /**
    * @brief Sort render items
    * @param bufferIndex The buffer to read from
    * @param renderList to sort
    * @param layer where the Renderers are from
    * @param respectClippingOrder Sort with the correct clipping hierarchy.
+   * @param sortingHelper The scratch buffer used to sort, which must not be used by another thread at the same time
    */
-  inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder );
+  inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder, SortingHelper& sortingHelper );
+
+  /**
+   * @brief Sorts the attributes of the render items with a radix sort, on keys which give the same order as a sort comparitor.
+   * @param sortingHelper The helper holding the attributes to sort. The sorted order is written to its keys
+   * @param comparitorIndex The index of the sort comparitor whose order the keys must follow
+   * @return false if an attribute does not fit in the keys, in which case the items must be sorted with the comparitor
+   */
+  bool RadixSortRenderItems( SortingHelper& sortingHelper, uint32_t comparitorIndex );
+
+  /**
+   * @brief Adds the renderers of a job to its render list and sorts them
+   * @param updateBufferIndex The current update buffer index
+   * @param job The render list to build
+   * @param viewMatrix The view matrix of the render task
+   * @param camera The camera of the render task
+   * @param cull Whether frustum culling is enabled or not
+   * @param sortingHelper The scratch buffer used to sort, which must not be used by another thread at the same time
+   */
+  void ProcessRenderListJob( BufferIndex updateBufferIndex, const RenderListJob& job, const Matrix& viewMatrix, Camera& camera, bool cull, SortingHelper& sortingHelper );
 
   /// Sort comparitor function pointer type.
   using ComparitorPointer = bool ( * )( const SortAttributes&, const SortAttributes& );
 
-  using SortingHelper = std::vector<SortAttributes>;
-
   Dali::Vector< ComparitorPointer > mSortComparitors;       ///< Contains all sort comparitors, used for quick look-up
-  RenderInstructionProcessor::SortingHelper mSortingHelper; ///< Helper used to sort Renderers
+  std::vector< SortingHelper > mSortingHelpers;             ///< Helpers used to sort Renderers, one for each thread building render lists
+  std::vector< RenderListJob > mRenderListJobs;             ///< The render lists to build in this frame
+  ThreadPool* mThreadPool;                                  ///< Thread pool used to build render lists concurrently (not owned)
 
 };
 
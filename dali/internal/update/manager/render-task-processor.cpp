@@ -302,6 +302,11 @@ RenderTaskProcessor::RenderTaskProcessor() = default;
 
 RenderTaskProcessor::~RenderTaskProcessor() = default;
 
+void RenderTaskProcessor::SetThreadPool( ThreadPool* threadPool )
+{
+  mRenderInstructionProcessor.SetThreadPool( threadPool );
+}
+
 bool RenderTaskProcessor::Process( BufferIndex updateBufferIndex,
                                    RenderTaskList& renderTasks,
                                    Layer& rootNode,
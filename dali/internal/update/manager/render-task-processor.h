@@ -71,6 +71,12 @@ public:
                 bool renderToFboEnabled,
                 bool isRenderingToFbo );
 
+  /**
+   * Sets the thread pool used to build the render lists of the layers concurrently.
+   * @param[in] threadPool The thread pool to use, or nullptr to build the render lists on the update thread. It is not owned
+   */
+  void SetThreadPool( ThreadPool* threadPool );
+
 private:
 
   /**
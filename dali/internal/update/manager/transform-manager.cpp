@@ -20,12 +20,18 @@
 
 //EXTERNAL INCLUDES
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstring>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 //INTERNAL INCLUDES
 #include <dali/public-api/common/constants.h>
+#include <dali/devel-api/threading/thread-pool.h>
 #include <dali/internal/common/math.h>
+#include <dali/internal/render/common/performance-monitor.h>
 
 namespace Dali
 {
@@ -47,6 +53,19 @@ static const float gDefaultTransformComponentStaticData[] = { 0.5f, 0.5f, 0.5f,
 static_assert( sizeof(gDefaultTransformComponentAnimatableData) == sizeof(TransformComponentAnimatable), "gDefaultTransformComponentAnimatableData should have the same number of floats as specified in TransformComponentAnimatable" );
 static_assert( sizeof(gDefaultTransformComponentStaticData) == sizeof(TransformComponentStatic), "gDefaultTransformComponentStaticData should have the same number of floats as specified in TransformComponentStatic" );
 
+//Scenes with fewer components than this are always updated serially
+static const uint32_t MINIMUM_COMPONENT_COUNT_FOR_PARALLEL_UPDATE = 4096u;
+
+//Minimum number of components given to each thread when a hierarchy level is updated in parallel
+static const uint32_t MINIMUM_COMPONENT_COUNT_PER_TASK = 512u;
+
+//Level of a component whose level has not been computed yet
+static const uint32_t UNKNOWN_LEVEL = std::numeric_limits<uint32_t>::max();
+
+//A sub-tree is moved component by component unless that swaps more than a quarter of the component count,
+//in which case reordering all the components in a single pass is cheaper
+static const uint32_t RELOCATION_COST_FACTOR = 4u;
+
 /**
  * @brief Calculates the center position for the transform component
  * @param[out] centerPosition The calculated center-position of the transform component
@@ -75,12 +94,45 @@ inline void CalculateCenterPosition(
   }
 }
 
+/**
+ * @brief Reorders the first elements of a vector following a permutation
+ * @param[in,out] values The vector to reorder
+ * @param[in] sourceIndices The current index of the element to move to each position
+ * @param[in] count The number of elements to reorder. Elements after count keep their position
+ * @param[in,out] buffer Scratch storage, grown to the largest vector reordered and reused between calls
+ */
+template< typename T >
+void Permute( Vector< T >& values, const Vector< TransformId >& sourceIndices, uint32_t count, Vector< uint8_t >& buffer )
+{
+  const uint32_t size = count * static_cast<uint32_t>( sizeof( T ) );
+  if( buffer.Size() < size )
+  {
+    buffer.ResizeUninitialized( size );
+  }
+
+  uint8_t* permutedValues = buffer.Begin();
+  for( uint32_t i(0); i<count; ++i )
+  {
+    memcpy( permutedValues + i * sizeof( T ), &values[ sourceIndices[i] ], sizeof( T ) );
+  }
+  memcpy( values.Begin(), permutedValues, size );
+}
+
 } // unnamed namespace
 
 TransformManager::TransformManager()
 :mComponentCount(0),
- mReorder(false)
-{}
+ mSkippedComponentCount(0),
+ mThreadPool(nullptr),
+ mSubtreeBoundsVersion(0),
+ mPublishedSubtreeBoundsVersion{ 0, 0 },
+ mReorder(false),
+ mSubtreeBoundsEnabled(false),
+ mSubtreeBoundsDirty(false)
+{
+  //There are no levels yet, every component is after the last one
+  mLevelOffsets.PushBack( 0u );
+}
 
 TransformManager::~TransformManager() = default;
 
@@ -103,8 +155,10 @@ TransformId TransformManager::CreateTransform()
     mBoundingSpheres.PushBack( Vector4(0.0f,0.0f,0.0f,0.0f) );
     mTxComponentAnimatableBaseValue.PushBack(TransformComponentAnimatable());
     mSizeBase.PushBack(Vector3(0.0f,0.0f,0.0f));
-    mComponentDirty.PushBack(false);
+    mComponentDirty.PushBack(true);
     mLocalMatrixDirty.PushBack(false);
+    mWorldMatrixDirty.PushBack(false);
+    mLevel.PushBack(0u);
   }
   else
   {
@@ -120,19 +174,44 @@ TransformId TransformManager::CreateTransform()
     mWorld[mComponentCount].SetIdentity();
     mBoundingSpheres[mComponentCount] = Vector4(0.0f,0.0f,0.0f,0.0f);
     mSizeBase[mComponentCount] = Vector3(0.0f,0.0f,0.0f);
-    mComponentDirty[mComponentCount] = false;
+    mComponentDirty[mComponentCount] = true;
     mLocalMatrixDirty[mComponentCount] = false;
+    mWorldMatrixDirty[mComponentCount] = false;
+    mLevel[mComponentCount] = 0u;
   }
 
+  if( mFirstChild.Size() <= id )
+  {
+    mFirstChild.Resize( id + 1u, INVALID_TRANSFORM_ID );
+    mNextSibling.Resize( id + 1u, INVALID_TRANSFORM_ID );
+    mPreviousSibling.Resize( id + 1u, INVALID_TRANSFORM_ID );
+  }
+  mFirstChild[id] = INVALID_TRANSFORM_ID;
+  mNextSibling[id] = INVALID_TRANSFORM_ID;
+  mPreviousSibling[id] = INVALID_TRANSFORM_ID;
+
   mComponentCount++;
   return id;
 }
 
 void TransformManager::RemoveTransform(TransformId id)
 {
+  while( mFirstChild[id] != INVALID_TRANSFORM_ID )
+  {
+    SetParent( mFirstChild[id], INVALID_TRANSFORM_ID );
+  }
+  RemoveChild( mParent[ mIds[id] ], id );
+
+  TransformId index = mIds[id];
+  const uint32_t levelCount = mLevelOffsets.Size() - 1u;
+  if( !mReorder && index < mLevelOffsets[levelCount] )
+  {
+    //The order of the components after the last level doesn't matter
+    index = MoveComponent( index, mLevel[index], levelCount );
+  }
+
   //Move the last element to the gap
   mComponentCount--;
-  TransformId index = mIds[id];
   mTxComponentAnimatable[index] = mTxComponentAnimatable[mComponentCount];
   mTxComponentStatic[index] = mTxComponentStatic[mComponentCount];
   mInheritanceMode[index] = mInheritanceMode[mComponentCount];
@@ -144,23 +223,55 @@ void TransformManager::RemoveTransform(TransformId id)
   mSizeBase[index] = mSizeBase[mComponentCount];
   mComponentDirty[index] = mComponentDirty[mComponentCount];
   mLocalMatrixDirty[index] = mLocalMatrixDirty[mComponentCount];
+  mWorldMatrixDirty[index] = mWorldMatrixDirty[mComponentCount];
   mBoundingSpheres[index] = mBoundingSpheres[mComponentCount];
+  mLevel[index] = mLevel[mComponentCount];
 
   TransformId lastItemId = mComponentId[mComponentCount];
   mIds[ lastItemId ] = index;
   mComponentId[index] = lastItemId;
   mIds.Remove( id );
 
-  mReorder = true;
+  //The published bounds of the id are cleared in case it is reused by a component created after they are published
+  for( uint32_t bufferIndex(0); bufferIndex<2u; ++bufferIndex )
+  {
+    if( id < mPublishedSubtreeBoundsMin[bufferIndex].Size() )
+    {
+      mRemovedSubtreeBoundsIds[bufferIndex].PushBack( id );
+    }
+  }
+
+  //The bounds are stored by index, so they have to be computed again even if nothing else changes
+  mSubtreeBoundsDirty = mSubtreeBoundsDirty || mSubtreeBoundsEnabled;
 }
 
 void TransformManager::SetParent( TransformId id, TransformId parentId )
 {
   DALI_ASSERT_ALWAYS( id != parentId );
   TransformId index = mIds[id];
+  RemoveChild( mParent[ index ], id );
+  AddChild( parentId, id );
   mParent[ index ] = parentId;
   mComponentDirty[ index ] = true;
-  mReorder = true;
+
+  if( !mReorder )
+  {
+    //If the component stays at the same hierarchy level after its new parent, neither the component
+    //nor its children have to move, e.g. when an item is moved between two containers at the same depth
+    uint32_t level = 0u;
+    if( parentId != INVALID_TRANSFORM_ID )
+    {
+      TransformId parentIndex = mIds[parentId];
+      if( parentIndex >= mLevelOffsets[ mLevelOffsets.Size() - 1u ] )
+      {
+        //Components after the last level have no children, so the new parent joins the first level
+        RelocateSubtree( parentId, 0u );
+      }
+      level = mLevel[ mIds[parentId] ] + 1u;
+    }
+
+    RelocateSubtree( id, level );
+  }
 }
 
 const Matrix& TransformManager::GetWorldMatrix( TransformId id ) const
@@ -222,16 +333,30 @@ void TransformManager::ResetToBaseValue()
 {
   if( mComponentCount )
   {
+    //Components whose animated values are discarded have changed even though nothing has been set
+    for( uint32_t i(0); i<mComponentCount; ++i )
+    {
+      if( memcmp( &mTxComponentAnimatable[i], &mTxComponentAnimatableBaseValue[i], sizeof(TransformComponentAnimatable) ) != 0 ||
+          memcmp( &mSize[i], &mSizeBase[i], sizeof(Vector3) ) != 0 )
+      {
+        mComponentDirty[i] = true;
+      }
+    }
+
     memcpy( &mTxComponentAnimatable[0], &mTxComponentAnimatableBaseValue[0], sizeof(TransformComponentAnimatable)*mComponentCount );
     memcpy( &mSize[0], &mSizeBase[0], sizeof(Vector3)*mComponentCount );
     memset( &mLocalMatrixDirty[0], false, sizeof(bool)*mComponentCount );
   }
 }
 
-bool TransformManager::Update()
+void TransformManager::SetThreadPool( ThreadPool* threadPool )
 {
-  bool componentsChanged = false;
+  mThreadPool = threadPool;
+}
 
+bool TransformManager::Update()
+{
+  const bool reordered = mReorder;
   if( mReorder )
   {
     //If some transform component has change its parent or has been removed since last update
@@ -240,16 +365,214 @@ bool TransformManager::Update()
     mReorder = false;
   }
 
-  //Iterate through all components to compute its world matrix
+  bool componentsChanged = false;
+  mSkippedComponentCount = 0u;
+
+  if( !mThreadPool || mComponentCount < MINIMUM_COMPONENT_COUNT_FOR_PARALLEL_UPDATE )
+  {
+    //Iterate through all components to compute its world matrix
+    componentsChanged = UpdateComponents( 0u, mComponentCount, mSkippedComponentCount );
+  }
+  else
+  {
+    //Components are sorted by hierarchy level, so all the components of a level can be updated
+    //concurrently once the previous level has been updated
+    uint32_t levelBegin = 0u;
+    for( uint32_t level = 1u; level < mLevelOffsets.Size(); ++level )
+    {
+      componentsChanged = UpdateComponentsInParallel( levelBegin, mLevelOffsets[level] ) || componentsChanged;
+      levelBegin = mLevelOffsets[level];
+    }
+
+    //Components after the last level have no parent and no children
+    if( levelBegin < mComponentCount )
+    {
+      componentsChanged = UpdateComponentsInParallel( levelBegin, mComponentCount ) || componentsChanged;
+    }
+  }
+
+  INCREASE_BY( PerformanceMonitor::TRANSFORMS_SKIPPED, mSkippedComponentCount );
+
+  if( mSubtreeBoundsEnabled && ( componentsChanged || reordered || mSubtreeBoundsDirty ) )
+  {
+    UpdateSubtreeBounds();
+    mSubtreeBoundsDirty = false;
+    ++mSubtreeBoundsVersion;
+  }
+
+  return componentsChanged;
+}
+
+void TransformManager::SetSubtreeBoundsEnabled( bool enabled )
+{
+  if( enabled != mSubtreeBoundsEnabled )
+  {
+    mSubtreeBoundsEnabled = enabled;
+    mSubtreeBoundsDirty = enabled;
+    if( !enabled )
+    {
+      mSubtreeBoundsMin.Clear();
+      mSubtreeBoundsMax.Clear();
+      ++mSubtreeBoundsVersion;
+    }
+  }
+}
+
+void TransformManager::PublishSubtreeBounds( BufferIndex bufferIndex )
+{
+  if( mPublishedSubtreeBoundsVersion[bufferIndex] == mSubtreeBoundsVersion )
+  {
+    return;
+  }
+  mPublishedSubtreeBoundsVersion[bufferIndex] = mSubtreeBoundsVersion;
+
+  Vector< Vector3 >& publishedMin = mPublishedSubtreeBoundsMin[bufferIndex];
+  Vector< Vector3 >& publishedMax = mPublishedSubtreeBoundsMax[bufferIndex];
+  Vector< TransformId >& removedIds = mRemovedSubtreeBoundsIds[bufferIndex];
+  if( mSubtreeBoundsMin.Empty() )
+  {
+    publishedMin.Clear();
+    publishedMax.Clear();
+    removedIds.Clear();
+    return;
+  }
+
+  //The ids without bounds get an empty box, which GetSubtreeBounds reports as not available
+  const float maxValue = std::numeric_limits<float>::max();
+  const Vector3 emptyMin( maxValue, maxValue, maxValue );
+  const Vector3 emptyMax( -maxValue, -maxValue, -maxValue );
+  for( auto&& id : removedIds )
+  {
+    publishedMin[id] = emptyMin;
+    publishedMax[id] = emptyMax;
+  }
+  removedIds.Clear();
+
+  //mFirstChild is indexed by transform id, so its size only grows with the ids
+  const uint32_t idCount = static_cast<uint32_t>( mFirstChild.Size() );
+  if( publishedMin.Size() < idCount )
+  {
+    publishedMin.Resize( idCount, emptyMin );
+    publishedMax.Resize( idCount, emptyMax );
+  }
+
+  //Only the bounds which changed since this buffer was last published are written
+  const uint32_t boundsCount = std::min( mComponentCount, static_cast<uint32_t>( mSubtreeBoundsMin.Size() ) );
+  for( uint32_t i(0); i<boundsCount; ++i )
+  {
+    const TransformId id = mComponentId[i];
+    if( publishedMin[id] != mSubtreeBoundsMin[i] || publishedMax[id] != mSubtreeBoundsMax[i] )
+    {
+      publishedMin[id] = mSubtreeBoundsMin[i];
+      publishedMax[id] = mSubtreeBoundsMax[i];
+    }
+  }
+}
+
+void TransformManager::UpdateSubtreeBounds()
+{
+  mSubtreeBoundsMin.Resize( mComponentCount );
+  mSubtreeBoundsMax.Resize( mComponentCount );
+
+  for( uint32_t i(0); i<mComponentCount; ++i )
+  {
+    //Radius of the sphere used by the hit test: the length of the half diagonal of the size scaled by the world scale.
+    //It is slightly enlarged so the rounding errors can't make the bounds smaller than the sphere
+    const float* world = mWorld[i].AsFloat();
+    const float scaleXSquared = world[0] * world[0] + world[1] * world[1] + world[2] * world[2];
+    const float scaleYSquared = world[4] * world[4] + world[5] * world[5] + world[6] * world[6];
+    const float radius = sqrtf( 0.5f * ( mSize[i].x * mSize[i].x * scaleXSquared + mSize[i].y * mSize[i].y * scaleYSquared ) ) * 1.001f;
+
+    const Vector3 center( world[12], world[13], world[14] );
+    const Vector3 extent( radius, radius, radius );
+    mSubtreeBoundsMin[i] = center - extent;
+    mSubtreeBoundsMax[i] = center + extent;
+  }
+
+  for( uint32_t i(mComponentCount); i>0u; --i )
+  {
+    const uint32_t index = i - 1u;
+    if( mParent[index] != INVALID_TRANSFORM_ID )
+    {
+      const TransformId parentIndex = mIds[ mParent[index] ];
+      mSubtreeBoundsMin[parentIndex] = Min( mSubtreeBoundsMin[parentIndex], mSubtreeBoundsMin[index] );
+      mSubtreeBoundsMax[parentIndex] = Max( mSubtreeBoundsMax[parentIndex], mSubtreeBoundsMax[index] );
+    }
+  }
+}
+
+bool TransformManager::UpdateComponentsInParallel( uint32_t begin, uint32_t end )
+{
+  const uint32_t count = end - begin;
+  uint32_t taskCount = std::min( static_cast<uint32_t>( mThreadPool->GetWorkerCount() ) + 1u, count / MINIMUM_COMPONENT_COUNT_PER_TASK );
+  if( taskCount < 2u )
+  {
+    return UpdateComponents( begin, end, mSkippedComponentCount );
+  }
+
+  std::atomic<bool> componentsChanged( false );
+  std::atomic<uint32_t> skippedComponentCount( 0u );
+  std::vector<SharedFuture> futures;
+  futures.reserve( taskCount - 1u );
+
+  //The calling thread updates the first chunk while the worker threads update the rest
+  const uint32_t chunkSize = count / taskCount;
+  uint32_t chunkBegin = begin + chunkSize + count % taskCount;
+  for( uint32_t task = 1u; task < taskCount; ++task )
+  {
+    const uint32_t chunkEnd = chunkBegin + chunkSize;
+    futures.push_back( mThreadPool->SubmitTask( task - 1u, [this, chunkBegin, chunkEnd, &componentsChanged, &skippedComponentCount]( uint32_t )
+    {
+      uint32_t skippedCount = 0u;
+      if( UpdateComponents( chunkBegin, chunkEnd, skippedCount ) )
+      {
+        componentsChanged = true;
+      }
+      skippedComponentCount += skippedCount;
+    } ) );
+    chunkBegin = chunkEnd;
+  }
+
+  if( UpdateComponents( begin, begin + chunkSize + count % taskCount, mSkippedComponentCount ) )
+  {
+    componentsChanged = true;
+  }
+
+  for( auto&& future : futures )
+  {
+    future->Wait();
+  }
+  mSkippedComponentCount += skippedComponentCount;
+
+  return componentsChanged;
+}
+
+bool TransformManager::UpdateComponents( uint32_t begin, uint32_t end, uint32_t& skippedComponentCount )
+{
+  bool componentsChanged = false;
+
   Vector3 centerPosition;
   Vector3 localPosition;
   const Vector3 half( 0.5f,0.5f,0.5f );
   const Vector3 topLeft( 0.0f, 0.0f, 0.5f );
-  for( unsigned int i(0); i<mComponentCount; ++i )
+
+  // Consecutive siblings inheriting the full transform have their world matrices computed in a single batch.
+  // The batch is flushed before any component reads the world matrix of a component in the batch.
+  uint32_t batchBegin = begin;
+  uint32_t batchEnd = begin;
+  uint32_t batchParentIndex = 0u;
+
+  for( uint32_t i(begin); i<end; ++i )
   {
     if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
     {
       const TransformId& parentIndex = mIds[mParent[i] ];
+      if( batchBegin != batchEnd && ( i != batchEnd || parentIndex != batchParentIndex ) )
+      {
+        UpdateWorldMatrices( batchBegin, batchEnd, batchParentIndex );
+        batchBegin = batchEnd;
+      }
+
       if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL ) )
       {
         if( mComponentDirty[i] || mLocalMatrixDirty[parentIndex])
@@ -260,12 +583,36 @@ bool TransformManager::Update()
           localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
           mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
         }
+        else if( !mWorldMatrixDirty[parentIndex] )
+        {
+          //Neither the component nor its ancestors have changed, keep the cached world matrix and bounding sphere
+          mWorldMatrixDirty[i] = false;
+          ++skippedComponentCount;
+          continue;
+        }
 
-        //Update the world matrix
-        Matrix::Multiply( mWorld[i], mLocal[i], mWorld[parentIndex]);
+        //Defer the world matrix and bounding sphere update to the batch
+        if( batchBegin == batchEnd )
+        {
+          batchBegin = i;
+          batchParentIndex = parentIndex;
+        }
+        batchEnd = i + 1u;
+
+        mWorldMatrixDirty[i] = true;
+        componentsChanged = componentsChanged || mComponentDirty[i];
+        mComponentDirty[i] = false;
+        continue;
       }
       else
       {
+        if( !mComponentDirty[i] && !mWorldMatrixDirty[parentIndex] )
+        {
+          mWorldMatrixDirty[i] = false;
+          ++skippedComponentCount;
+          continue;
+        }
+
         //Some components are not inherited
         Vector3 parentPosition, parentScale;
         Quaternion parentOrientation;
@@ -308,6 +655,13 @@ bool TransformManager::Update()
     }
     else  //Component has no parent or doesn't inherit transform
     {
+      if( !mComponentDirty[i] )
+      {
+        mWorldMatrixDirty[i] = false;
+        ++skippedComponentCount;
+        continue;
+      }
+
       CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
       localPosition = mTxComponentAnimatable[i].mPosition + centerPosition;
       mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
@@ -315,67 +669,267 @@ bool TransformManager::Update()
       mLocalMatrixDirty[i] = true;
     }
 
-    //Update the bounding sphere
-    Vec3 centerToEdge = { mSize[i].Length() * 0.5f, 0.0f, 0.0f };
-    Vec3 centerToEdgeWorldSpace;
-    TransformVector3( centerToEdgeWorldSpace, mWorld[i].AsFloat(), centerToEdge );
-
-    mBoundingSpheres[i] = mWorld[i].GetTranslation();
-    mBoundingSpheres[i].w = Length( centerToEdgeWorldSpace );
+    UpdateBoundingSphere( i );
 
+    mWorldMatrixDirty[i] = true;
     componentsChanged = componentsChanged || mComponentDirty[i];
     mComponentDirty[i] = false;
   }
 
+  if( batchBegin != batchEnd )
+  {
+    UpdateWorldMatrices( batchBegin, batchEnd, batchParentIndex );
+  }
+
   return componentsChanged;
 }
 
-void TransformManager::SwapComponents( unsigned int i, unsigned int j )
+void TransformManager::UpdateWorldMatrices( uint32_t begin, uint32_t end, uint32_t parentIndex )
+{
+  MultiplyMatrices( &mWorld[begin], &mLocal[begin], mWorld[parentIndex], end - begin );
+
+  for( uint32_t i(begin); i<end; ++i )
+  {
+    UpdateBoundingSphere( i );
+  }
+}
+
+void TransformManager::UpdateBoundingSphere( uint32_t index )
 {
-  std::swap( mTxComponentAnimatable[i], mTxComponentAnimatable[j] );
-  std::swap( mTxComponentStatic[i], mTxComponentStatic[j] );
-  std::swap( mInheritanceMode[i], mInheritanceMode[j] );
-  std::swap( mSize[i], mSize[j] );
-  std::swap( mParent[i], mParent[j] );
-  std::swap( mComponentId[i], mComponentId[j] );
-  std::swap( mTxComponentAnimatableBaseValue[i], mTxComponentAnimatableBaseValue[j] );
-  std::swap( mSizeBase[i], mSizeBase[j] );
-  std::swap( mLocal[i], mLocal[j] );
-  std::swap( mComponentDirty[i], mComponentDirty[j] );
-  std::swap( mBoundingSpheres[i], mBoundingSpheres[j] );
-  std::swap( mWorld[i], mWorld[j] );
+  Vec3 centerToEdge = { mSize[index].Length() * 0.5f, 0.0f, 0.0f };
+  Vec3 centerToEdgeWorldSpace;
+  TransformVector3( centerToEdgeWorldSpace, mWorld[index].AsFloat(), centerToEdge );
 
-  mIds[ mComponentId[i] ] = i;
-  mIds[ mComponentId[j] ] = j;
+  mBoundingSpheres[index] = mWorld[index].GetTranslation();
+  mBoundingSpheres[index].w = Length( centerToEdgeWorldSpace );
 }
 
 void TransformManager::ReorderComponents()
 {
-  mOrderedComponents.Resize(mComponentCount);
+  //Compute the hierarchy level of every component. Each level is only computed once, walking up
+  //the parent chain until a component whose level is already known is found
+  for( TransformId i = 0; i<mComponentCount; ++i )
+  {
+    mLevel[i] = UNKNOWN_LEVEL;
+  }
+
+  uint32_t levelCount = 0u;
+  for( TransformId i = 0; i<mComponentCount; ++i )
+  {
+    uint32_t level = 0u;
+    TransformId index = i;
+    mReorderSourceIndices.Clear();
+    while( mLevel[index] == UNKNOWN_LEVEL )
+    {
+      mReorderSourceIndices.PushBack( index );
+      TransformId parentId = mParent[index];
+      if( parentId == INVALID_TRANSFORM_ID )
+      {
+        break;
+      }
+
+      index = mIds[parentId];
+      if( mLevel[index] != UNKNOWN_LEVEL )
+      {
+        level = mLevel[index] + 1u;
+      }
+    }
 
-  TransformId parentId;
+    for( uint32_t j = mReorderSourceIndices.Size(); j>0u; --j )
+    {
+      mLevel[ mReorderSourceIndices[j-1u] ] = level++;
+    }
+    levelCount = std::max( levelCount, level );
+  }
+
+  //Count the components of each level to find where each level starts, then sort the components
+  //by level keeping their relative order
+  mLevelOffsets.Resize( levelCount + 1u );
+  for( uint32_t level = 0u; level <= levelCount; ++level )
+  {
+    mLevelOffsets[level] = 0u;
+  }
   for( TransformId i = 0; i<mComponentCount; ++i )
   {
-    mOrderedComponents[i].id = mComponentId[i];
-    mOrderedComponents[i].level = 0u;
+    ++mLevelOffsets[ mLevel[i] + 1u ];
+  }
+  for( uint32_t level = 1u; level <= levelCount; ++level )
+  {
+    mLevelOffsets[level] += mLevelOffsets[level - 1u];
+  }
+
+  bool ordered = true;
+  mReorderSourceIndices.Resize( mComponentCount );
+  mLevelInsertPositions = mLevelOffsets;
+  for( TransformId i = 0; i<mComponentCount; ++i )
+  {
+    const uint32_t newIndex = mLevelInsertPositions[ mLevel[i] ]++;
+    mReorderSourceIndices[newIndex] = i;
+    ordered = ordered && ( newIndex == i );
+  }
 
-    parentId = mParent[i];
-    while( parentId != INVALID_TRANSFORM_ID )
+  if( !ordered )
+  {
+    //Move every component to its new position with a single pass over each vector
+    Permute( mTxComponentAnimatable, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mTxComponentStatic, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mInheritanceMode, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mComponentId, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mSize, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mParent, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mWorld, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mLocal, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mBoundingSpheres, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mTxComponentAnimatableBaseValue, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mSizeBase, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mComponentDirty, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mLocalMatrixDirty, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mWorldMatrixDirty, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+    Permute( mLevel, mReorderSourceIndices, mComponentCount, mReorderBuffer );
+
+    for( TransformId i = 0; i<mComponentCount; ++i )
+    {
+      mIds[ mComponentId[i] ] = i;
+    }
+  }
+}
+
+void TransformManager::RelocateSubtree( TransformId id, uint32_t level )
+{
+  //Components after the last level have no parent and no children
+  const uint32_t index = mIds[id];
+  const bool afterLastLevel = index >= mLevelOffsets[ mLevelOffsets.Size() - 1u ];
+  const uint32_t currentLevel = afterLastLevel ? 0u : mLevel[index];
+  if( !afterLastLevel && currentLevel == level )
+  {
+    return;
+  }
+
+  //Collect the sub-tree, unless moving it would swap more components than reordering all of them
+  const uint32_t distance = ( currentLevel < level ) ? level - currentLevel : currentLevel - level;
+  mSubtreeIds.Clear();
+  mSubtreeIds.PushBack( id );
+  for( uint32_t i(0); i<mSubtreeIds.Count(); ++i )
+  {
+    for( TransformId childId = mFirstChild[ mSubtreeIds[i] ]; childId != INVALID_TRANSFORM_ID; childId = mNextSibling[childId] )
+    {
+      mSubtreeIds.PushBack( childId );
+    }
+
+    if( mSubtreeIds.Count() > 1u && mSubtreeIds.Count() * distance * RELOCATION_COST_FACTOR > mComponentCount )
     {
-      mOrderedComponents[i].level++;
-      parentId = mParent[ mIds[parentId] ];
+      mReorder = true;
+      return;
     }
   }
 
-  std::stable_sort( mOrderedComponents.Begin(), mOrderedComponents.End());
-  TransformId previousIndex = 0;
-  for( TransformId newIndex = 0; newIndex < mComponentCount-1; ++newIndex )
+  //Each component keeps its depth within the sub-tree
+  for( uint32_t i(0); i<mSubtreeIds.Count(); ++i )
   {
-    previousIndex = mIds[mOrderedComponents[newIndex].id];
-    if( previousIndex != newIndex )
+    const uint32_t subtreeIndex = mIds[ mSubtreeIds[i] ];
+    const uint32_t subtreeLevel = mLevel[subtreeIndex];
+    const uint32_t newLevel = subtreeLevel - currentLevel + level;
+    while( mLevelOffsets.Size() <= newLevel + 1u )
     {
-      SwapComponents( previousIndex, newIndex);
+      const uint32_t levelEnd = mLevelOffsets[ mLevelOffsets.Size() - 1u ];
+      mLevelOffsets.PushBack( levelEnd );
     }
+
+    const uint32_t fromLevel = ( i == 0u && afterLastLevel ) ? mLevelOffsets.Size() - 1u : subtreeLevel;
+    mLevel[ MoveComponent( subtreeIndex, fromLevel, newLevel ) ] = newLevel;
+  }
+
+  //Drop the levels left empty at the end
+  while( mLevelOffsets.Size() > 1u && mLevelOffsets[ mLevelOffsets.Size() - 2u ] == mLevelOffsets[ mLevelOffsets.Size() - 1u ] )
+  {
+    mLevelOffsets.Resize( mLevelOffsets.Size() - 1u );
+  }
+}
+
+uint32_t TransformManager::MoveComponent( uint32_t index, uint32_t level, uint32_t newLevel )
+{
+  //Moving down a level, the component swaps places with the last component of its level, which then ends one component earlier.
+  //Moving up a level, it swaps places with the first component of its level, which then starts one component later
+  for( ; level < newLevel; ++level )
+  {
+    const uint32_t lastIndex = --mLevelOffsets[level + 1u];
+    SwapComponents( index, lastIndex );
+    index = lastIndex;
+  }
+  for( ; level > newLevel; --level )
+  {
+    const uint32_t firstIndex = mLevelOffsets[level]++;
+    SwapComponents( index, firstIndex );
+    index = firstIndex;
+  }
+  return index;
+}
+
+void TransformManager::SwapComponents( uint32_t index0, uint32_t index1 )
+{
+  if( index0 == index1 )
+  {
+    return;
+  }
+
+  std::swap( mTxComponentAnimatable[index0], mTxComponentAnimatable[index1] );
+  std::swap( mTxComponentStatic[index0], mTxComponentStatic[index1] );
+  std::swap( mInheritanceMode[index0], mInheritanceMode[index1] );
+  std::swap( mComponentId[index0], mComponentId[index1] );
+  std::swap( mSize[index0], mSize[index1] );
+  std::swap( mParent[index0], mParent[index1] );
+  std::swap( mWorld[index0], mWorld[index1] );
+  std::swap( mLocal[index0], mLocal[index1] );
+  std::swap( mBoundingSpheres[index0], mBoundingSpheres[index1] );
+  std::swap( mTxComponentAnimatableBaseValue[index0], mTxComponentAnimatableBaseValue[index1] );
+  std::swap( mSizeBase[index0], mSizeBase[index1] );
+  std::swap( mComponentDirty[index0], mComponentDirty[index1] );
+  std::swap( mLocalMatrixDirty[index0], mLocalMatrixDirty[index1] );
+  std::swap( mWorldMatrixDirty[index0], mWorldMatrixDirty[index1] );
+  std::swap( mLevel[index0], mLevel[index1] );
+
+  mIds[ mComponentId[index0] ] = index0;
+  mIds[ mComponentId[index1] ] = index1;
+
+  //The bounds are stored by index, so they have to be computed again even if nothing else changes
+  mSubtreeBoundsDirty = mSubtreeBoundsDirty || mSubtreeBoundsEnabled;
+}
+
+void TransformManager::AddChild( TransformId parentId, TransformId id )
+{
+  if( parentId != INVALID_TRANSFORM_ID )
+  {
+    const TransformId nextSiblingId = mFirstChild[parentId];
+    mNextSibling[id] = nextSiblingId;
+    mPreviousSibling[id] = INVALID_TRANSFORM_ID;
+    if( nextSiblingId != INVALID_TRANSFORM_ID )
+    {
+      mPreviousSibling[nextSiblingId] = id;
+    }
+    mFirstChild[parentId] = id;
+  }
+}
+
+void TransformManager::RemoveChild( TransformId parentId, TransformId id )
+{
+  if( parentId != INVALID_TRANSFORM_ID )
+  {
+    const TransformId previousSiblingId = mPreviousSibling[id];
+    const TransformId nextSiblingId = mNextSibling[id];
+    if( previousSiblingId != INVALID_TRANSFORM_ID )
+    {
+      mNextSibling[previousSiblingId] = nextSiblingId;
+    }
+    else
+    {
+      mFirstChild[parentId] = nextSiblingId;
+    }
+    if( nextSiblingId != INVALID_TRANSFORM_ID )
+    {
+      mPreviousSibling[nextSiblingId] = previousSiblingId;
+    }
+    mNextSibling[id] = INVALID_TRANSFORM_ID;
+    mPreviousSibling[id] = INVALID_TRANSFORM_ID;
   }
 }
 
@@ -597,6 +1151,53 @@ void TransformManager::BakeVector3PropertyValue( TransformId id, TransformManage
   }
 }
 
+void TransformManager::AnimateVector3Property( TransformManagerProperty property, const TransformId* ids, const Vector3* values, const uint8_t* relative, const float* alphas, uint32_t count, bool bake )
+{
+  auto animate = [&]( auto&& getValue, auto&& getBaseValue )
+  {
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      const TransformId index( mIds[ ids[i] ] );
+      Vector3& current = getValue( index );
+
+      // The same expressions as AnimateByVector3 and AnimateToVector3
+      const Vector3 result = relative[i] ? Vector3( current + values[i] * alphas[i] ) : Vector3( current + ( ( values[i] - current ) * alphas[i] ) );
+      current = result;
+      if( bake )
+      {
+        getBaseValue( index ) = result;
+      }
+      mComponentDirty[ index ] = true;
+    }
+  };
+
+  switch( property )
+  {
+    case TRANSFORM_PROPERTY_POSITION:
+    {
+      animate( [this]( TransformId index ) -> Vector3& { return mTxComponentAnimatable[ index ].mPosition; },
+               [this]( TransformId index ) -> Vector3& { return mTxComponentAnimatableBaseValue[ index ].mPosition; } );
+      break;
+    }
+    case TRANSFORM_PROPERTY_SCALE:
+    {
+      animate( [this]( TransformId index ) -> Vector3& { return mTxComponentAnimatable[ index ].mScale; },
+               [this]( TransformId index ) -> Vector3& { return mTxComponentAnimatableBaseValue[ index ].mScale; } );
+      break;
+    }
+    case TRANSFORM_PROPERTY_SIZE:
+    {
+      animate( [this]( TransformId index ) -> Vector3& { return mSize[ index ]; },
+               [this]( TransformId index ) -> Vector3& { return mSizeBase[ index ]; } );
+      break;
+    }
+    default:
+    {
+      DALI_ASSERT_ALWAYS(false);
+    }
+  }
+}
+
 void TransformManager::BakeRelativeVector3PropertyValue( TransformId id, TransformManagerProperty property, const Vector3& value )
 {
   TransformId index( mIds[id] );
@@ -868,6 +1469,18 @@ const Vector4& TransformManager::GetBoundingSphere( TransformId id ) const
   return mBoundingSpheres[ mIds[id] ];
 }
 
+bool TransformManager::GetSubtreeBounds( BufferIndex bufferIndex, TransformId id, Vector3& boundsMin, Vector3& boundsMax ) const
+{
+  const Vector< Vector3 >& publishedMin = mPublishedSubtreeBoundsMin[bufferIndex];
+  if( id < publishedMin.Size() && publishedMin[id].x <= mPublishedSubtreeBoundsMax[bufferIndex][id].x )
+  {
+    boundsMin = publishedMin[id];
+    boundsMax = mPublishedSubtreeBoundsMax[bufferIndex][id];
+    return true;
+  }
+  return false;
+}
+
 void TransformManager::GetWorldMatrixAndSize( TransformId id, Matrix& worldMatrix, Vector3& size ) const
 {
   TransformId index = mIds[id];
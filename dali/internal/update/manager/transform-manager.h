@@ -24,11 +24,14 @@
 #include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/math/vector3.h>
 #include <dali/public-api/common/constants.h>
+#include <dali/internal/common/buffer-index.h>
 #include <dali/internal/update/manager/free-list.h>
 
 namespace Dali
 {
 
+class ThreadPool;
+
 namespace Internal
 {
 
@@ -133,13 +136,14 @@ public:
   TransformId CreateTransform();
 
   /**
-   * Removes an existing transform component
+   * Removes an existing transform component. Its children become roots
    * @param[in] id Id of the transform to remove
    */
   void RemoveTransform(TransformId id);
 
   /**
-   * Sets the parent transform of an existing component
+   * Sets the parent transform of an existing component.
+   * If the hierarchy level of the component changes, only the component and its descendants are moved to their new level
    * @param[in] id Id of the transform
    * @param[in] parentId Id of the new parent
    */
@@ -169,6 +173,16 @@ public:
     return mLocalMatrixDirty[mIds[id]];
   }
 
+  /**
+   * Checks if the world transform was updated in the last Update
+   * @param[in] id Id of the transform
+   * @return true if world matrix changed in the last update, false otherwise
+   */
+  bool IsWorldMatrixDirty( TransformId id ) const
+  {
+    return mWorldMatrixDirty[mIds[id]];
+  }
+
   /**
    * Sets position inheritance mode.
    * @param[in] id Id of the transform
@@ -191,11 +205,44 @@ public:
   void SetInheritOrientation( TransformId id, bool inherit );
 
   /**
-   * Recomputes all world transform matrices
+   * Sets the thread pool used to update the components of large scenes in parallel.
+   * Components of the same hierarchy level are split between the worker threads and
+   * the calling thread, one level at a time.
+   * @param[in] threadPool The thread pool to use, or nullptr to always update serially
+   * @note The thread pool is not owned by the transform manager
+   */
+  void SetThreadPool( ThreadPool* threadPool );
+
+  /**
+   * Sets whether Update computes the bounds of the sub-tree of every component, which are used to speed up hit testing
+   * @param[in] enabled True to compute the sub-tree bounds
+   */
+  void SetSubtreeBoundsEnabled( bool enabled );
+
+  /**
+   * Copies the sub-tree bounds computed by the last Update to the given buffer, if that buffer does not have them yet.
+   * Only the bounds which changed since the buffer was last published are written.
+   * The event thread only reads the published bounds, so it never accesses the storage that Update modifies
+   * @param[in] bufferIndex The buffer index of the current update
+   */
+  void PublishSubtreeBounds( BufferIndex bufferIndex );
+
+  /**
+   * Recomputes the world transform matrices of the components which, or whose ancestors, have changed.
+   * The world matrix and bounding sphere of unchanged components are kept from the previous Update
    * @return true if any component has been changed in this frame, false otherwise
    */
   bool Update();
 
+  /**
+   * Retrieves the number of components whose world matrix did not need to be recomputed in the last Update
+   * @return The number of components skipped in the last update
+   */
+  uint32_t GetSkippedComponentCount() const
+  {
+    return mSkippedComponentCount;
+  }
+
   /**
    * Resets all the animatable properties to its base value
    */
@@ -248,6 +295,18 @@ public:
    */
   void BakeVector3PropertyValue( TransformId id, TransformManagerProperty property, const Vector3& value );
 
+  /**
+   * Moves a Vector3 property of many components linearly, as setting or baking the results one by one would
+   * @param[in] property The property, which must be the position, scale or size
+   * @param[in] ids The components
+   * @param[in] values The value of each component to move towards, or to move by if relative
+   * @param[in] relative Whether each value is relative to the current value
+   * @param[in] alphas How far to move each component, from 0 (not at all) to 1 (all the way)
+   * @param[in] count The number of components
+   * @param[in] bake Whether to bake the results
+   */
+  void AnimateVector3Property( TransformManagerProperty property, const TransformId* ids, const Vector3* values, const uint8_t* relative, const float* alphas, uint32_t count, bool bake );
+
   /**
    * Bakes the value of a Vector3 property relative to the current value
    * @param[in] id Id of the transform component
@@ -336,6 +395,18 @@ public:
    */
   const Vector4& GetBoundingSphere( TransformId id ) const;
 
+  /**
+   * Get the world space axis aligned box containing the hit test spheres of a component and of all its descendants,
+   * as published by PublishSubtreeBounds. The hit test sphere of a component is centred on its world position and
+   * contains its size scaled by its world scale
+   * @param[in] bufferIndex The buffer to read, the event buffer index when called from the event thread
+   * @param[in] id Id of the transform component
+   * @param[out] boundsMin The minimum corner of the box
+   * @param[out] boundsMax The maximum corner of the box
+   * @return false if the bounds are not available, i.e. they are not enabled or the component was created after they were published
+   */
+  bool GetSubtreeBounds( BufferIndex bufferIndex, TransformId id, Vector3& boundsMin, Vector3& boundsMax ) const;
+
   /**
    * Get the world matrix and size of a given component
    * @param[in] id Id of the transform component
@@ -353,29 +424,93 @@ public:
 
 private:
 
-  //Helper struct to order components
-  struct SOrderItem
-  {
-    bool operator<(const SOrderItem& item) const {return level < item.level;}
+  /**
+   * Reorders components in hierarchical order so update can iterate sequentially
+   * updating the world transforms. The levels are computed and the components sorted and moved in linear time.
+   * Used instead of RelocateSubtree when a sub-tree is too large to be moved component by component
+   */
+  void ReorderComponents();
 
-    TransformId  id;
-    uint32_t level;
-  };
+  /**
+   * Moves a component and its descendants to the levels matching a new hierarchy level of the component.
+   * Falls back to reordering all the components in the next Update if that would move too many components
+   * @param[in] id Id of the component
+   * @param[in] level The new hierarchy level of the component
+   */
+  void RelocateSubtree( TransformId id, uint32_t level );
 
   /**
-   * Swaps two components in the vectors
-   * @param[in] i Index of a component
-   * @param[in] j Index of a component
+   * Moves a component from one level to another. Each level crossed only swaps the component with the first
+   * or last component of that level, so the other components keep their level
+   * @param[in] index Index of the component
+   * @param[in] level Current level of the component, or the level count if it is after the last level
+   * @param[in] newLevel The level to move the component to, or the level count to move it after the last level
+   * @return The new index of the component
    */
-  void SwapComponents( uint32_t i, uint32_t j );
+  uint32_t MoveComponent( uint32_t index, uint32_t level, uint32_t newLevel );
 
   /**
-   * Reorders components in hierarchical order so update can iterate sequentially
-   * updating the world transforms
+   * Swaps the positions of two components
+   * @param[in] index0 Index of the first component
+   * @param[in] index1 Index of the second component
    */
-  void ReorderComponents();
+  void SwapComponents( uint32_t index0, uint32_t index1 );
+
+  /**
+   * Adds a component to the list of children of another one
+   * @param[in] parentId Id of the parent, or INVALID_TRANSFORM_ID
+   * @param[in] id Id of the child
+   */
+  void AddChild( TransformId parentId, TransformId id );
+
+  /**
+   * Removes a component from the list of children of another one
+   * @param[in] parentId Id of the parent, or INVALID_TRANSFORM_ID
+   * @param[in] id Id of the child
+   */
+  void RemoveChild( TransformId parentId, TransformId id );
+
+  /**
+   * Recomputes the world transform matrices of a range of components
+   * @param[in] begin Index of the first component to update
+   * @param[in] end Index after the last component to update
+   * @param[in,out] skippedComponentCount Incremented for each component of the range that has not changed
+   * @return true if any component in the range has been changed in this frame, false otherwise
+   */
+  bool UpdateComponents( uint32_t begin, uint32_t end, uint32_t& skippedComponentCount );
+
+  /**
+   * Computes the world transform matrices of a run of consecutive components with the same parent
+   * from their local matrices in a single batch, then updates their bounding spheres
+   * @param[in] begin Index of the first component of the run
+   * @param[in] end Index after the last component of the run
+   * @param[in] parentIndex Index of the parent of every component in the run
+   */
+  void UpdateWorldMatrices( uint32_t begin, uint32_t end, uint32_t parentIndex );
+
+  /**
+   * Updates the bounding sphere of a component from its world matrix and size
+   * @param[in] index Index of the component
+   */
+  void UpdateBoundingSphere( uint32_t index );
+
+  /**
+   * Recomputes the world transform matrices of a range of components, splitting the range between
+   * the worker threads of the thread pool. None of the components in the range can be parent of another one
+   * @param[in] begin Index of the first component to update
+   * @param[in] end Index after the last component to update
+   * @return true if any component in the range has been changed in this frame, false otherwise
+   */
+  bool UpdateComponentsInParallel( uint32_t begin, uint32_t end );
+
+  /**
+   * Computes the bounds of the sub-tree of every component. Parents are always before their
+   * children, so the bounds of the children are merged into their parents in a single backwards pass
+   */
+  void UpdateSubtreeBounds();
 
   uint32_t mComponentCount;                                               ///< Total number of components
+  uint32_t mSkippedComponentCount;                                        ///< Number of components not recomputed in the last update
   FreeList mIds;                                                          ///< FreeList of Ids
   Vector< TransformComponentAnimatable > mTxComponentAnimatable;          ///< Animatable part of the components
   Vector< TransformComponentStatic > mTxComponentStatic;                  ///< Static part of the components
@@ -390,8 +525,27 @@ private:
   Vector< Vector3 > mSizeBase;                                            ///< Base value for the size of the components
   Vector< bool > mComponentDirty;                                         ///< 1u if some of the parts of the component has changed in this frame, 0 otherwise
   Vector< bool > mLocalMatrixDirty;                                       ///< 1u if the local matrix has been updated in this frame, 0 otherwise
-  Vector< SOrderItem > mOrderedComponents;                                ///< Used to reorder components when hierarchy changes
+  Vector< bool > mWorldMatrixDirty;                                       ///< 1u if the world matrix has been updated in this frame, 0 otherwise
+  Vector< uint32_t > mLevel;                                              ///< Hierarchy level of the components, valid while the components don't need to be reordered
+  Vector< TransformId > mReorderSourceIndices;                            ///< Used to reorder components, index of the component to move to each position
+  Vector< uint32_t > mLevelOffsets;                                       ///< Index of the first component of each hierarchy level, followed by the index after the last level
+  Vector< TransformId > mFirstChild;                                      ///< First child of each component, indexed by transform id
+  Vector< TransformId > mNextSibling;                                     ///< Next sibling of each component, indexed by transform id
+  Vector< TransformId > mPreviousSibling;                                 ///< Previous sibling of each component, indexed by transform id
+  Vector< TransformId > mSubtreeIds;                                      ///< Used to relocate sub-trees, ids of the components of the sub-tree being moved
+  Vector< uint32_t > mLevelInsertPositions;                               ///< Used to reorder components, next free position of each hierarchy level
+  Vector< uint8_t > mReorderBuffer;                                       ///< Used to reorder components, scratch storage for the component vector being reordered
+  Vector< Vector3 > mSubtreeBoundsMin;                                    ///< Minimum corner of the bounds of the sub-tree of the components, empty if not enabled
+  Vector< Vector3 > mSubtreeBoundsMax;                                    ///< Maximum corner of the bounds of the sub-tree of the components, empty if not enabled
+  Vector< Vector3 > mPublishedSubtreeBoundsMin[2];                        ///< Double buffered minimum corner of the sub-tree bounds, indexed by transform id
+  Vector< Vector3 > mPublishedSubtreeBoundsMax[2];                        ///< Double buffered maximum corner of the sub-tree bounds, indexed by transform id
+  Vector< TransformId > mRemovedSubtreeBoundsIds[2];                      ///< Ids removed since the sub-tree bounds were last published in each buffer
+  ThreadPool* mThreadPool;                                                ///< Thread pool used to update large scenes in parallel (not owned)
+  uint32_t mSubtreeBoundsVersion;                                         ///< Incremented whenever the sub-tree bounds change
+  uint32_t mPublishedSubtreeBoundsVersion[2];                             ///< Version of the sub-tree bounds published in each buffer
   bool mReorder;                                                          ///< Flag to determine if the components have to reordered in the next Update
+  bool mSubtreeBoundsEnabled;                                             ///< Whether Update computes the bounds of the sub-trees
+  bool mSubtreeBoundsDirty;                                               ///< Whether the bounds of the sub-trees have to be computed in the next Update
 };
 
 } //namespace SceneGraph
@@ -20,6 +20,9 @@
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/core.h>
+#include <dali/devel-api/threading/thread-pool.h>
+
+#include <dali/internal/common/pixel-conversion.h>
 
 #include <dali/internal/event/common/notification-manager.h>
 #include <dali/internal/event/common/property-notifier.h>
@@ -109,6 +112,19 @@ inline void EraseUsingDiscardQueue( OwnerContainer<T*>& container, T* object, Di
   }
 }
 
+/**
+ * Helper to erase the objects of an OwnerContainer for which a predicate returns true, in a single pass
+ * The order of the remaining objects is kept.
+ * @param container to remove from
+ * @param predicate called once for each object
+ */
+template < class T, class Predicate >
+inline void EraseIf( OwnerContainer<T*>& container, Predicate predicate )
+{
+  auto erased = std::stable_partition( container.Begin(), container.End(), [&predicate]( T* object ) { return !predicate( object ); } );
+  container.Erase( erased, container.End() );
+}
+
 /**
  * Descends into node's hierarchy and sorts the children of each child according to their depth-index.
  * @param[in] node The node whose hierarchy to descend
@@ -193,9 +209,6 @@ struct UpdateManager::Impl
     renderingRequired( false )
   {
     sceneController = new SceneControllerImpl( renderMessageDispatcher, renderQueue, discardQueue );
-
-    // create first 'dummy' node
-    nodes.PushBack(nullptr);
   }
 
   ~Impl()
@@ -215,12 +228,10 @@ struct UpdateManager::Impl
 
     // UpdateManager owns the Nodes. Although Nodes are pool allocated they contain heap allocated parts
     // like custom properties, which get released here
-    Vector<Node*>::Iterator iter = nodes.Begin()+1;
-    Vector<Node*>::Iterator endIter = nodes.End();
-    for(;iter!=endIter;++iter)
+    for( auto&& node : nodes )
     {
-      (*iter)->OnDestroy();
-      Node::Delete(*iter);
+      node->OnDestroy();
+      Node::Delete( node );
     }
 
     for( auto&& scene : scenes )
@@ -268,7 +279,8 @@ struct UpdateManager::Impl
   using SceneInfoPtr = std::unique_ptr< SceneInfo >;
   std::vector< SceneInfoPtr >          scenes;                        ///< A container of SceneInfo.
 
-  Vector<Node*>                        nodes;                         ///< A container of all instantiated nodes
+  Vector<Node*>                        nodes;                         ///< A container of all instantiated nodes, in no particular order
+  Vector<Node*>                        dirtyNodes;                    ///< The nodes whose dirty flags are set, see Node::SetDirtyNodeList()
 
   OwnerContainer< Camera* >            cameras;                       ///< A container of cameras
   OwnerContainer< PropertyOwner* >     customObjects;                 ///< A container of owned objects (with custom properties)
@@ -287,6 +299,8 @@ struct UpdateManager::Impl
   Mutex                                compiledShaderMutex;           ///< lock to ensure no corruption on the renderCompiledShaders
 
   OwnerPointer<FrameCallbackProcessor> frameCallbackProcessor;        ///< Owned FrameCallbackProcessor, only created if required.
+  std::unique_ptr<Dali::ThreadPool>    threadPool;                    ///< Worker threads used to parallelise the update, only created if required.
+  PixelConversion::UploadConverter     uploadConverter;               ///< Expands RGB uploads before the render thread gets them
 
   float                                keepRenderingSeconds;          ///< Set via Dali::Stage::KeepRendering
   NodePropertyFlags                    nodeDirtyFlags;                ///< cumulative node dirty flags from previous frame
@@ -378,20 +392,14 @@ void UpdateManager::AddNode( OwnerPointer<Node>& node )
 {
   DALI_ASSERT_ALWAYS( nullptr == node->GetParent() ); // Should not have a parent yet
 
-  // Nodes must be sorted by pointer
   Node* rawNode = node.Release();
   DALI_LOG_INFO( gLogFilter, Debug::General, "[%x] AddNode\n", rawNode );
 
-  Vector<Node*>::Iterator begin = mImpl->nodes.Begin();
-  for( Vector<Node*>::Iterator iter = mImpl->nodes.End()-1; iter >= begin; --iter )
-  {
-    if( rawNode > (*iter) )
-    {
-      mImpl->nodes.Insert((iter+1), rawNode );
-      rawNode->CreateTransform( &mImpl->transformManager );
-      return;
-    }
-  }
+  // The node remembers its index, so that it can be removed without a search
+  rawNode->SetNodeIndex( static_cast<uint32_t>( mImpl->nodes.Count() ) );
+  mImpl->nodes.PushBack( rawNode );
+  rawNode->CreateTransform( &mImpl->transformManager );
+  rawNode->SetDirtyNodeList( &mImpl->dirtyNodes );
 }
 
 void UpdateManager::ConnectNode( Node* parent, Node* node )
@@ -435,16 +443,16 @@ void UpdateManager::DestroyNode( Node* node )
 
   DALI_LOG_INFO( gLogFilter, Debug::General, "[%x] DestroyNode\n", node );
 
-  Vector<Node*>::Iterator iter = mImpl->nodes.Begin()+1;
-  Vector<Node*>::Iterator endIter = mImpl->nodes.End();
-  for(;iter!=endIter;++iter)
-  {
-    if((*iter) == node)
-    {
-      mImpl->nodes.Erase(iter);
-      break;
-    }
-  }
+  // Move the last node into the slot of the destroyed one
+  const uint32_t index = node->GetNodeIndex();
+  DALI_ASSERT_DEBUG( index < mImpl->nodes.Count() && mImpl->nodes[index] == node );
+  Node* lastNode = mImpl->nodes[ mImpl->nodes.Count() - 1u ];
+  mImpl->nodes[index] = lastNode;
+  lastNode->SetNodeIndex( index );
+  mImpl->nodes.Resize( mImpl->nodes.Count() - 1u );
+
+  // The node must not be reset after it has been discarded
+  node->SetDirtyNodeList( nullptr );
 
   mImpl->discardQueue.Add( mSceneGraphBuffers.GetUpdateBufferIndex(), node );
 
@@ -617,6 +625,20 @@ void UpdateManager::SetShaderProgram( Shader* shader,
   }
 }
 
+void UpdateManager::PrecompileShaderProgram( Internal::ShaderDataPtr shaderData, bool modifiesGeometry )
+{
+  if( shaderData )
+  {
+    using DerivedType = MessageValue2<RenderManager, Internal::ShaderDataPtr, bool>;
+
+    // Reserve some memory inside the render queue
+    uint32_t* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+    // Construct message in the render queue memory; note that delete should not be called on the return value
+    new (slot) DerivedType( &mImpl->renderManager, &RenderManager::PrecompileProgram, shaderData, modifiesGeometry );
+  }
+}
+
 void UpdateManager::SaveBinary( Internal::ShaderDataPtr shaderData )
 {
   DALI_ASSERT_DEBUG( shaderData && "No NULL shader data pointers please." );
@@ -674,6 +696,26 @@ uint32_t* UpdateManager::ReserveMessageSlot( uint32_t size, bool updateScene )
   return mImpl->messageQueue.ReserveMessageSlot( size, updateScene );
 }
 
+uint32_t* UpdateManager::ReservePropertyMessageSlot( uint32_t size, const void* property )
+{
+  return mImpl->messageQueue.ReservePropertyMessageSlot( size, property );
+}
+
+void UpdateManager::SetPropertyMessageCoalescing( bool enabled )
+{
+  mImpl->messageQueue.SetPropertyMessageCoalescing( enabled );
+}
+
+bool UpdateManager::IsPropertyMessageCoalescingEnabled() const
+{
+  return mImpl->messageQueue.IsPropertyMessageCoalescingEnabled();
+}
+
+uint32_t UpdateManager::GetCoalescedMessageCount() const
+{
+  return mImpl->messageQueue.GetCoalescedMessageCount();
+}
+
 void UpdateManager::EventProcessingStarted()
 {
   mImpl->messageQueue.EventProcessingStarted();
@@ -689,22 +731,13 @@ void UpdateManager::ResetProperties( BufferIndex bufferIndex )
   // Clear the "animations finished" flag; This should be set if any (previously playing) animation is stopped
   mImpl->animationFinishedDuringUpdate = false;
 
-  // Reset all animating / constrained properties
-  std::vector<PropertyResetterBase*>toDelete;
-  for( auto&& element : mImpl->propertyResetters )
-  {
-    element->ResetToBaseValue( bufferIndex );
-    if( element->IsFinished() )
-    {
-      toDelete.push_back( element );
-    }
-  }
-
+  // Reset all animating / constrained properties.
   // If a resetter is no longer required (the animator or constraint has been removed), delete it.
-  for( auto&& elementPtr : toDelete )
+  EraseIf( mImpl->propertyResetters, [bufferIndex]( PropertyResetterBase* resetter )
   {
-    mImpl->propertyResetters.EraseObject( elementPtr );
-  }
+    resetter->ResetToBaseValue( bufferIndex );
+    return resetter->IsFinished();
+  } );
 
   // Clear all root nodes dirty flags
   for( auto& scene : mImpl->scenes )
@@ -713,13 +746,12 @@ void UpdateManager::ResetProperties( BufferIndex bufferIndex )
     root->ResetDirtyFlags( bufferIndex );
   }
 
-  // Clear node dirty flags
-  Vector<Node*>::Iterator iter = mImpl->nodes.Begin()+1;
-  Vector<Node*>::Iterator endIter = mImpl->nodes.End();
-  for( ;iter != endIter; ++iter )
+  // Clear the dirty flags of the nodes which have been made dirty
+  for( auto&& node : mImpl->dirtyNodes )
   {
-    (*iter)->ResetDirtyFlags( bufferIndex );
+    node->ResetDirtyFlags( bufferIndex );
   }
+  mImpl->dirtyNodes.Clear();
 }
 
 bool UpdateManager::ProcessGestures( BufferIndex bufferIndex, uint32_t lastVSyncTimeMilliseconds, uint32_t nextVSyncTimeMilliseconds )
@@ -936,6 +968,8 @@ uint32_t UpdateManager::Update( float elapsedSeconds,
     ConstrainCustomObjects( bufferIndex );
 
     //Clear the lists of renderers from the previous update
+    //and check whether a layer needs the bounds of the sub-trees for hit testing
+    bool subtreeBoundsRequired = false;
     for( auto&& scene : mImpl->scenes )
     {
       if ( scene )
@@ -945,10 +979,12 @@ uint32_t UpdateManager::Update( float elapsedSeconds,
           if ( layer )
           {
             layer->ClearRenderables();
+            subtreeBoundsRequired = subtreeBoundsRequired || layer->IsHitTestIndexEnabled();
           }
         }
       }
     }
+    mImpl->transformManager.SetSubtreeBoundsEnabled( subtreeBoundsRequired );
 
     // Call the frame-callback-processor if set
     if( mImpl->frameCallbackProcessor )
@@ -972,6 +1008,7 @@ uint32_t UpdateManager::Update( float elapsedSeconds,
     {
       mImpl->nodeDirtyFlags |= NodePropertyFlags::TRANSFORM;
     }
+    mImpl->transformManager.PublishSubtreeBounds( bufferIndex );
 
     //Process Property Notifications
     ProcessPropertyNotifications( bufferIndex );
@@ -1078,6 +1115,9 @@ uint32_t UpdateManager::Update( float elapsedSeconds,
     mImpl->nodeDirtyFlags |= RenderableUpdateFlags;
   }
 
+  // The render thread reads the converted pixel data of this update's upload messages
+  mImpl->uploadConverter.Wait();
+
   // tell the update manager that we're done so the queue can be given to event thread
   mImpl->notificationManager.UpdateCompleted();
 
@@ -1169,6 +1209,35 @@ void UpdateManager::SetRenderingBehavior( DevelStage::Rendering renderingBehavio
   mImpl->renderingBehavior = renderingBehavior;
 }
 
+void UpdateManager::SetWorkerThreadCount( uint32_t threadCount )
+{
+  // Stop using the current worker threads before they are destroyed
+  mImpl->transformManager.SetThreadPool( nullptr );
+  mImpl->renderTaskProcessor.SetThreadPool( nullptr );
+  mImpl->uploadConverter.SetThreadPool( nullptr );
+  mImpl->threadPool.reset();
+
+  if( threadCount > 0u )
+  {
+    mImpl->threadPool = std::unique_ptr<Dali::ThreadPool>( new Dali::ThreadPool() );
+    mImpl->threadPool->Initialize( threadCount );
+    mImpl->transformManager.SetThreadPool( mImpl->threadPool.get() );
+    mImpl->renderTaskProcessor.SetThreadPool( mImpl->threadPool.get() );
+    mImpl->uploadConverter.SetThreadPool( mImpl->threadPool.get() );
+  }
+}
+
+void UpdateManager::SetProgramCacheBudget( uint32_t programCount )
+{
+  using DerivedType = MessageValue1<RenderManager, uint32_t>;
+
+  // Reserve some memory inside the render queue
+  uint32_t* slot = mImpl->renderQueue.ReserveMessageSlot( mSceneGraphBuffers.GetUpdateBufferIndex(), sizeof( DerivedType ) );
+
+  // Construct message in the render queue memory; note that delete should not be called on the return value
+  new (slot) DerivedType( &mImpl->renderManager, &RenderManager::SetProgramCacheBudget, programCount );
+}
+
 void UpdateManager::RequestRendering()
 {
   mImpl->renderingRequired = true;
@@ -1409,6 +1478,12 @@ void UpdateManager::RemoveTexture( Render::Texture* texture)
 
 void UpdateManager::UploadTexture( Render::Texture* texture, PixelDataPtr pixelData, const Texture::UploadParams& params )
 {
+  if( texture->RequiresRgbaConversion( pixelData->GetPixelFormat(), params ) )
+  {
+    // Convert before the render thread gets the data, so it only has to copy it to the texture
+    pixelData = mImpl->uploadConverter.Convert( pixelData );
+  }
+
   using DerivedType = MessageValue3<RenderManager, Render::Texture*, PixelDataPtr, Texture::UploadParams>;
 
   // Reserve some memory inside the message queue
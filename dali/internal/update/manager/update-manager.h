@@ -331,6 +331,13 @@ public:
    */
   void SetShaderProgram( Shader* shader, Internal::ShaderDataPtr shaderData, bool modifiesGeometry );
 
+  /**
+   * Request a shader program to be compiled ahead of its use
+   * @param[in] shaderData    Source code, hash over source, and optional compiled binary for the shader program
+   * @param[in] modifiesGeometry True if the vertex shader modifies geometry
+   */
+  void PrecompileShaderProgram( Internal::ShaderDataPtr shaderData, bool modifiesGeometry );
+
   /**
    * @brief Accept compiled shaders passed back on render thread for saving.
    * @param[in] shaderData Source code, hash over source, and corresponding compiled binary to be saved.
@@ -407,6 +414,34 @@ public:
    */
   uint32_t* ReserveMessageSlot( uint32_t size, bool updateScene = true );
 
+  /**
+   * Reserve space for a message which bakes the value of a property; this must then be initialized by the caller.
+   * The slot of a previous message for the same property may be returned, see Update::MessageQueue::ReservePropertyMessageSlot().
+   * @post Calling this method may invalidate any previously returned slots.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @param[in] property The property the message bakes.
+   * @return A pointer to the first char allocated for the message.
+   */
+  uint32_t* ReservePropertyMessageSlot( uint32_t size, const void* property );
+
+  /**
+   * Enable or disable the coalescing of property messages; called from the event thread.
+   * @param[in] enabled Whether a property message can supersede the previous message for the same property
+   */
+  void SetPropertyMessageCoalescing( bool enabled );
+
+  /**
+   * Query whether property messages are coalesced; called from the event thread.
+   * @return true if property messages are coalesced
+   */
+  bool IsPropertyMessageCoalescingEnabled() const;
+
+  /**
+   * Query the number of property messages which were superseded before being sent; called from the event thread.
+   * @return The number of messages
+   */
+  uint32_t GetCoalescedMessageCount() const;
+
   /**
    * @return the current event-buffer index.
    */
@@ -649,6 +684,16 @@ public:
    */
   void SetRenderingBehavior( DevelStage::Rendering renderingBehavior );
 
+  /**
+   * @copydoc Dali::Integration::Core::SetUpdateWorkerThreadCount()
+   */
+  void SetWorkerThreadCount( uint32_t threadCount );
+
+  /**
+   * @copydoc Dali::Integration::Core::SetProgramCacheBudget()
+   */
+  void SetProgramCacheBudget( uint32_t programCount );
+
   /**
    * Request to render the current frame
    * @note This is a temporary workaround (to be removed in the future) to request the rendering of
@@ -1076,6 +1121,19 @@ inline void SetShaderProgramMessage( UpdateManager& manager,
   new (slot) LocalType( &manager, &UpdateManager::SetShaderProgram, const_cast<Shader*>( &shader ), shaderData, modifiesGeometry );
 }
 
+inline void PrecompileShaderProgramMessage( UpdateManager& manager,
+                                            Internal::ShaderDataPtr shaderData,
+                                            bool modifiesGeometry )
+{
+  using LocalType = MessageValue2<UpdateManager, Internal::ShaderDataPtr, bool>;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::PrecompileShaderProgram, shaderData, modifiesGeometry );
+}
+
 inline void SetDefaultSurfaceRectMessage( UpdateManager& manager, const Rect<int32_t>& rect  )
 {
   using LocalType = MessageValue1<UpdateManager, Rect<int32_t> >;
@@ -1134,13 +1192,36 @@ inline void SetRenderingBehaviorMessage( UpdateManager& manager, DevelStage::Ren
   new (slot) LocalType( &manager, &UpdateManager::SetRenderingBehavior, renderingBehavior );
 }
 
-inline void RequestRenderingMessage( UpdateManager& manager )
+inline void SetWorkerThreadCountMessage( UpdateManager& manager, uint32_t threadCount )
 {
-  using LocalType = Message<UpdateManager>;
+  using LocalType = MessageValue1<UpdateManager, uint32_t>;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetWorkerThreadCount, threadCount );
+}
+
+inline void SetProgramCacheBudgetMessage( UpdateManager& manager, uint32_t programCount )
+{
+  using LocalType = MessageValue1<UpdateManager, uint32_t>;
 
   // Reserve some memory inside the message queue
   uint32_t* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
 
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetProgramCacheBudget, programCount );
+}
+
+inline void RequestRenderingMessage( UpdateManager& manager )
+{
+  using LocalType = Message<UpdateManager>;
+
+  // Reserve some memory inside the message queue; the request only sets a flag, so it is coalesced like a property
+  // message and does not end the window in which property messages are coalesced
+  uint32_t* slot = manager.ReservePropertyMessageSlot( sizeof( LocalType ), &manager );
+
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new (slot) LocalType( &manager, &UpdateManager::RequestRendering );
 }
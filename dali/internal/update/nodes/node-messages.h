@@ -86,7 +86,9 @@ public:
                     typename ParameterType< P >::PassingType value )
   {
     // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ) );
+    // Baking the whole value supersedes any previous bake of the property
+    uint32_t* slot = ( member == &AnimatableProperty<P>::Bake ) ? eventThreadServices.ReservePropertyMessageSlot( sizeof( NodePropertyMessage ), property )
+                                                                 : eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodePropertyMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
@@ -240,7 +242,9 @@ public:
                     const P& value )
   {
     // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformPropertyMessage ) );
+    // Baking the whole value supersedes any previous bake of the property
+    uint32_t* slot = ( member == &TransformManagerPropertyHandler<P>::Bake ) ? eventThreadServices.ReservePropertyMessageSlot( sizeof( NodeTransformPropertyMessage ), property )
+                                                                              : eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformPropertyMessage ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodeTransformPropertyMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
@@ -78,6 +78,11 @@ void Node::Delete( Node* node )
   }
 }
 
+uint32_t Node::TrimMemoryPool()
+{
+  return gNodeMemoryPool.Trim();
+}
+
 Node::Node()
 : mTransformManager( nullptr ),
   mTransformId( INVALID_TRANSFORM_ID ),
@@ -104,6 +109,9 @@ Node::Node()
   mClippingDepth( 0u ),
   mScissorDepth( 0u ),
   mDepthIndex( 0u ),
+  mDirtyNodes( nullptr ),
+  mDirtyNodeIndex( 0u ),
+  mNodeIndex( 0u ),
   mDirtyFlags( NodePropertyFlags::ALL ),
   mRegenerateUniformMap( 0 ),
   mDrawMode( DrawMode::NORMAL ),
@@ -273,7 +281,7 @@ void Node::AddRenderer( Renderer* renderer )
   // in the next update as world transform is not computed if node has no renderers.
   if( mRenderer.Empty() )
   {
-    mDirtyFlags |= NodePropertyFlags::TRANSFORM;
+    SetDirtyFlag( NodePropertyFlags::TRANSFORM );
   }
   else
   {
@@ -339,6 +347,34 @@ void Node::ResetDirtyFlags( BufferIndex updateBufferIndex )
   mDirtyFlags = NodePropertyFlags::NOTHING;
 }
 
+void Node::SetDirtyNodeList( Vector<Node*>* dirtyNodes )
+{
+  if( mDirtyNodes && mDirtyFlags != NodePropertyFlags::NOTHING )
+  {
+    // Move the last dirty node into the slot of this one
+    Node* lastNode = (*mDirtyNodes)[ mDirtyNodes->Count() - 1u ];
+    (*mDirtyNodes)[ mDirtyNodeIndex ] = lastNode;
+    lastNode->mDirtyNodeIndex = mDirtyNodeIndex;
+    mDirtyNodes->Resize( mDirtyNodes->Count() - 1u );
+  }
+
+  mDirtyNodes = dirtyNodes;
+
+  if( mDirtyNodes && mDirtyFlags != NodePropertyFlags::NOTHING )
+  {
+    AddToDirtyNodeList();
+  }
+}
+
+void Node::AddToDirtyNodeList()
+{
+  if( mDirtyNodes )
+  {
+    mDirtyNodeIndex = static_cast<uint32_t>( mDirtyNodes->Count() );
+    mDirtyNodes->PushBack( this );
+  }
+}
+
 void Node::SetParent( Node& parentNode )
 {
   DALI_ASSERT_ALWAYS(this != &parentNode);
@@ -86,6 +86,12 @@ public:
    */
   static void Delete( Node* node );
 
+  /**
+   * Releases the memory of the node memory pool which no node is using.
+   * @return The number of bytes released
+   */
+  static uint32_t TrimMemoryPool();
+
   /**
    * Called during UpdateManager::DestroyNode shortly before Node is destroyed.
    */
@@ -328,6 +334,10 @@ public:
    */
   void SetDirtyFlag( NodePropertyFlags flag )
   {
+    if( mDirtyFlags == NodePropertyFlags::NOTHING )
+    {
+      AddToDirtyNodeList();
+    }
     mDirtyFlags |= flag;
   }
 
@@ -336,7 +346,32 @@ public:
    */
   void SetAllDirtyFlags()
   {
-    mDirtyFlags = NodePropertyFlags::ALL;
+    SetDirtyFlag( NodePropertyFlags::ALL );
+  }
+
+  /**
+   * Set the list of dirty nodes, which the node adds itself to whenever its dirty flags are set,
+   * so that the flags of only those nodes have to be reset.
+   * @param[in] dirtyNodes The list of dirty nodes, or nullptr to remove the node from its list
+   */
+  void SetDirtyNodeList( Vector<Node*>* dirtyNodes );
+
+  /**
+   * Set the index of the node in the container of its owner.
+   * @param[in] index The index
+   */
+  void SetNodeIndex( uint32_t index )
+  {
+    mNodeIndex = index;
+  }
+
+  /**
+   * Retrieve the index of the node in the container of its owner.
+   * @return The index
+   */
+  uint32_t GetNodeIndex() const
+  {
+    return mNodeIndex;
   }
 
   /**
@@ -656,6 +691,19 @@ public:
     return Vector4::ZERO;
   }
 
+  /**
+   * Retrieve the world space bounds of the hit test spheres of the node and of all its descendants
+   * @param[in] bufferIndex The buffer to read from
+   * @param[out] boundsMin The minimum corner of the bounds
+   * @param[out] boundsMax The maximum corner of the bounds
+   * @return false if the bounds are not available
+   */
+  bool GetSubtreeBounds( BufferIndex bufferIndex, Vector3& boundsMin, Vector3& boundsMax ) const
+  {
+    return ( mTransformId != INVALID_TRANSFORM_ID ) &&
+           ( mTransformManager->GetSubtreeBounds( bufferIndex, mTransformId, boundsMin, boundsMax ) );
+  }
+
   /**
    * Retrieve world matrix and size of the node
    * @param[out] The local to world matrix of the node
@@ -679,6 +727,16 @@ public:
            (mTransformManager->IsLocalMatrixDirty( mTransformId ));
   }
 
+  /**
+   * Checks if world matrix has changed since last update
+   * @return true if world matrix has changed, false otherwise
+   */
+  bool IsWorldMatrixDirty() const
+  {
+    return (mTransformId != INVALID_TRANSFORM_ID) &&
+           (mTransformManager->IsWorldMatrixDirty( mTransformId ));
+  }
+
   /**
    * Retrieve the cached world-matrix of a node.
    * @param[in] bufferIndex The buffer to read from.
@@ -827,11 +885,18 @@ public:
 
   /**
    * Reset dirty flags
+   * @note The owner of the list of dirty nodes, if any, is responsible for clearing it.
    */
   void ResetDirtyFlags( BufferIndex updateBufferIndex );
 
 protected:
 
+  /**
+   * Adds the node to its list of dirty nodes, if any.
+   * @pre The node is not in the list.
+   */
+  void AddToDirtyNodeList();
+
   /**
    * Set the parent of a Node.
    * @param[in] parentNode the new parent.
@@ -947,6 +1012,10 @@ protected:
 
   uint32_t                           mDepthIndex;             ///< Depth index of the node
 
+  Vector<Node*>*                     mDirtyNodes;             ///< The list the node is added to when it becomes dirty; not owned
+  uint32_t                           mDirtyNodeIndex;         ///< The index of the node in mDirtyNodes while its dirty flags are set
+  uint32_t                           mNodeIndex;              ///< The index of the node in the container of its owner
+
   // flags, compressed to bitfield
   NodePropertyFlags                  mDirtyFlags;             ///< Dirty flags for each of the Node properties
   uint32_t                           mRegenerateUniformMap:2; ///< Indicate if the uniform map has to be regenerated this frame
@@ -46,7 +46,8 @@ Layer::Layer()
   mBehavior( Dali::Layer::LAYER_UI ),
   mIsClipping( false ),
   mDepthTestDisabled( true ),
-  mIsDefaultSortFunction( true )
+  mIsDefaultSortFunction( true ),
+  mHitTestIndexEnabled( false )
 {
   // set a flag the node to say this is a layer
   mIsLayer = true;
@@ -104,6 +105,16 @@ bool Layer::IsDepthTestDisabled() const
   return mDepthTestDisabled;
 }
 
+void Layer::SetHitTestIndexEnabled( bool enabled )
+{
+  mHitTestIndexEnabled = enabled;
+}
+
+bool Layer::IsHitTestIndexEnabled() const
+{
+  return mHitTestIndexEnabled;
+}
+
 void Layer::ClearRenderables()
 {
   colorRenderables.Clear();
@@ -166,6 +166,18 @@ public:
    */
   bool IsDepthTestDisabled() const;
 
+  /**
+   * Sets whether the hit tests of this layer use the bounds of the sub-trees to skip the actors which cannot be hit.
+   * @param[in] enabled True to enable the hit test index
+   */
+  void SetHitTestIndexEnabled( bool enabled );
+
+  /**
+   * Queries whether the hit tests of this layer use the bounds of the sub-trees.
+   * @return True if the hit test index is enabled
+   */
+  bool IsHitTestIndexEnabled() const;
+
   /**
    * Enables the reuse of the model view matrices of all renderers for this layer
    * @param[in] updateBufferIndex The current update buffer index.
@@ -239,6 +251,7 @@ private:
   bool mIsClipping:1;                 ///< True when clipping is enabled
   bool mDepthTestDisabled:1;          ///< Whether depth test is disabled.
   bool mIsDefaultSortFunction:1;      ///< whether the default depth sort function is used
+  bool mHitTestIndexEnabled:1;        ///< Whether the bounds of the sub-trees are required to hit test the layer
 
 };
 
@@ -329,6 +342,23 @@ inline void SetDepthTestDisabledMessage( EventThreadServices& eventThreadService
   new (slot) LocalType( &layer, &Layer::SetDepthTestDisabled, disable );
 }
 
+/**
+ * Create a message for enabling/disabling the hit test index.
+ *
+ * @param[in] layer The layer
+ * @param[in] enabled \e true to compute the bounds of the sub-trees for the hit tests of the layer.
+ */
+inline void SetHitTestIndexEnabledMessage( EventThreadServices& eventThreadServices, const Layer& layer, bool enabled )
+{
+  using LocalType = MessageValue1<Layer, bool>;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &layer, &Layer::SetHitTestIndexEnabled, enabled );
+}
+
 } // namespace SceneGraph
 
 // Template specialisation for OwnerPointer<Layer>, because delete is protected
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,10 +18,14 @@
 // CLASS HEADER
 #include <dali/internal/update/queue/update-message-queue.h>
 
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <unordered_map>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/vector-wrapper.h>
-#include <dali/devel-api/threading/mutex.h>
 #include <dali/integration-api/render-controller.h>
+#include <dali/internal/common/lock-free-ring.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/message-buffer.h>
 #include <dali/internal/render/common/performance-monitor.h>
@@ -45,12 +49,32 @@ namespace // unnamed namespace
 static const std::size_t INITIAL_BUFFER_SIZE =  32768;
 static const std::size_t MAX_BUFFER_CAPACITY = 73728; // Avoid keeping buffers which exceed this
 static const std::size_t MAX_FREE_BUFFER_COUNT = 3; // Allow this number of buffers to be recycled
+static const uint32_t MAX_BUFFER_COUNT = 64u; // The most buffers in use at once; a power of two as it is also the capacity of the rings
+
+/**
+ * A buffer passed to the update thread
+ */
+struct FlushedBuffer
+{
+  MessageBuffer* buffer;      ///< The flushed messages
+  bool           sceneUpdate; ///< Whether one of the messages requires a scene-graph node tree update
+};
+
+/**
+ * The slot of a property message in the current buffer
+ */
+struct PropertyMessageSlot
+{
+  std::size_t offset; ///< The position of the slot in the buffer
+  uint32_t    size;   ///< The size of the message
+};
 
 // A queue of message buffers
 typedef vector< MessageBuffer* > MessageBufferQueue;
 using MessageBufferIter = MessageBufferQueue::iterator;
 
-using MessageQueueMutex = Dali::Mutex;
+// The latest message for each property, since the last message which was not a property message
+using PropertyMessageSlots = std::unordered_map< const void*, PropertyMessageSlot >;
 
 } // unnamed namespace
 
@@ -59,6 +83,9 @@ namespace Update
 
 /**
  * Private MessageQueue data
+ *
+ * The buffers are passed between the event thread (the only producer of processQueue and consumer of recycleQueue)
+ * and the update thread (the only consumer of processQueue and producer of recycleQueue) through lock-free rings.
  */
 struct MessageQueue::Impl
 {
@@ -69,8 +96,20 @@ struct MessageQueue::Impl
     queueWasEmpty(true),
     sceneUpdateFlag( false ),
     sceneUpdate( 0 ),
-    currentMessageBuffer(nullptr)
+    pendingSceneUpdates( 0u ),
+    processQueue( MAX_BUFFER_COUNT ),
+    recycleQueue( MAX_BUFFER_COUNT ),
+    currentMessageBuffer(nullptr),
+    bufferCount( 0u ),
+    coalescedMessageCount( 0u ),
+    coalescePropertyMessages( false )
   {
+    // Buffers allocate their storage on the first message, so these are cheap to create up front
+    for( std::size_t i = 0; i < MAX_FREE_BUFFER_COUNT; ++i )
+    {
+      freeQueue.push_back( new MessageBuffer( INITIAL_BUFFER_SIZE ) );
+    }
+    bufferCount = MAX_FREE_BUFFER_COUNT;
   }
 
   ~Impl()
@@ -83,20 +122,17 @@ struct MessageQueue::Impl
     }
 
     // Delete the unprocessed buffers
-    const MessageBufferIter processQueueEndIter = processQueue.end();
-    for ( MessageBufferIter iter = processQueue.begin(); iter != processQueueEndIter; ++iter )
+    FlushedBuffer unprocessed;
+    while( processQueue.Pop( unprocessed ) )
     {
-      MessageBuffer* unprocessedBuffer = *iter;
-      DeleteBufferContents( unprocessedBuffer );
-      delete unprocessedBuffer;
+      DeleteBufferContents( unprocessed.buffer );
+      delete unprocessed.buffer;
     }
 
-    // Delete the recycled buffers
-    const MessageBufferIter recycleQueueEndIter = recycleQueue.end();
-    for ( MessageBufferIter iter = recycleQueue.begin(); iter != recycleQueueEndIter; ++iter )
+    // Delete the recycled buffers; these have already been reset
+    MessageBuffer* recycledBuffer = nullptr;
+    while( recycleQueue.Pop( recycledBuffer ) )
     {
-      MessageBuffer* recycledBuffer = *iter;
-      DeleteBufferContents( recycledBuffer );
       delete recycledBuffer;
     }
 
@@ -120,20 +156,59 @@ struct MessageQueue::Impl
     }
   }
 
+  /**
+   * Moves the buffers processed by the update thread to the free queue, called from the event thread.
+   */
+  void RecycleBuffers()
+  {
+    MessageBuffer* recycled = nullptr;
+    while( recycleQueue.Pop( recycled ) )
+    {
+      // Guard against excessive message buffer growth
+      if ( MAX_FREE_BUFFER_COUNT < freeQueue.size() ||
+           MAX_BUFFER_CAPACITY   < recycled->GetCapacity() )
+      {
+        delete recycled;
+        --bufferCount;
+      }
+      else
+      {
+        freeQueue.push_back( recycled );
+      }
+    }
+  }
+
+  /**
+   * Ends the window in which property messages are coalesced, called from the event thread.
+   * Messages queued from now on must be processed after the ones already queued.
+   */
+  void EndCoalescingWindow()
+  {
+    if( !propertyMessageSlots.empty() )
+    {
+      propertyMessageSlots.clear();
+    }
+  }
+
   RenderController&        renderController;     ///< render controller
   const SceneGraphBuffers& sceneGraphBuffers;    ///< Used to keep track of which buffers are being written or read.
 
   bool                     processingEvents;     ///< Whether messages queued will be flushed by core
   bool                     queueWasEmpty;        ///< Flag whether the queue was empty during the Update()
   bool                     sceneUpdateFlag;      ///< true when there is a new message that requires a scene-graph node tree update
-  int                      sceneUpdate;          ///< Non zero when there is a message in the queue requiring a scene-graph node tree update
+  int                      sceneUpdate;          ///< Non zero when a processed message required a scene-graph node tree update; used by the update thread
+  std::atomic< uint32_t >  pendingSceneUpdates;  ///< The number of flushed buffers waiting in processQueue that require a scene-graph node tree update
 
-  MessageQueueMutex        queueMutex;           ///< queueMutex must be locked whilst accessing processQueue or recycleQueue
-  MessageBufferQueue       processQueue;         ///< to process in the next update
-  MessageBufferQueue       recycleQueue;         ///< to recycle MessageBuffers after the messages have been processed
+  LockFreeRing< FlushedBuffer > processQueue;    ///< to process in the next update
+  LockFreeRing< MessageBuffer* > recycleQueue;   ///< to recycle MessageBuffers after the messages have been processed
 
-  MessageBuffer*           currentMessageBuffer; ///< can be used without locking
-  MessageBufferQueue       freeQueue;            ///< buffers from the recycleQueue; can be used without locking
+  MessageBuffer*           currentMessageBuffer; ///< used by the event thread only
+  MessageBufferQueue       freeQueue;            ///< buffers from the recycleQueue; used by the event thread only
+  uint32_t                 bufferCount;          ///< The number of buffers allocated, never more than MAX_BUFFER_COUNT
+
+  PropertyMessageSlots     propertyMessageSlots; ///< The property messages in currentMessageBuffer which can be superseded; used by the event thread only
+  uint32_t                 coalescedMessageCount; ///< The number of property messages superseded by a later one
+  bool                     coalescePropertyMessages; ///< Whether property messages are coalesced
 };
 
 MessageQueue::MessageQueue( Integration::RenderController& controller, const SceneGraph::SceneGraphBuffers& buffers )
@@ -154,6 +229,56 @@ void MessageQueue::EventProcessingStarted()
 
 // Called from event thread
 uint32_t* MessageQueue::ReserveMessageSlot( uint32_t requestedSize, bool updateScene )
+{
+  // The message may depend on any earlier one, so no earlier message can be moved after it
+  mImpl->EndCoalescingWindow();
+
+  return ReserveSlot( requestedSize, updateScene );
+}
+
+// Called from event thread
+uint32_t* MessageQueue::ReservePropertyMessageSlot( uint32_t requestedSize, const void* property )
+{
+  if( !mImpl->coalescePropertyMessages )
+  {
+    return ReserveMessageSlot( requestedSize, true );
+  }
+
+  auto iter = mImpl->propertyMessageSlots.find( property );
+  if( iter != mImpl->propertyMessageSlots.end() && iter->second.size == requestedSize )
+  {
+    // Only property messages of other properties have been queued since, so the new value can be set in place of the old one
+    uint32_t* slot = mImpl->currentMessageBuffer->GetSlot( iter->second.offset );
+
+    // Call virtual destructor explictly; since delete will not be called after placement new
+    reinterpret_cast< MessageBase* >( slot )->~MessageBase();
+
+    ++mImpl->coalescedMessageCount;
+    return slot;
+  }
+
+  uint32_t* slot = ReserveSlot( requestedSize, true );
+  mImpl->propertyMessageSlots[ property ] = { mImpl->currentMessageBuffer->GetSlotOffset( slot ), requestedSize };
+  return slot;
+}
+
+void MessageQueue::SetPropertyMessageCoalescing( bool enabled )
+{
+  mImpl->EndCoalescingWindow();
+  mImpl->coalescePropertyMessages = enabled;
+}
+
+bool MessageQueue::IsPropertyMessageCoalescingEnabled() const
+{
+  return mImpl->coalescePropertyMessages;
+}
+
+uint32_t MessageQueue::GetCoalescedMessageCount() const
+{
+  return mImpl->coalescedMessageCount;
+}
+
+uint32_t* MessageQueue::ReserveSlot( uint32_t requestedSize, bool updateScene )
 {
   DALI_ASSERT_DEBUG( 0 != requestedSize );
 
@@ -164,6 +289,11 @@ uint32_t* MessageQueue::ReserveMessageSlot( uint32_t requestedSize, bool updateS
 
   if ( !mImpl->currentMessageBuffer )
   {
+    if( mImpl->freeQueue.empty() )
+    {
+      mImpl->RecycleBuffers();
+    }
+
     const MessageBufferIter endIter = mImpl->freeQueue.end();
 
     // Find the largest recycled buffer from freeQueue
@@ -185,7 +315,11 @@ uint32_t* MessageQueue::ReserveMessageSlot( uint32_t requestedSize, bool updateS
     }
     else
     {
+      // FlushQueue only releases the current buffer while a new one may still be allocated
+      DALI_ASSERT_DEBUG( mImpl->bufferCount < MAX_BUFFER_COUNT );
+
       mImpl->currentMessageBuffer = new MessageBuffer( INITIAL_BUFFER_SIZE );
+      ++mImpl->bufferCount;
     }
   }
 
@@ -204,37 +338,35 @@ bool MessageQueue::FlushQueue()
 {
   const bool messagesToProcess = ( nullptr != mImpl->currentMessageBuffer );
 
+  // Messages are only coalesced within the buffer they were written to
+  mImpl->EndCoalescingWindow();
+
   // If there're messages to flush
   if ( messagesToProcess )
   {
-    // queueMutex must be locked whilst accessing processQueue or recycleQueue
-    MessageQueueMutex::ScopedLock lock( mImpl->queueMutex );
-
-    mImpl->processQueue.push_back( mImpl->currentMessageBuffer );
-    mImpl->currentMessageBuffer = nullptr;
-
     // Grab any recycled MessageBuffers
-    while ( !mImpl->recycleQueue.empty() )
-    {
-      MessageBuffer* recycled = mImpl->recycleQueue.back();
-      mImpl->recycleQueue.pop_back();
+    mImpl->RecycleBuffers();
 
-      // Guard against excessive message buffer growth
-      if ( MAX_FREE_BUFFER_COUNT < mImpl->freeQueue.size() ||
-           MAX_BUFFER_CAPACITY   < recycled->GetCapacity() )
-      {
-        delete recycled;
-      }
-      else
+    if( mImpl->freeQueue.empty() && mImpl->bufferCount == MAX_BUFFER_COUNT )
+    {
+      // The update thread is too far behind; keep adding to the current buffer and flush it once buffers are recycled
+      mImpl->renderController.RequestProcessEventsOnIdle( false );
+    }
+    else
+    {
+      const FlushedBuffer flushed = { mImpl->currentMessageBuffer, mImpl->sceneUpdateFlag };
+      if( flushed.sceneUpdate )
       {
-        mImpl->freeQueue.push_back( recycled );
+        // Counted before the buffer is visible to the update thread, so that it is never decremented below zero
+        mImpl->pendingSceneUpdates.fetch_add( 1u, std::memory_order_relaxed );
+        mImpl->sceneUpdateFlag = false;
       }
-    }
 
-    if( mImpl->sceneUpdateFlag )
-    {
-      mImpl->sceneUpdate |= 2;
-      mImpl->sceneUpdateFlag = false;
+      // Cannot fail, the ring has room for every buffer that can be allocated
+      const bool pushed = mImpl->processQueue.Push( flushed );
+      DALI_ASSERT_ALWAYS( pushed && "Message queue overflow" );
+
+      mImpl->currentMessageBuffer = nullptr;
     }
   }
 
@@ -247,13 +379,17 @@ bool MessageQueue::ProcessMessages( BufferIndex updateBufferIndex )
 {
   PERF_MONITOR_START(PerformanceMonitor::PROCESS_MESSAGES);
 
-  // queueMutex must be locked whilst accessing queue
-  MessageQueueMutex::ScopedLock lock( mImpl->queueMutex );
+  // Only process the buffers flushed so far; any flushed from now on are left for the next update
+  uint32_t count = mImpl->processQueue.GetCount();
 
-  const MessageBufferIter processQueueEndIter = mImpl->processQueue.end();
-  for ( MessageBufferIter iter = mImpl->processQueue.begin(); iter != processQueueEndIter ; ++iter )
+  mImpl->queueWasEmpty = ( 0u == count ); // Flag whether we processed anything
+
+  FlushedBuffer flushed;
+  while( count > 0u && mImpl->processQueue.Pop( flushed ) )
   {
-    MessageBuffer* buffer = *iter;
+    --count;
+
+    MessageBuffer* buffer = flushed.buffer;
 
     for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
     {
@@ -266,16 +402,19 @@ bool MessageQueue::ProcessMessages( BufferIndex updateBufferIndex )
     }
     buffer->Reset();
 
+    if( flushed.sceneUpdate )
+    {
+      mImpl->sceneUpdate |= 2;
+      mImpl->pendingSceneUpdates.fetch_sub( 1u, std::memory_order_relaxed );
+    }
+
     // Pass back for use in the event-thread
-    mImpl->recycleQueue.push_back( buffer );
+    const bool pushed = mImpl->recycleQueue.Push( buffer );
+    DALI_ASSERT_ALWAYS( pushed && "Message recycle queue overflow" );
   }
 
   mImpl->sceneUpdate >>= 1;
 
-  mImpl->queueWasEmpty = mImpl->processQueue.empty(); // Flag whether we processed anything
-
-  mImpl->processQueue.clear();
-
   PERF_MONITOR_END(PerformanceMonitor::PROCESS_MESSAGES);
 
   return ( mImpl->sceneUpdate & 0x01 ); // if it was previously 2, scene graph was updated.
@@ -288,7 +427,12 @@ bool MessageQueue::WasEmpty() const
 
 bool MessageQueue::IsSceneUpdateRequired() const
 {
-  return mImpl->sceneUpdate;
+  return mImpl->sceneUpdate || ( mImpl->pendingSceneUpdates.load( std::memory_order_relaxed ) > 0u );
+}
+
+uint32_t MessageQueue::GetHighWaterMark() const
+{
+  return mImpl->processQueue.GetHighWaterMark();
 }
 
 } // namespace Update
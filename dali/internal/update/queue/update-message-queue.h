@@ -76,6 +76,35 @@ public:
    */
   uint32_t* ReserveMessageSlot( uint32_t size, bool updateScene );
 
+  /**
+   * Reserve space for a message which bakes the value of a property.
+   * When coalescing is enabled and the previous message for the property has not been flushed, and only
+   * property messages have been reserved since, the slot of the previous message is returned instead;
+   * that message is destroyed as the new one supersedes it.
+   * @param[in] size the message size with respect to the size of type 'char'
+   * @param[in] property The property the message bakes
+   * @return A pointer to the first char allocated for the message
+   */
+  uint32_t* ReservePropertyMessageSlot( uint32_t size, const void* property );
+
+  /**
+   * Enable or disable the coalescing of property messages.
+   * @param[in] enabled Whether a property message can supersede the previous message for the same property
+   */
+  void SetPropertyMessageCoalescing( bool enabled );
+
+  /**
+   * Query whether property messages are coalesced.
+   * @return true if property messages are coalesced
+   */
+  bool IsPropertyMessageCoalescingEnabled() const;
+
+  /**
+   * Query the number of property messages which have been superseded and never sent to the update thread.
+   * @return The number of messages
+   */
+  uint32_t GetCoalescedMessageCount() const;
+
   /**
    * Flushes the message queue
    * @return true if there are messages to process
@@ -103,8 +132,22 @@ public:
    */
   bool IsSceneUpdateRequired() const;
 
+  /**
+   * Query the largest number of flushed message buffers that have been waiting to be processed.
+   * @return The high water mark of the queue
+   */
+  uint32_t GetHighWaterMark() const;
+
 private:
 
+  /**
+   * Helper to reserve space for a message in the current buffer
+   * @param[in] size the message size with respect to the size of type 'char'
+   * @param[in] updateScene If set to true, denotes that the message will cause the scene graph node tree to require an update
+   * @return A pointer to the first char allocated for the message
+   */
+  uint32_t* ReserveSlot( uint32_t size, bool updateScene );
+
   /**
    * Helper to call Process and destructor on each queued message
    * @param[in] minorQueue The queue to process.
@@ -370,7 +370,7 @@ const PropertyInputImpl* Camera::GetViewMatrix() const
 void Camera::Update( BufferIndex updateBufferIndex )
 {
   // if owning node has changes in world position we need to update camera for next 2 frames
-  if( mNode->IsLocalMatrixDirty() )
+  if( mNode->IsWorldMatrixDirty() )
   {
     mUpdateViewFlag = UPDATE_COUNT;
   }
@@ -56,6 +56,11 @@ void RenderTaskList::operator delete( void* ptr )
   gRenderTaskListMemoryPool.FreeThreadSafe( static_cast<RenderTaskList*>( ptr ) );
 }
 
+uint32_t RenderTaskList::TrimMemoryPool()
+{
+  return gRenderTaskListMemoryPool.Trim();
+}
+
 void RenderTaskList::SetRenderMessageDispatcher( RenderMessageDispatcher* renderMessageDispatcher )
 {
   mRenderMessageDispatcher = renderMessageDispatcher;
@@ -62,6 +62,12 @@ public:
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the memory of the render task list memory pool which no render task list is using.
+   * @return The number of bytes released
+   */
+  static uint32_t TrimMemoryPool();
+
   /**
    * Set the renderMessageDispatcher to send message.
    * @param[in] renderMessageDispatcher The renderMessageDispatcher to send messages.
@@ -17,6 +17,9 @@
 // CLASS HEADER
 #include "scene-graph-renderer.h"
 
+// EXTERNAL INCLUDES
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/internal-constants.h>
 #include <dali/internal/common/memory-pool-object-allocator.h>
@@ -93,30 +96,113 @@ void AddMappings( CollectedUniformMap& localMap, const UniformMap& uniformMap )
   }
 }
 
-// Flags for re-sending data to renderer.
-enum Flags
-{
-  RESEND_GEOMETRY                    = 1 << 0,
-  RESEND_FACE_CULLING_MODE           = 1 << 1,
-  RESEND_BLEND_COLOR                 = 1 << 2,
-  RESEND_BLEND_BIT_MASK              = 1 << 3,
-  RESEND_PREMULTIPLIED_ALPHA         = 1 << 4,
-  RESEND_INDEXED_DRAW_FIRST_ELEMENT  = 1 << 5,
-  RESEND_INDEXED_DRAW_ELEMENTS_COUNT = 1 << 6,
-  RESEND_DEPTH_WRITE_MODE            = 1 << 7,
-  RESEND_DEPTH_TEST_MODE             = 1 << 8,
-  RESEND_DEPTH_FUNCTION              = 1 << 9,
-  RESEND_RENDER_MODE                 = 1 << 10,
-  RESEND_STENCIL_FUNCTION            = 1 << 11,
-  RESEND_STENCIL_FUNCTION_MASK       = 1 << 12,
-  RESEND_STENCIL_FUNCTION_REFERENCE  = 1 << 13,
-  RESEND_STENCIL_MASK                = 1 << 14,
-  RESEND_STENCIL_OPERATION_ON_FAIL   = 1 << 15,
-  RESEND_STENCIL_OPERATION_ON_Z_FAIL = 1 << 16,
-  RESEND_STENCIL_OPERATION_ON_Z_PASS = 1 << 17,
-  RESEND_WRITE_TO_COLOR_BUFFER       = 1 << 18,
-  RESEND_SHADER                      = 1 << 19,
-  RESEND_DRAW_COMMANDS               = 1 << 20
+// Flags for re-sending data to renderer; all the changes are sent in one message
+enum Flags : uint32_t
+{
+  RESEND_GEOMETRY                    = Render::Renderer::GEOMETRY,
+  RESEND_DRAW_COMMANDS               = Render::Renderer::DRAW_COMMANDS,
+  RESEND_FACE_CULLING_MODE           = Render::Renderer::FACE_CULLING_MODE,
+  RESEND_BLEND_BIT_MASK              = Render::Renderer::BLEND_BIT_MASK,
+  RESEND_BLEND_COLOR                 = Render::Renderer::BLEND_COLOR,
+  RESEND_PREMULTIPLIED_ALPHA         = Render::Renderer::PREMULTIPLIED_ALPHA,
+  RESEND_INDEXED_DRAW_FIRST_ELEMENT  = Render::Renderer::INDEXED_DRAW_FIRST_ELEMENT,
+  RESEND_INDEXED_DRAW_ELEMENTS_COUNT = Render::Renderer::INDEXED_DRAW_ELEMENTS_COUNT,
+  RESEND_DEPTH_WRITE_MODE            = Render::Renderer::DEPTH_WRITE_MODE,
+  RESEND_DEPTH_TEST_MODE             = Render::Renderer::DEPTH_TEST_MODE,
+  RESEND_DEPTH_FUNCTION              = Render::Renderer::DEPTH_FUNCTION,
+  RESEND_RENDER_MODE                 = Render::Renderer::RENDER_MODE,
+  RESEND_STENCIL_FUNCTION            = Render::Renderer::STENCIL_FUNCTION,
+  RESEND_STENCIL_FUNCTION_MASK       = Render::Renderer::STENCIL_FUNCTION_MASK,
+  RESEND_STENCIL_FUNCTION_REFERENCE  = Render::Renderer::STENCIL_FUNCTION_REFERENCE,
+  RESEND_STENCIL_MASK                = Render::Renderer::STENCIL_MASK,
+  RESEND_STENCIL_OPERATION_ON_FAIL   = Render::Renderer::STENCIL_OPERATION_ON_FAIL,
+  RESEND_STENCIL_OPERATION_ON_Z_FAIL = Render::Renderer::STENCIL_OPERATION_ON_Z_FAIL,
+  RESEND_STENCIL_OPERATION_ON_Z_PASS = Render::Renderer::STENCIL_OPERATION_ON_Z_PASS,
+  RESEND_SHADER                      = Render::Renderer::SHADER
+};
+
+// Large enough for the values of all the fields
+const uint32_t MAX_STATE_VALUES_SIZE = 128u;
+
+/**
+ * Packs the values of the changed renderer state, see Render::Renderer::ApplyStateChanges()
+ */
+class StateValueWriter
+{
+public:
+
+  StateValueWriter()
+  : mSize( 0u )
+  {
+  }
+
+  template< typename T >
+  void Write( const T& value )
+  {
+    DALI_ASSERT_DEBUG( mSize + sizeof( T ) <= MAX_STATE_VALUES_SIZE );
+    memcpy( mValues + mSize, static_cast<const void*>( &value ), sizeof( T ) );
+    mSize += static_cast<uint32_t>( sizeof( T ) );
+  }
+
+  const uint8_t* GetValues() const
+  {
+    return mValues;
+  }
+
+  uint32_t GetSize() const
+  {
+    return mSize;
+  }
+
+private:
+
+  uint8_t  mValues[ MAX_STATE_VALUES_SIZE ];
+  uint32_t mSize;
+};
+
+/**
+ * Message which changes several parts of the state of a Render::Renderer.
+ * The packed values are stored in the message slot, directly after the message.
+ */
+class StateChangesMessage : public MessageBase
+{
+public:
+
+  /**
+   * Queues the message
+   * @param[in] renderQueue The queue to add the message to
+   * @param[in] updateBufferIndex The current update buffer index
+   * @param[in] renderer The renderer to change
+   * @param[in] changedFields The bitmask of Render::Renderer::StateField values
+   * @param[in] writer The packed values of the changed fields
+   */
+  static void Send( RenderQueue& renderQueue, BufferIndex updateBufferIndex, Render::Renderer* renderer, uint32_t changedFields, const StateValueWriter& writer )
+  {
+    uint32_t* slot = renderQueue.ReserveMessageSlot( updateBufferIndex, sizeof( StateChangesMessage ) + writer.GetSize() );
+    StateChangesMessage* message = new (slot) StateChangesMessage( renderer, changedFields );
+    memcpy( message + 1, writer.GetValues(), writer.GetSize() );
+  }
+
+  /**
+   * @copydoc MessageBase::Process
+   */
+  void Process( BufferIndex /*bufferIndex*/ ) override
+  {
+    mRenderer->ApplyStateChanges( mChangedFields, reinterpret_cast< const uint8_t* >( this + 1 ) );
+  }
+
+private:
+
+  StateChangesMessage( Render::Renderer* renderer, uint32_t changedFields )
+  : mRenderer( renderer ),
+    mChangedFields( changedFields )
+  {
+  }
+
+private:
+
+  Render::Renderer* mRenderer;
+  uint32_t mChangedFields;
 };
 
 } // Anonymous namespace
@@ -176,6 +262,11 @@ void Renderer::operator delete( void* ptr )
   gRendererMemoryPool.FreeThreadSafe( static_cast<Renderer*>( ptr ) );
 }
 
+uint32_t Renderer::TrimMemoryPool()
+{
+  return gRendererMemoryPool.Trim();
+}
+
 
 bool Renderer::PrepareRender( BufferIndex updateBufferIndex )
 {
@@ -231,145 +322,107 @@ bool Renderer::PrepareRender( BufferIndex updateBufferIndex )
 
   if( mResendFlag != 0 )
   {
+    StateValueWriter writer;
+
     if( mResendFlag & RESEND_GEOMETRY )
     {
-      typedef MessageValue1< Render::Renderer, Render::Geometry* > DerivedType;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetGeometry, mGeometry );
+      writer.Write( mGeometry );
     }
 
     if( mResendFlag & RESEND_DRAW_COMMANDS )
     {
-      using DerivedType = MessageValue2<Render::Renderer, Dali::DevelRenderer::DrawCommand*, uint32_t>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetDrawCommands, mDrawCommands.data(), mDrawCommands.size() );
+      writer.Write( mDrawCommands.data() );
+      writer.Write( static_cast<uint32_t>( mDrawCommands.size() ) );
     }
 
     if( mResendFlag & RESEND_FACE_CULLING_MODE )
     {
-      using DerivedType = MessageValue1<Render::Renderer, FaceCullingMode::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetFaceCullingMode, mFaceCullingMode );
+      writer.Write( static_cast<uint8_t>( mFaceCullingMode ) );
     }
 
     if( mResendFlag & RESEND_BLEND_BIT_MASK )
     {
-      using DerivedType = MessageValue1<Render::Renderer, uint32_t>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetBlendingBitMask, mBlendBitmask );
+      writer.Write( mBlendBitmask );
     }
 
     if( mResendFlag & RESEND_BLEND_COLOR )
     {
-      using DerivedType = MessageValue1<Render::Renderer, Vector4>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetBlendColor, GetBlendColor() );
+      writer.Write( GetBlendColor() );
     }
 
-    if( mResendFlag & RESEND_PREMULTIPLIED_ALPHA  )
+    if( mResendFlag & RESEND_PREMULTIPLIED_ALPHA )
     {
-      using DerivedType = MessageValue1<Render::Renderer, bool>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::EnablePreMultipliedAlpha, mPremultipledAlphaEnabled );
+      writer.Write( static_cast<uint8_t>( mPremultipledAlphaEnabled ) );
     }
 
     if( mResendFlag & RESEND_INDEXED_DRAW_FIRST_ELEMENT )
     {
-      using DerivedType = MessageValue1<Render::Renderer, uint32_t>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetIndexedDrawFirstElement, mIndexedDrawFirstElement );
+      writer.Write( mIndexedDrawFirstElement );
     }
 
     if( mResendFlag & RESEND_INDEXED_DRAW_ELEMENTS_COUNT )
     {
-      using DerivedType = MessageValue1<Render::Renderer, uint32_t>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetIndexedDrawElementsCount, mIndexedDrawElementsCount );
+      writer.Write( mIndexedDrawElementsCount );
     }
 
     if( mResendFlag & RESEND_DEPTH_WRITE_MODE )
     {
-      using DerivedType = MessageValue1<Render::Renderer, DepthWriteMode::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetDepthWriteMode, mDepthWriteMode );
+      writer.Write( static_cast<uint8_t>( mDepthWriteMode ) );
     }
 
     if( mResendFlag & RESEND_DEPTH_TEST_MODE )
     {
-      using DerivedType = MessageValue1<Render::Renderer, DepthTestMode::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetDepthTestMode, mDepthTestMode );
+      writer.Write( static_cast<uint8_t>( mDepthTestMode ) );
     }
 
     if( mResendFlag & RESEND_DEPTH_FUNCTION )
     {
-      using DerivedType = MessageValue1<Render::Renderer, DepthFunction::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetDepthFunction, mDepthFunction );
+      writer.Write( static_cast<uint8_t>( mDepthFunction ) );
     }
 
     if( mResendFlag & RESEND_RENDER_MODE )
     {
-      using DerivedType = MessageValue1<Render::Renderer, RenderMode::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetRenderMode, mStencilParameters.renderMode );
+      writer.Write( static_cast<uint8_t>( mStencilParameters.renderMode ) );
     }
 
     if( mResendFlag & RESEND_STENCIL_FUNCTION )
     {
-      using DerivedType = MessageValue1<Render::Renderer, StencilFunction::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetStencilFunction, mStencilParameters.stencilFunction );
+      writer.Write( static_cast<uint8_t>( mStencilParameters.stencilFunction ) );
     }
 
     if( mResendFlag & RESEND_STENCIL_FUNCTION_MASK )
     {
-      using DerivedType = MessageValue1<Render::Renderer, int>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetStencilFunctionMask, mStencilParameters.stencilFunctionMask );
+      writer.Write( static_cast<int32_t>( mStencilParameters.stencilFunctionMask ) );
     }
 
     if( mResendFlag & RESEND_STENCIL_FUNCTION_REFERENCE )
     {
-      using DerivedType = MessageValue1<Render::Renderer, int>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetStencilFunctionReference, mStencilParameters.stencilFunctionReference );
+      writer.Write( static_cast<int32_t>( mStencilParameters.stencilFunctionReference ) );
     }
 
     if( mResendFlag & RESEND_STENCIL_MASK )
     {
-      using DerivedType = MessageValue1<Render::Renderer, int>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetStencilMask, mStencilParameters.stencilMask );
+      writer.Write( static_cast<int32_t>( mStencilParameters.stencilMask ) );
     }
 
     if( mResendFlag & RESEND_STENCIL_OPERATION_ON_FAIL )
     {
-      using DerivedType = MessageValue1<Render::Renderer, StencilOperation::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetStencilOperationOnFail, mStencilParameters.stencilOperationOnFail );
+      writer.Write( static_cast<uint8_t>( mStencilParameters.stencilOperationOnFail ) );
     }
 
     if( mResendFlag & RESEND_STENCIL_OPERATION_ON_Z_FAIL )
     {
-      using DerivedType = MessageValue1<Render::Renderer, StencilOperation::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetStencilOperationOnZFail, mStencilParameters.stencilOperationOnZFail );
+      writer.Write( static_cast<uint8_t>( mStencilParameters.stencilOperationOnZFail ) );
     }
 
     if( mResendFlag & RESEND_STENCIL_OPERATION_ON_Z_PASS )
     {
-      using DerivedType = MessageValue1<Render::Renderer, StencilOperation::Type>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetStencilOperationOnZPass, mStencilParameters.stencilOperationOnZPass );
+      writer.Write( static_cast<uint8_t>( mStencilParameters.stencilOperationOnZPass ) );
     }
 
-    if( mResendFlag & RESEND_SHADER )
-    {
-      using DerivedType = MessageValue1<Render::Renderer, bool>;
-      uint32_t* slot = mSceneController->GetRenderQueue().ReserveMessageSlot( updateBufferIndex, sizeof( DerivedType ) );
-      new (slot) DerivedType( mRenderer, &Render::Renderer::SetShaderChanged, true );
-    }
+    // RESEND_SHADER has no value
+
+    StateChangesMessage::Send( mSceneController->GetRenderQueue(), updateBufferIndex, mRenderer, mResendFlag, writer );
 
     mResendFlag = 0;
   }
@@ -84,6 +84,12 @@ public:
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the memory of the renderer memory pool which no renderer is using.
+   * @return The number of bytes released
+   */
+  static uint32_t TrimMemoryPool();
+
   /**
    * Set the texture set for the renderer
    * @param[in] textureSet The texture set this renderer will use
@@ -62,6 +62,11 @@ void TextureSet::operator delete( void* ptr )
   gTextureSetMemoryPool.FreeThreadSafe( static_cast<TextureSet*>( ptr ) );
 }
 
+uint32_t TextureSet::TrimMemoryPool()
+{
+  return gTextureSetMemoryPool.Trim();
+}
+
 void TextureSet::SetSampler( uint32_t index, Render::Sampler* sampler )
 {
   const uint32_t samplerCount = static_cast<uint32_t>( mSamplers.Size() );
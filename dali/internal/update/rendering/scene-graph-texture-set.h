@@ -57,6 +57,12 @@ public:
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the memory of the texture set memory pool which no texture set is using.
+   * @return The number of bytes released
+   */
+  static uint32_t TrimMemoryPool();
+
   /**
    * Set the sampler to be used by the texture at position "index"
    * @param[in] index The index of the texture
@@ -68,7 +68,9 @@ void Path::GenerateControlPoints(float curvature)
 
 void Path::Sample(float progress, Vector3& position, Vector3& tangent) const
 {
-  GetImplementation(*this).Sample(progress, position, tangent);
+  const Internal::Path& path = GetImplementation(*this);
+  path.PrepareArcLengthTable();
+  path.Sample(progress, position, tangent);
 }
 
 Vector3& Path::GetPoint(size_t index)
@@ -25,6 +25,7 @@
 #include <ostream>
 
 // INTERNAL INCLUDES
+#include <dali/internal/common/math-simd.h>
 #include <dali/internal/render/common/performance-monitor.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/math/math-utils.h>
@@ -159,6 +160,39 @@ void Matrix::InvertTransform(Matrix& result) const
 
   DALI_ASSERT_ALWAYS(EqualsZero(mMatrix[3]) && EqualsZero(mMatrix[7]) && EqualsZero(mMatrix[11]) && Equals(mMatrix[15], 1.0f) && "Must be a transform matrix");
 
+#ifdef DALI_MATH_SIMD
+
+  // Transpose the matrix, the transposed rows are the rotation part of the inverse
+#ifdef DALI_MATH_SIMD_SSE
+  __m128 column0 = _mm_loadu_ps(mMatrix);
+  __m128 column1 = _mm_loadu_ps(mMatrix + ROW1_OFFSET);
+  __m128 column2 = _mm_loadu_ps(mMatrix + ROW2_OFFSET);
+  __m128 column3 = _mm_loadu_ps(mMatrix + ROW3_OFFSET);
+  _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+  const Internal::Simd::Float4 columns[4] = {column0, column1, column2, column3};
+#else
+  const float32x4x4_t          transposed = vld4q_f32(mMatrix);
+  const Internal::Simd::Float4 columns[4] = {transposed.val[0], transposed.val[1], transposed.val[2], transposed.val[3]};
+#endif
+
+  // The translation is the negated translation of this matrix rotated by the transposed rotation
+  Internal::Simd::Float4 translation = Internal::Simd::Multiply(columns[0], -mMatrix[12]);
+  translation                        = Internal::Simd::MultiplyAdd(translation, columns[1], -mMatrix[13]);
+  translation                        = Internal::Simd::MultiplyAdd(translation, columns[2], -mMatrix[14]);
+  translation                        = Internal::Simd::MultiplyAdd(translation, columns[3], -mMatrix[15]);
+
+  Internal::Simd::Store(m1, columns[0]);
+  Internal::Simd::Store(m1 + ROW1_OFFSET, columns[1]);
+  Internal::Simd::Store(m1 + ROW2_OFFSET, columns[2]);
+  Internal::Simd::Store(m1 + ROW3_OFFSET, translation);
+
+  m1[3]  = 0.0f;
+  m1[7]  = 0.0f;
+  m1[11] = 0.0f;
+  m1[15] = 1.0f;
+
+#else
+
   m1[0] = mMatrix[0];
   m1[1] = mMatrix[4];
   m1[2] = mMatrix[8];
@@ -178,6 +212,8 @@ void Matrix::InvertTransform(Matrix& result) const
   m1[13] = -((mMatrix[4] * mMatrix[12]) + (mMatrix[5] * mMatrix[13]) + (mMatrix[6] * mMatrix[14]) + (mMatrix[7] * mMatrix[15]));
   m1[14] = -((mMatrix[8] * mMatrix[12]) + (mMatrix[9] * mMatrix[13]) + (mMatrix[10] * mMatrix[14]) + (mMatrix[11] * mMatrix[15]));
   m1[15] = 1.0f;
+
+#endif
 }
 
 static bool InvertMatrix(const float* m, float* out)
@@ -291,7 +327,14 @@ void Matrix::Multiply(Matrix& result, const Matrix& lhs, const Matrix& rhs)
   const float* rhsPtr = rhs.AsFloat();
   const float* lhsPtr = lhs.AsFloat();
 
-#ifndef __ARM_NEON__
+#if defined(DALI_MATH_SIMD)
+
+  // All of rhs is loaded before anything is stored, so result may alias either operand
+  Internal::Simd::Float4 rhsRows[4];
+  Internal::Simd::LoadMatrix(rhsRows, rhsPtr);
+  Internal::Simd::MultiplyMatrix(temp, lhsPtr, rhsRows);
+
+#elif !defined(__ARM_NEON__)
 
   for(int32_t i = 0; i < 4; i++)
   {
@@ -597,6 +640,35 @@ void Matrix::SetTransformComponents(const Vector3&    scale,
     MATH_INCREASE_COUNTER(PerformanceMonitor::MATRIX_MULTIPLYS);
     MATH_INCREASE_BY(PerformanceMonitor::FLOAT_POINT_MULTIPLY, 27); // 27 = 9+18
 
+#ifdef DALI_MATH_SIMD_SSE
+
+    // Each row of the rotation matrix is the identity row plus two scaled permutations of the quaternion, e.g.
+    // row0 = (1, 0, 0) + 2y * (-y, x, -w) + 2z * (-z, w, x)
+    const __m128 q    = _mm_loadu_ps(rotation.mVector.AsFloat());
+    const __m128 yxwz = _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1));
+    const __m128 zwxy = _mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2));
+    const __m128 wzyx = _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3));
+    const __m128 twoX = _mm_set1_ps(2.0f * rotation.mVector.x);
+    const __m128 twoY = _mm_set1_ps(2.0f * rotation.mVector.y);
+    const __m128 twoZ = _mm_set1_ps(2.0f * rotation.mVector.z);
+
+    // The last lane of every sign vector is zero so the w column of the result is zero
+    const __m128 row0 = _mm_add_ps(_mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f),
+                                   _mm_add_ps(_mm_mul_ps(twoY, _mm_mul_ps(_mm_setr_ps(-1.0f, 1.0f, -1.0f, 0.0f), yxwz)),   // (-y,  x, -w)
+                                              _mm_mul_ps(twoZ, _mm_mul_ps(_mm_setr_ps(-1.0f, 1.0f, 1.0f, 0.0f), zwxy))));  // (-z,  w,  x)
+    const __m128 row1 = _mm_add_ps(_mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f),
+                                   _mm_add_ps(_mm_mul_ps(twoX, _mm_mul_ps(_mm_setr_ps(1.0f, -1.0f, 1.0f, 0.0f), yxwz)),    // ( y, -x,  w)
+                                              _mm_mul_ps(twoZ, _mm_mul_ps(_mm_setr_ps(-1.0f, -1.0f, 1.0f, 0.0f), wzyx)))); // (-w, -z,  y)
+    const __m128 row2 = _mm_add_ps(_mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f),
+                                   _mm_add_ps(_mm_mul_ps(twoX, _mm_mul_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 0.0f), zwxy)),   // ( z, -w, -x)
+                                              _mm_mul_ps(twoY, _mm_mul_ps(_mm_setr_ps(1.0f, 1.0f, -1.0f, 0.0f), wzyx))));  // ( w,  z, -y)
+
+    _mm_storeu_ps(mMatrix, _mm_mul_ps(row0, _mm_set1_ps(scale.x)));
+    _mm_storeu_ps(mMatrix + ROW1_OFFSET, _mm_mul_ps(row1, _mm_set1_ps(scale.y)));
+    _mm_storeu_ps(mMatrix + ROW2_OFFSET, _mm_mul_ps(row2, _mm_set1_ps(scale.z)));
+
+#else
+
     const float xx = rotation.mVector.x * rotation.mVector.x;
     const float yy = rotation.mVector.y * rotation.mVector.y;
     const float zz = rotation.mVector.z * rotation.mVector.z;
@@ -621,6 +693,8 @@ void Matrix::SetTransformComponents(const Vector3&    scale,
     mMatrix[9]  = (scale.z * (2.0f * (yz - wx)));
     mMatrix[10] = (scale.z * (1.0f - 2.0f * (xx + yy)));
     mMatrix[11] = 0.0f;
+
+#endif
   }
   // apply translation
   mMatrix[12] = translation.x;
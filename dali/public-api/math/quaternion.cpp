@@ -22,6 +22,7 @@
 #include <ostream>
 
 // INTERNAL INCLUDES
+#include <dali/internal/common/math-simd.h>
 #include <dali/internal/render/common/performance-monitor.h>
 #include <dali/public-api/common/constants.h>
 #include <dali/public-api/math/degree.h>
@@ -35,6 +36,40 @@ using Internal::PerformanceMonitor;
 
 const Quaternion Quaternion::IDENTITY;
 
+#ifdef DALI_MATH_SIMD_SSE
+namespace
+{
+/**
+ * Calculates the Hamilton product of two quaternions stored as (x, y, z, w)
+ */
+inline void Multiply(Vector4& result, const Vector4& lhs, const Vector4& rhs)
+{
+  // result = lhs.w * (x, y, z, w) + lhs.x * (w, -z, y, -x) + lhs.y * (z, w, -x, -y) + lhs.z * (-y, x, w, -z)
+  const __m128 q    = _mm_loadu_ps(rhs.AsFloat());
+  const __m128 wzyx = _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3));
+  const __m128 zwxy = _mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2));
+  const __m128 yxwz = _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1));
+
+  __m128 product = _mm_mul_ps(_mm_set1_ps(lhs.w), q);
+  product        = _mm_add_ps(product, _mm_mul_ps(_mm_set1_ps(lhs.x), _mm_mul_ps(_mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f), wzyx)));
+  product        = _mm_add_ps(product, _mm_mul_ps(_mm_set1_ps(lhs.y), _mm_mul_ps(_mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f), zwxy)));
+  product        = _mm_add_ps(product, _mm_mul_ps(_mm_set1_ps(lhs.z), _mm_mul_ps(_mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f), yxwz)));
+  _mm_storeu_ps(result.AsFloat(), product);
+}
+
+/**
+ * Calculates q1 * coeff1 + q2 * coeff2
+ */
+inline Quaternion Blend(const Quaternion& q1, float coeff1, const Quaternion& q2, float coeff2)
+{
+  Quaternion result;
+  _mm_storeu_ps(result.mVector.AsFloat(), _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(q1.mVector.AsFloat()), _mm_set1_ps(coeff1)), _mm_mul_ps(_mm_loadu_ps(q2.mVector.AsFloat()), _mm_set1_ps(coeff2))));
+  return result;
+}
+
+} // unnamed namespace
+#endif
+
 /**
  * Default Constructor
  */
@@ -206,10 +241,16 @@ const Quaternion Quaternion::operator*(const Quaternion& other) const
 {
   MATH_INCREASE_BY(PerformanceMonitor::FLOAT_POINT_MULTIPLY, 12);
 
+#ifdef DALI_MATH_SIMD_SSE
+  Quaternion result;
+  Multiply(result.mVector, mVector, other.mVector);
+  return result;
+#else
   return Quaternion(mVector.w * other.mVector.w - mVector.Dot(other.mVector),
                     mVector.y * other.mVector.z - mVector.z * other.mVector.y + mVector.w * other.mVector.x + mVector.x * other.mVector.w,
                     mVector.z * other.mVector.x - mVector.x * other.mVector.z + mVector.w * other.mVector.y + mVector.y * other.mVector.w,
                     mVector.x * other.mVector.y - mVector.y * other.mVector.x + mVector.w * other.mVector.z + mVector.z * other.mVector.w);
+#endif
 }
 
 Vector3 Quaternion::operator*(const Vector3& other) const
@@ -261,12 +302,17 @@ const Quaternion& Quaternion::operator*=(const Quaternion& q)
 {
   MATH_INCREASE_BY(PerformanceMonitor::FLOAT_POINT_MULTIPLY, 12);
 
+#ifdef DALI_MATH_SIMD_SSE
+  // The operands are loaded before the result is stored, so q may be this quaternion
+  Multiply(mVector, Vector4(mVector), q.mVector);
+#else
   float x = mVector.x, y = mVector.y, z = mVector.z, w = mVector.w;
 
   mVector.w = mVector.w * q.mVector.w - mVector.Dot(q.mVector);
   mVector.x = y * q.mVector.z - z * q.mVector.y + w * q.mVector.x + x * q.mVector.w;
   mVector.y = z * q.mVector.x - x * q.mVector.z + w * q.mVector.y + y * q.mVector.w;
   mVector.z = x * q.mVector.y - y * q.mVector.x + w * q.mVector.z + z * q.mVector.w;
+#endif
   return *this;
 }
 
@@ -422,12 +468,20 @@ Quaternion Quaternion::Slerp(const Quaternion& q1, const Quaternion& q2, float p
     float coeff0  = sinf((1.0f - progress) * angle) * invSine;
     float coeff1  = sinf(progress * angle) * invSine;
 
+#ifdef DALI_MATH_SIMD_SSE
+    return Blend(q1, coeff0, q3, coeff1);
+#else
     return q1 * coeff0 + q3 * coeff1;
+#endif
   }
   else
   {
     // If the angle is small, use linear interpolation
+#ifdef DALI_MATH_SIMD_SSE
+    Quaternion result = Blend(q1, 1.0f - progress, q3, progress);
+#else
     Quaternion result = q1 * (1.0f - progress) + q3 * progress;
+#endif
 
     return result.Normalized();
   }
@@ -442,7 +496,12 @@ Quaternion Quaternion::SlerpNoInvert(const Quaternion& q1, const Quaternion& q2,
     MATH_INCREASE_BY(PerformanceMonitor::FLOAT_POINT_MULTIPLY, 2);
 
     float theta = acosf(cosTheta);
+#ifdef DALI_MATH_SIMD_SSE
+    const float invSine = 1.0f / sinf(theta);
+    return Blend(q1, sinf(theta * (1.0f - t)) * invSine, q2, sinf(theta * t) * invSine);
+#else
     return (q1 * sinf(theta * (1.0f - t)) + q2 * sinf(theta * t)) / sinf(theta);
+#endif
   }
   else
   {
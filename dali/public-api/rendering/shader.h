@@ -90,6 +90,7 @@ public:
       NONE                  = 0x00, ///< No hints                                                                          @SINCE_1_1.45
       OUTPUT_IS_TRANSPARENT = 0x01, ///< Might generate transparent alpha from opaque inputs                               @SINCE_1_1.45
       MODIFIES_GEOMETRY     = 0x02, ///< Might change position of vertices, this option disables any culling optimizations @SINCE_1_1.45
+      INSTANCED             = 0x04, ///< Reads the aInstanceModelView, aInstanceColor and aInstanceSize attributes instead of uniforms, so renderers sharing geometry, shader and textures can be drawn with one instanced draw call @SINCE_2_0.8
     };
   };
 